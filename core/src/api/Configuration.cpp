@@ -21,6 +21,8 @@ std::string const Configuration::BLOCKCHAIN_EXPLORER_VERSION = {"BLOCKCHAIN_EXPL
 
 std::string const Configuration::BLOCKCHAIN_EXPLORER_PORT = {"BLOCKCHAIN_EXPLORER_PORT"};
 
+std::string const Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE = {"BLOCKCHAIN_EXPLORER_PAGE_SIZE"};
+
 std::string const Configuration::BLOCKCHAIN_OBSERVER_ENGINE = {"BLOCKCHAIN_OBSERVER_ENGINE"};
 
 std::string const Configuration::BLOCKCHAIN_OBSERVER_WS_ENDPOINT = {"BLOCKCHAIN_OBSERVER_WS_ENDPOINT"};
@@ -35,4 +37,6 @@ std::string const Configuration::TTL_CACHE = {"TTL_CACHE"};
 
 std::string const Configuration::DEACTIVATE_SYNC_TOKEN = {"DEACTIVATE_SYNC_TOKEN"};
 
+std::string const Configuration::UTXO_SELECTION_TIME_BUDGET = {"UTXO_SELECTION_TIME_BUDGET"};
+
 } } }  // namespace ledger::core::api
@@ -44,6 +44,9 @@ public:
     /** Sets the API port (e.g. for XRP it is 51234) */
     static std::string const BLOCKCHAIN_EXPLORER_PORT;
 
+    /** Sets the number of items requested per page, for explorers supporting it (e.g. Stellar Horizon, up to 200) */
+    static std::string const BLOCKCHAIN_EXPLORER_PAGE_SIZE;
+
     /** Selects the blockchain observer engine (Ledger's API) */
     static std::string const BLOCKCHAIN_OBSERVER_ENGINE;
 
@@ -64,6 +67,9 @@ public:
 
     /** Syncronization token deactivation */
     static std::string const DEACTIVATE_SYNC_TOKEN;
+
+    /** Maximum time, in milliseconds, spent searching for the best coin selection when building a transaction (unbounded when unset) */
+    static std::string const UTXO_SELECTION_TIME_BUDGET;
 };
 
 } } }  // namespace ledger::core::api
@@ -44,6 +44,9 @@ public:
 
     /** Default connection pool size for PostgreSQL */
     static int32_t const DEFAULT_PG_CONNECTION_POOL_SIZE;
+
+    /** Default TTL (in seconds) of cacheable explorer responses */
+    static int32_t const DEFAULT_HTTP_CACHE_TTL;
 };
 
 } } }  // namespace ledger::core::api
@@ -9,4 +9,8 @@ std::string const PoolConfiguration::DATABASE_NAME = {"DATABASE_NAME"};
 
 std::string const PoolConfiguration::ENABLE_INTERNAL_LOGGING = {"ENABLE_INTERNAL_LOGGING"};
 
+std::string const PoolConfiguration::ENABLE_HTTP_REQUEST_COALESCING = {"ENABLE_HTTP_REQUEST_COALESCING"};
+
+std::string const PoolConfiguration::HTTP_CACHE_TTL = {"HTTP_CACHE_TTL"};
+
 } } }  // namespace ledger::core::api
@@ -29,6 +29,16 @@ public:
      * Set to true by default.
      */
     static std::string const ENABLE_INTERNAL_LOGGING;
+
+    /**
+     * Share identical in-flight GET requests between callers.
+     *
+     * Set to true by default.
+     */
+    static std::string const ENABLE_HTTP_REQUEST_COALESCING;
+
+    /** Time to live (in seconds) of cacheable explorer responses (current block, fees...), 0 disables the cache. */
+    static std::string const HTTP_CACHE_TTL;
 };
 
 } } }  // namespace ledger::core::api
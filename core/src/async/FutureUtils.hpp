@@ -40,6 +40,9 @@
 #include "../traits/callback_traits.hpp"
 #include "../api/Error.hpp"
 #include "Future.hpp"
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 namespace ledger {
     namespace core {
@@ -76,5 +79,73 @@ namespace ledger {
             return Future<std::vector<T>>(deffered);
 
         }
+
+        template<typename T>
+        struct BoundedContainer {
+            std::vector<std::function<Future<T> ()>> tasks;
+            std::vector<T> result;
+            std::mutex lock;
+            size_t next;
+            size_t count;
+            std::shared_ptr<Deffered<std::vector<T>>> deffered;
+
+            static void launchNext(const std::shared_ptr<api::ExecutionContext>& context,
+                                   const std::shared_ptr<BoundedContainer<T>>& container) {
+                size_t index;
+                {
+                    std::lock_guard<std::mutex> lock(container->lock);
+                    if (container->deffered->hasValue() || container->next >= container->tasks.size())
+                        return;
+                    index = container->next++;
+                }
+                auto future = Try<Future<T>>::from(container->tasks[index]);
+                if (future.isFailure()) {
+                    std::lock_guard<std::mutex> lock(container->lock);
+                    if (!container->deffered->hasValue())
+                        container->deffered->setError(future.getFailure());
+                    return;
+                }
+                Future<T> pending = future.getValue();
+                pending.onComplete(context, [context, container, index] (const Try<T>& result) {
+                    {
+                        std::lock_guard<std::mutex> lock(container->lock);
+                        if (container->deffered->hasValue())
+                            return;
+                        if (result.isFailure()) {
+                            container->deffered->setError(result.getFailure());
+                            return;
+                        }
+                        container->result[index] = result.getValue();
+                        container->count++;
+                        if (container->count == container->result.size()) {
+                            container->deffered->setValue(container->result);
+                            return;
+                        }
+                    }
+                    launchNext(context, container);
+                });
+            }
+        };
+
+        // Run the given tasks with at most `parallelism` of them in flight, results keep the tasks order
+        template<typename T>
+        Future<std::vector<T>> executeAll(const std::shared_ptr<api::ExecutionContext>& context,
+                                          const std::vector<std::function<Future<T> ()>>& tasks,
+                                          size_t parallelism) {
+            if (tasks.empty()) {
+                return Future<std::vector<T>>::successful(std::vector<T>());
+            }
+            auto container = std::make_shared<BoundedContainer<T>>();
+            container->tasks = tasks;
+            container->result.resize(tasks.size());
+            container->next = 0;
+            container->count = 0;
+            container->deffered = std::make_shared<Deffered<std::vector<T>>>();
+            auto workers = std::max<size_t>(1, std::min(parallelism, tasks.size()));
+            for (size_t i = 0; i < workers; ++i) {
+                BoundedContainer<T>::launchNext(context, container);
+            }
+            return Future<std::vector<T>>(container->deffered);
+        }
     }
 }
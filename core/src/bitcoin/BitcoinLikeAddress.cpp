@@ -97,8 +97,8 @@ namespace ledger {
                                    const std::vector<uint8_t> &hash160,
                                    const api::BitcoinLikeNetworkParameters &params) {
 
-            auto bech32 = Bech32Factory::newBech32Instance(params.Identifier).getValue();
-            auto witnessVersion = (keychainEngine == api::KeychainEngines::BIP173_P2WPKH) ? bech32->getBech32Params().P2WPKHVersion : bech32->getBech32Params().P2WSHVersion;
+            auto bech32 = Bech32Factory::getBech32Instance(params.Identifier).getValue();
+            const auto& witnessVersion = (keychainEngine == api::KeychainEngines::BIP173_P2WPKH) ? bech32->getBech32Params().P2WPKHVersion : bech32->getBech32Params().P2WSHVersion;
             return bech32->encode(hash160, witnessVersion);
         }
 
@@ -144,8 +144,8 @@ namespace ledger {
                                   const ledger::core::api::Currency &currency,
                                   const Option<std::string>& derivationPath) {
             auto result = Try<std::shared_ptr<ledger::core::AbstractAddress>>::from([&] () {
-                auto bech32 = Bech32Factory::newBech32Instance(currency.bitcoinLikeNetworkParameters.value().Identifier);
-                auto isBech32 = bech32.hasValue() && (bech32.getValue()->getBech32Params().hrp == address.substr(0, bech32.getValue()->getBech32Params().hrp.size()));
+                auto bech32 = Bech32Factory::getBech32Instance(currency.bitcoinLikeNetworkParameters.value().Identifier);
+                auto isBech32 = bech32.hasValue() && address.compare(0, bech32.getValue()->getBech32Params().hrp.size(), bech32.getValue()->getBech32Params().hrp) == 0;
                 return isBech32 ? fromBech32(address, currency, derivationPath) : fromBase58(address, currency, derivationPath);
             });
             return std::dynamic_pointer_cast<AbstractAddress>(result.toOption().getValueOr(nullptr));
@@ -192,7 +192,7 @@ namespace ledger {
                                                                            const api::Currency& currency,
                                                                            const Option<std::string>& derivationPath) {
             auto& params = currency.bitcoinLikeNetworkParameters.value();
-            auto bech32 = Bech32Factory::newBech32Instance(params.Identifier).getValue();
+            auto bech32 = Bech32Factory::getBech32Instance(params.Identifier).getValue();
             auto decoded = bech32->decode(address);
             auto keychainEngine = (decoded.second.size() == 32 || decoded.first == bech32->getBech32Params().P2WSHVersion) ? api::KeychainEngines::BIP173_P2WSH : api::KeychainEngines::BIP173_P2WPKH;
             return std::make_shared<ledger::core::BitcoinLikeAddress>(currency,
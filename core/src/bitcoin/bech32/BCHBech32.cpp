@@ -32,9 +32,8 @@
 #include <utils/Exception.hpp>
 namespace ledger {
     namespace core {
-        uint64_t BCHBech32::polymod(const std::vector<uint8_t>& values) const {
-            uint64_t chk = 1;
-            for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t BCHBech32::polymod(uint64_t chk, const uint8_t* values, size_t size) const {
+            for (size_t i = 0; i < size; ++i) {
                 uint64_t top = chk >> 35;
                 chk = (chk & 0x07ffffffff) << 5 ^ values[i];
                 size_t index = 0;
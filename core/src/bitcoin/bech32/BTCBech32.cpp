@@ -34,9 +34,9 @@
 
 namespace ledger {
     namespace core {
-        uint64_t BTCBech32::polymod(const std::vector<uint8_t>& values) const {
-            uint32_t chk = 1;
-            for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t BTCBech32::polymod(uint64_t state, const uint8_t* values, size_t size) const {
+            auto chk = static_cast<uint32_t>(state);
+            for (size_t i = 0; i < size; ++i) {
                 uint8_t top = chk >> 25;
                 chk = (chk & 0x1ffffff) << 5 ^ values[i];
                 auto index = 0;
@@ -62,12 +62,10 @@ namespace ledger {
 
         std::string BTCBech32::encode(const std::vector<uint8_t>& hash,
                                       const std::vector<uint8_t>& version) const {
-            std::vector<uint8_t> data(hash);
             int fromBits = 8, toBits = 5;
             bool pad = true;
-            std::vector<uint8_t> converted;
-            converted.insert(converted.end(), version.begin(), version.end());
-            Bech32::convertBits(data, fromBits, toBits, pad, converted);
+            std::vector<uint8_t> converted(version);
+            Bech32::convertBits(hash, fromBits, toBits, pad, converted);
             return encodeBech32(converted);
         }
 
@@ -80,7 +78,8 @@ namespace ledger {
             std::vector<uint8_t> converted;
             int fromBits = 5, toBits = 8;
             bool pad = false;
-            auto result = Bech32::convertBits(std::vector<uint8_t>(decoded.second.begin() + 1, decoded.second.end()),
+            auto result = Bech32::convertBits(decoded.second.data() + 1,
+                                              decoded.second.size() - 1,
                                               fromBits,
                                               toBits,
                                               pad,
@@ -40,9 +40,11 @@ namespace ledger {
         class BTCBech32 : public Bech32 {
         public:
             BTCBech32(const std::string &networkIdentifier) : Bech32(Bech32Parameters::getBech32Params(networkIdentifier)){
+                initializeHrpPolymod();
             };
 
-            uint64_t polymod(const std::vector<uint8_t>& values) const override;
+            using Bech32::polymod;
+            uint64_t polymod(uint64_t chk, const uint8_t* values, size_t size) const override;
 
             std::vector<uint8_t> expandHrp(const std::string& hrp) const override;
 
@@ -41,13 +41,57 @@ namespace ledger {
 
     namespace core {
 
-        BytesReader::BytesReader(const std::vector<uint8_t> &data, unsigned long offset, unsigned long length) {
-            _bytes = data;
+        BytesReader::BytesReader(const std::vector<uint8_t> &data, unsigned long offset, unsigned long length)
+            : _bytes(data), _data(_bytes.data()), _size(_bytes.size()) {
             _offset = offset;
             _length = length;
             _cursor = offset;
         }
 
+        BytesReader::BytesReader(const uint8_t *data, unsigned long length)
+            : _data(data), _size(length), _cursor(0), _offset(0), _length(length) {
+        }
+
+        BytesReader::BytesReader(const BytesReader &reader) : _bytes(reader._bytes) {
+            rebind(reader, reader.ownsData());
+        }
+
+        BytesReader::BytesReader(BytesReader &&reader) {
+            auto const owning = reader.ownsData();
+            _bytes = std::move(reader._bytes);
+            rebind(reader, owning);
+        }
+
+        BytesReader& BytesReader::operator=(const BytesReader &reader) {
+            if (this != &reader) {
+                _bytes = reader._bytes;
+                rebind(reader, reader.ownsData());
+            }
+            return *this;
+        }
+
+        BytesReader& BytesReader::operator=(BytesReader &&reader) {
+            if (this != &reader) {
+                auto const owning = reader.ownsData();
+                _bytes = std::move(reader._bytes);
+                rebind(reader, owning);
+            }
+            return *this;
+        }
+
+        bool BytesReader::ownsData() const {
+            return _data == _bytes.data();
+        }
+
+        void BytesReader::rebind(const BytesReader &reader, bool owning) {
+            // An owning reader must point to its own copy, a view keeps pointing to the foreign buffer
+            _data = owning ? _bytes.data() : reader._data;
+            _size = reader._size;
+            _cursor = reader._cursor;
+            _offset = reader._offset;
+            _length = reader._length;
+        }
+
         void BytesReader::seek(long offset, BytesReader::Seek origin) {
             unsigned long off = 0;
             switch (origin) {
@@ -101,10 +145,10 @@ namespace ledger {
         }
 
         uint8_t BytesReader::readNextByte() {
-            if (_cursor >= _bytes.size()) {
-                throw std::out_of_range(fmt::format("Read {} of {}", _cursor, hex::toString(_bytes)));
+            if (_cursor >= _size) {
+                throw std::out_of_range(fmt::format("Read {} of {}", _cursor, hex::toString(std::vector<uint8_t>(_data, _data + _size))));
             }
-            uint8_t const result = _bytes[_cursor];
+            uint8_t const result = _data[_cursor];
             seek(1, Seek::CUR);
             return result;
         }
@@ -161,18 +205,14 @@ namespace ledger {
             uint8_t size = readNextByte();
             switch (size) {
                 case 0xFD:
-                    size = 2;
-                    break;
+                    return readNextLeUint16();
                 case 0xFE:
-                    size = 4;
-                    break;
+                    return readNextLeUint();
                 case 0xFF:
-                    size = 8;
-                    break;
+                    return readNextLeUlong();
                 default:
                     return size;
             }
-            return readNextLeBigInt(size).toUint64();
         }
 
         std::string BytesReader::readNextVarString() {
@@ -181,7 +221,7 @@ namespace ledger {
         }
 
         uint8_t BytesReader::peek() const {
-            return _bytes[_cursor];
+            return _data[_cursor];
         }
 
         std::vector<uint8_t> BytesReader::readUntilEnd() {
@@ -189,10 +229,18 @@ namespace ledger {
         }
 
         void BytesReader::read(unsigned long length, std::vector<uint8_t> &data) {
-            for (auto i = 0; i < length; i++) {
-                data[i] = _bytes[_cursor];
-                seek(1, Seek::CUR);
+            if (length > 0) {
+                std::memcpy(data.data(), readView(length), length);
+            }
+        }
+
+        const uint8_t* BytesReader::readView(unsigned long length) {
+            if (length > available() || _cursor + length > _size) {
+                throw std::out_of_range(fmt::format("Cannot read {} bytes at {}, {} bytes available", length, getCursor(), available()));
             }
+            auto const data = _data + _cursor;
+            _cursor += length;
+            return data;
         }
 
         uint16_t BytesReader::readNextBeUint16() {
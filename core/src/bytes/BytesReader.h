@@ -33,6 +33,7 @@
 
 #include <cstdint>
 #include <array>
+#include <cstring>
 #include <vector>
 #include <math/BigInt.h>
 #include "../ledger-core.h"
@@ -68,6 +69,18 @@ namespace ledger {
              * @return
              */
             BytesReader(const std::vector<uint8_t>& data) : BytesReader(data, 0, data.size()) {};
+            /**
+             * Creates a new bytes reader over a buffer it does not own. Nothing is copied, the buffer must outlive
+             * the reader (and every pointer returned by readView).
+             * @param data The data to read.
+             * @param length The number of bytes the reader can read.
+             */
+            BytesReader(const uint8_t* data, unsigned long length);
+
+            BytesReader(const BytesReader& reader);
+            BytesReader(BytesReader&& reader);
+            BytesReader& operator=(const BytesReader& reader);
+            BytesReader& operator=(BytesReader&& reader);
 
             /**
              * Sets the position indicator associated with the BytesReader to a new position.
@@ -83,6 +96,12 @@ namespace ledger {
              */
             std::vector<uint8_t> read(unsigned long length);
             void read(unsigned long length, std::vector<uint8_t>& out);
+            /**
+             * Advances the cursor by *length* bytes without copying them.
+             * @param length Number of bytes to read.
+             * @return A pointer to the first read byte, valid as long as the underlying buffer is.
+             */
+            const uint8_t* readView(unsigned long length);
 
             /**
              * Reads a single byte.
@@ -198,16 +217,20 @@ namespace ledger {
             template<typename T, endianness::Endianness endianness> T readNextValue() {
                 T result;
                 auto ptr = reinterpret_cast<uint8_t *>(&result);
-                for (auto i = 0; i < sizeof(result); i++) {
-                    ptr[i] = readNextByte();
-                }
+                std::memcpy(ptr, readView(sizeof(result)), sizeof(result));
                 ledger::core::endianness::swapToEndianness(ptr, sizeof(result),
                                                             endianness,
                                                             endianness::getSystemEndianness());
                 return result;
             }
 
+            bool ownsData() const;
+            void rebind(const BytesReader& reader, bool owning);
+
+            // Owned copy of the data, empty when the reader is a view over a foreign buffer
             std::vector<uint8_t> _bytes;
+            const uint8_t* _data;
+            unsigned long _size;
             unsigned long _cursor;
             unsigned long _offset;
             unsigned long _length;
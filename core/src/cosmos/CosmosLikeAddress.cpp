@@ -75,8 +75,7 @@ api::CosmosLikeNetworkParameters CosmosLikeAddress::getNetworkParameters()
 
 std::string CosmosLikeAddress::toBech32()
 {
-    auto bech32 = std::make_shared<CosmosBech32>(_type);
-    return bech32->encode(_hash160, std::vector<uint8_t>());
+    return CosmosBech32::forType(_type)->encode(_hash160, std::vector<uint8_t>());
 }
 
 std::experimental::optional<std::string> CosmosLikeAddress::getDerivationPath()
@@ -121,8 +120,7 @@ std::shared_ptr<CosmosLikeAddress> CosmosLikeAddress::fromBech32(
             throw Exception(api::ErrorCode::INVALID_BECH32_FORMAT, "Invalid cosmos address");
         }
     }(address);
-    auto const bech32 = CosmosBech32(type);
-    auto const decoded = bech32.decode(address);
+    auto const decoded = CosmosBech32::forType(type)->decode(address);
     // Second supposed to be hash160 of pubKey
     if (decoded.second.size() != 20) {
         throw Exception(api::ErrorCode::INVALID_BECH32_FORMAT, "Invalid decoded public key hash");
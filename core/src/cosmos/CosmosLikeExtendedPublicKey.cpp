@@ -95,8 +95,7 @@ std::string CosmosLikeExtendedPublicKey::toBase58()
 std::string CosmosLikeExtendedPublicKey::toBech32()
 {
     auto const pubKey = getKey().getPublicKey();
-    auto const pkBech32 = CosmosBech32(_type);
-    return pkBech32.encode(
+    return CosmosBech32::forType(_type)->encode(
         pubKey, vector::concat(params().PubKeyPrefix, std::vector<uint8_t>(pubKey.size())));
 }
 
@@ -149,8 +148,7 @@ std::shared_ptr<CosmosLikeExtendedPublicKey> CosmosLikeExtendedPublicKey::fromBe
                 std::string::npos
             ? api::CosmosBech32Type::PUBLIC_KEY
             : api::CosmosBech32Type::PUBLIC_KEY_VAL;
-    auto const pkBech32 = CosmosBech32(type);
-    auto const decodedPk = pkBech32.decode(bech32PubKey);
+    auto const decodedPk = CosmosBech32::forType(type)->decode(bech32PubKey);
 
     // Check version
     if (std::vector<uint8_t>(
@@ -50,7 +50,8 @@ std::pair<std::vector<uint8_t>, std::vector<uint8_t>> CosmosBech32::decode(
     int const toBits = 8;
     bool const pad = false;
     auto result = Bech32::convertBits(
-        std::vector<uint8_t>(decoded.second.begin() + _offsetConversion, decoded.second.end()),
+        decoded.second.data() + _offsetConversion,
+        decoded.second.size() - _offsetConversion,
         fromBits,
         toBits,
         pad,
@@ -64,10 +65,32 @@ std::pair<std::vector<uint8_t>, std::vector<uint8_t>> CosmosBech32::decode(
     return std::make_pair(version, converted);
 }
 
-uint64_t CosmosBech32::polymod(const std::vector<uint8_t> &values) const
+std::shared_ptr<CosmosBech32> CosmosBech32::forType(api::CosmosBech32Type type)
 {
-    uint32_t chk = 1;
-    for (size_t i = 0; i < values.size(); ++i) {
+    static const auto ADDRESS = std::make_shared<CosmosBech32>(api::CosmosBech32Type::ADDRESS);
+    static const auto ADDRESS_VAL = std::make_shared<CosmosBech32>(api::CosmosBech32Type::ADDRESS_VAL);
+    static const auto PUBLIC_KEY = std::make_shared<CosmosBech32>(api::CosmosBech32Type::PUBLIC_KEY);
+    static const auto PUBLIC_KEY_VAL =
+        std::make_shared<CosmosBech32>(api::CosmosBech32Type::PUBLIC_KEY_VAL);
+    switch (type) {
+    case api::CosmosBech32Type::ADDRESS:
+        return ADDRESS;
+    case api::CosmosBech32Type::ADDRESS_VAL:
+        return ADDRESS_VAL;
+    case api::CosmosBech32Type::PUBLIC_KEY:
+        return PUBLIC_KEY;
+    case api::CosmosBech32Type::PUBLIC_KEY_VAL:
+        return PUBLIC_KEY_VAL;
+    default:
+        throw make_exception(
+            api::ErrorCode::INVALID_ARGUMENT, "No Bech32 parameters set for this Bech32 type");
+    }
+}
+
+uint64_t CosmosBech32::polymod(uint64_t state, const uint8_t *values, size_t size) const
+{
+    auto chk = static_cast<uint32_t>(state);
+    for (size_t i = 0; i < size; ++i) {
         uint8_t top = chk >> 25;
         chk = (chk & 0x1ffffff) << 5 ^ values[i];
         auto index = 0;
@@ -97,14 +120,12 @@ std::string CosmosBech32::encode(
 {
     // Convert the "hash" number from base256 (bytearray) to base32
     // Each digit in data is a byte.
-    std::vector<uint8_t> data(hash);
     int const fromBits = 8;
     int const toBits = 5;
     bool const pad = true;
-    std::vector<uint8_t> converted;
-    converted.insert(converted.end(), version.begin(), version.end());
+    std::vector<uint8_t> converted(version);
     // After this converted is [ version(base256) || hash(base32) ]
-    Bech32::convertBits(data, fromBits, toBits, pad, converted);
+    Bech32::convertBits(hash, fromBits, toBits, pad, converted);
     return encodeBech32(converted);
 }
 }  // namespace core
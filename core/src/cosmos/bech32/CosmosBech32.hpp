@@ -34,6 +34,7 @@
 #include <api/CosmosBech32Type.hpp>
 #include <cosmos/bech32/CosmosLikeBech32ParametersHelpers.hpp>
 #include <math/bech32/Bech32.h>
+#include <memory>
 
 namespace ledger {
 namespace core {
@@ -43,11 +44,16 @@ class CosmosBech32 : public Bech32 {
         Bech32(cosmos::getBech32Params(type)),
         _offsetConversion(offsetConversion)
     {
+        initializeHrpPolymod();
     }
 
     virtual ~CosmosBech32(){};
 
-    uint64_t polymod(const std::vector<uint8_t> &values) const override;
+    // Shared codec of the given type
+    static std::shared_ptr<CosmosBech32> forType(api::CosmosBech32Type type);
+
+    using Bech32::polymod;
+    uint64_t polymod(uint64_t chk, const uint8_t *values, size_t size) const override;
 
     std::vector<uint8_t> expandHrp(const std::string &hrp) const override;
 
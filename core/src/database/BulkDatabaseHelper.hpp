@@ -0,0 +1,144 @@
+/*
+ *
+ * BulkDatabaseHelper
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <soci.h>
+
+namespace ledger {
+    namespace core {
+        // Multi-row statements built with plain bound parameters. soci vector bindings are not
+        // available on every backend (the proxy backend rejects them), so rows are inserted with
+        // "INSERT ... VALUES (...), (...)" statements instead.
+        class BulkDatabaseHelper {
+        public:
+            using Statement = soci::details::prepare_temp_type;
+
+            // The lowest bound parameters limit of the supported backends (SQLite before 3.32)
+            static const size_t MAX_BOUND_PARAMETERS = 999;
+            // Bound parameters limit of the PostgreSQL protocol (parameter count is sent as an int16)
+            static const size_t MAX_POSTGRESQL_BOUND_PARAMETERS = 65535;
+            // Attempts of an ingestion transaction failing on a serialization error or a deadlock
+            static const int MAX_INGESTION_ATTEMPTS = 5;
+
+            enum class OnConflict {
+                FAIL,
+                // "ON CONFLICT DO NOTHING", understood by PostgreSQL and SQLite >= 3.24
+                IGNORE
+            };
+
+            static bool isPostgreSQL(soci::session &sql) {
+                return sql.get_backend_name() == "postgresql";
+            }
+
+            static size_t getMaxBoundParameters(soci::session &sql) {
+                return isPostgreSQL(sql) ? MAX_POSTGRESQL_BOUND_PARAMETERS : MAX_BOUND_PARAMETERS;
+            }
+
+            // ":p0, :p1, ..." with count placeholders, numbered from offset
+            static std::string placeholders(size_t count, size_t offset = 0) {
+                std::string result;
+                for (size_t index = 0; index < count; index++) {
+                    if (index > 0) {
+                        result += ", ";
+                    }
+                    result += ":p" + std::to_string(offset + index);
+                }
+                return result;
+            }
+
+            // Insert rows with as few statements as the parameters limit of the session allows. The binder
+            // is called once per row and must bind exactly columns values to the statement, e.g.
+            // statement, soci::use(row.uid). Bound values must outlive the call, which is why rows are taken
+            // by reference.
+            template <typename Row, typename Binder>
+            static void insert(soci::session &sql,
+                               const std::string &table,
+                               size_t columns,
+                               const std::vector<Row> &rows,
+                               Binder binder,
+                               OnConflict onConflict = OnConflict::FAIL) {
+                auto rowsPerStatement = std::max<size_t>(1, getMaxBoundParameters(sql) / columns);
+                for (size_t offset = 0; offset < rows.size(); offset += rowsPerStatement) {
+                    auto count = std::min(rowsPerStatement, rows.size() - offset);
+                    std::string query = "INSERT INTO " + table + " VALUES ";
+                    for (size_t index = 0; index < count; index++) {
+                        if (index > 0) {
+                            query += ", ";
+                        }
+                        query += "(" + placeholders(columns, index * columns) + ")";
+                    }
+                    if (onConflict == OnConflict::IGNORE) {
+                        query += " ON CONFLICT DO NOTHING";
+                    }
+                    Statement statement = (sql.prepare << query);
+                    for (size_t index = 0; index < count; index++) {
+                        binder(statement, rows[offset + index]);
+                    }
+                    soci::statement st(statement);
+                    st.execute(true);
+                }
+            }
+
+            // Run writer in its own transaction, meant for the writes of the synchronizers. On PostgreSQL
+            // sessions default to SERIALIZABLE, ingestion transactions are lowered to READ COMMITTED since
+            // they only insert or update rows of the synchronized account, and they are replayed when they
+            // still fail with a serialization error or a deadlock. Only the database writes are rolled back:
+            // a writer changing anything else must stage it and undo it when replayed, as synchronizers do
+            // with AbstractAccount::stageChanges.
+            template <typename Writer>
+            static void ingest(soci::session &sql, Writer writer, int maxAttempts = MAX_INGESTION_ATTEMPTS) {
+                for (int attempt = 1;; attempt++) {
+                    soci::transaction tr(sql);
+                    try {
+                        if (isPostgreSQL(sql)) {
+                            sql << "SET TRANSACTION ISOLATION LEVEL READ COMMITTED";
+                        }
+                        writer();
+                        tr.commit();
+                        return;
+                    } catch (const soci::soci_error &error) {
+                        tr.rollback();
+                        if (attempt >= maxAttempts || !isRetryable(error)) {
+                            throw;
+                        }
+                    }
+                }
+            }
+
+            // Whether a failed transaction can be replayed as is (PostgreSQL SQLSTATE 40001 and 40P01)
+            static bool isRetryable(const soci::soci_error &error);
+        };
+    }
+}
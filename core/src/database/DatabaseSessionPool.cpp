@@ -94,6 +94,11 @@ namespace ledger {
         void DatabaseSessionPool::performDatabaseMigration() {
             soci::session sql(getPool());
             int version = getDatabaseMigrationVersion(sql);
+            // Up to date database, nothing to migrate
+            const auto currentVersion = CURRENT_DATABASE_SCHEME_VERSION;
+            if (version == currentVersion) {
+                return;
+            }
 
             soci::transaction tr(sql);
             migrate<CURRENT_DATABASE_SCHEME_VERSION>(sql, version, _type);
@@ -69,6 +69,8 @@ namespace ledger {
             // This might be restrictive since it's done on session level,
             // we could question that setting when we are working on performance
             // enhancements.
+            // Synchronizers write through BulkDatabaseHelper::ingest which lowers its own transactions
+            // to READ COMMITTED and replays them on serialization failures.
             // https://www.postgresql.org/docs/9.4/sql-set-transaction.html
             session << "SET SESSION CHARACTERISTICS AS TRANSACTION ISOLATION LEVEL SERIALIZABLE";
         }
@@ -1106,5 +1106,81 @@ namespace ledger {
             sql << "DROP TABLE algorand_currencies";
         }
 
+        template <> void migrate<24>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "CREATE TABLE stellar_account_sync_states("
+                   "account_uid VARCHAR(255) PRIMARY KEY NOT NULL REFERENCES stellar_accounts(uid) ON DELETE CASCADE ON UPDATE CASCADE,"
+                   "transaction_paging_token VARCHAR(255) NOT NULL"
+                   ")";
+        }
+
+        template <> void rollback<24>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "DROP TABLE stellar_account_sync_states";
+        }
+
+        template <> void migrate<25>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "CREATE TABLE erc20_account_balances("
+                   "account_uid VARCHAR(255) PRIMARY KEY NOT NULL REFERENCES erc20_accounts(uid) ON DELETE CASCADE ON UPDATE CASCADE,"
+                   "balance VARCHAR(255) NOT NULL"
+                   ")";
+            sql << "CREATE INDEX erc20_operations_account_date_index ON erc20_operations(account_uid, date)";
+        }
+
+        template <> void rollback<25>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "DROP INDEX erc20_operations_account_date_index";
+            sql << "DROP TABLE erc20_account_balances";
+        }
+
+        template <> void migrate<26>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "CREATE INDEX bitcoin_inputs_previous_output_index ON bitcoin_inputs(previous_tx_uid, previous_output_idx)";
+            sql << "CREATE INDEX bitcoin_outputs_account_height_index ON bitcoin_outputs(account_uid, block_height)";
+            sql << "CREATE INDEX bitcoin_outputs_account_amount_index ON bitcoin_outputs(account_uid, amount)";
+        }
+
+        template <> void rollback<26>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "DROP INDEX bitcoin_outputs_account_amount_index";
+            sql << "DROP INDEX bitcoin_outputs_account_height_index";
+            sql << "DROP INDEX bitcoin_inputs_previous_output_index";
+        }
+
+        template <> void migrate<27>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "CREATE INDEX blocks_currency_height_index ON blocks(currency_name, height)";
+            sql << "CREATE INDEX operations_account_date_index ON operations(account_uid, date)";
+            sql << "CREATE INDEX operations_block_index ON operations(block_uid)";
+            sql << "CREATE INDEX bitcoin_transactions_block_index ON bitcoin_transactions(block_uid)";
+            sql << "CREATE INDEX bitcoin_outputs_transaction_index ON bitcoin_outputs(transaction_uid)";
+            sql << "CREATE INDEX bitcoin_transaction_inputs_input_index ON bitcoin_transaction_inputs(input_uid)";
+            sql << "CREATE INDEX bitcoin_operations_transaction_index ON bitcoin_operations(transaction_uid)";
+            sql << "CREATE INDEX ethereum_transactions_block_index ON ethereum_transactions(block_uid)";
+            sql << "CREATE INDEX internal_operations_operation_index ON internal_operations(ethereum_operation_uid)";
+            sql << "CREATE INDEX erc20_operations_operation_index ON erc20_operations(ethereum_operation_uid)";
+            sql << "CREATE INDEX ripple_transactions_block_index ON ripple_transactions(block_uid)";
+            sql << "CREATE INDEX ripple_memos_transaction_index ON ripple_memos(transaction_uid)";
+            sql << "CREATE INDEX tezos_transactions_block_index ON tezos_transactions(block_uid)";
+            sql << "CREATE INDEX cosmos_transactions_block_index ON cosmos_transactions(block_uid)";
+            sql << "CREATE INDEX cosmos_messages_transaction_index ON cosmos_messages(transaction_uid)";
+            sql << "CREATE INDEX cosmos_operations_message_index ON cosmos_operations(message_uid)";
+            sql << "CREATE INDEX cosmos_multisend_io_message_index ON cosmos_multisend_io(message_uid)";
+        }
+
+        template <> void rollback<27>(soci::session& sql, api::DatabaseBackendType type) {
+            sql << "DROP INDEX cosmos_multisend_io_message_index";
+            sql << "DROP INDEX cosmos_operations_message_index";
+            sql << "DROP INDEX cosmos_messages_transaction_index";
+            sql << "DROP INDEX cosmos_transactions_block_index";
+            sql << "DROP INDEX tezos_transactions_block_index";
+            sql << "DROP INDEX ripple_memos_transaction_index";
+            sql << "DROP INDEX ripple_transactions_block_index";
+            sql << "DROP INDEX erc20_operations_operation_index";
+            sql << "DROP INDEX internal_operations_operation_index";
+            sql << "DROP INDEX ethereum_transactions_block_index";
+            sql << "DROP INDEX bitcoin_operations_transaction_index";
+            sql << "DROP INDEX bitcoin_transaction_inputs_input_index";
+            sql << "DROP INDEX bitcoin_outputs_transaction_index";
+            sql << "DROP INDEX bitcoin_transactions_block_index";
+            sql << "DROP INDEX operations_block_index";
+            sql << "DROP INDEX operations_account_date_index";
+            sql << "DROP INDEX blocks_currency_height_index";
+        }
+
     }
 }
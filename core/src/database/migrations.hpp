@@ -195,6 +195,22 @@ namespace ledger {
         template <> void migrate<23>(soci::session& sql, api::DatabaseBackendType type);
         template <> void rollback<23>(soci::session& sql, api::DatabaseBackendType type);
 
+        // Stellar synchronization cursors, stored along with synchronized data
+        template <> void migrate<24>(soci::session& sql, api::DatabaseBackendType type);
+        template <> void rollback<24>(soci::session& sql, api::DatabaseBackendType type);
+
+        // ERC20 local balances and date ordered operations index
+        template <> void migrate<25>(soci::session& sql, api::DatabaseBackendType type);
+        template <> void rollback<25>(soci::session& sql, api::DatabaseBackendType type);
+
+        // Indexes for the streamed UTXO selection
+        template <> void migrate<26>(soci::session& sql, api::DatabaseBackendType type);
+        template <> void rollback<26>(soci::session& sql, api::DatabaseBackendType type);
+
+        // Indexes for the range based rollbacks and the ON DELETE CASCADE foreign keys they go through
+        template <> void migrate<27>(soci::session& sql, api::DatabaseBackendType type);
+        template <> void rollback<27>(soci::session& sql, api::DatabaseBackendType type);
+
     }
 }
 
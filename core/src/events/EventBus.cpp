@@ -29,95 +29,150 @@
  *
  */
 #include "EventBus.hpp"
+#include <utils/LambdaRunnable.hpp>
 
-void ledger::core::EventBus::subscribe(const std::shared_ptr<ledger::core::api::ExecutionContext> &context,
-                                       const std::shared_ptr<ledger::core::api::EventReceiver> &receiver) {
+namespace ledger {
+    namespace core {
 
-    std::weak_ptr<EventBus> weak_self(shared_from_this());
+        struct EventBus::Subscriber {
+            Subscriber(const std::shared_ptr<api::ExecutionContext> &c, const std::shared_ptr<api::EventReceiver> &r)
+                : context(c), receiver(r), scheduled(false) {}
 
-    async<Unit>([=] () {
+            const std::shared_ptr<api::ExecutionContext> context;
+            const std::shared_ptr<api::EventReceiver> receiver;
+            std::mutex lock;
+            std::vector<std::shared_ptr<Event>> pending;
+            // Position in pending of the waiting event of each coalesced code
+            std::unordered_map<int32_t, size_t> coalescedPositions;
+            // True while a drain runnable is posted on the context
+            bool scheduled;
+        };
 
-        auto local_self = weak_self.lock();
-        if (!local_self) {
-            throw make_exception(api::ErrorCode::NULL_POINTER, "EventBus was released.");
-        }
-        auto local_context = context;
-        auto local_receiver = receiver;
+        EventBus::EventBus(const std::shared_ptr<api::ExecutionContext> &context)
+            : DedicatedContext(context), _subscribers(std::make_shared<const SubscribersList>()) {
 
-        for (auto& i : local_self->_subscribers) {
-            auto& r = std::get<1>(i);
-            if (r == local_receiver)
-                return unit;
-        }
-        
-        // Post all sticky event to the receiver
-        //local_receiver is moved below when pushed in _subscribers, we need a new local_receiver
-        //lambda passed to Future<Unit>::async
-        std::weak_ptr<ledger::core::api::EventReceiver> local_weak_receiver(receiver);
-        for (auto& event : local_self->_stickies) {
-            auto lambda = [=] () {
-                auto local_r = local_weak_receiver.lock();
-                if (!local_r) {
-                    throw make_exception(api::ErrorCode::NULL_POINTER, "Receiver was released.");
-                }
-                local_r->onEvent(event.second);
-                return unit;
-            };
-            Future<Unit>::async(local_context, lambda);
         }
 
-        local_self->_subscribers.push_back(std::make_tuple<std::shared_ptr<api::ExecutionContext>, std::shared_ptr<api::EventReceiver>>(std::move(local_context), std::move(local_receiver)));
-        return unit;
-    });
-}
-
-void ledger::core::EventBus::unsubscribe(const std::shared_ptr<ledger::core::api::EventReceiver> &receiver) {
-    std::weak_ptr<EventBus> weak_self(shared_from_this());
-    async<Unit>([=] () {
-        auto local_self = weak_self.lock();
-        if (!local_self) {
-            throw make_exception(api::ErrorCode::NULL_POINTER, "EventBus was released.");
+        void EventBus::subscribe(const std::shared_ptr<api::ExecutionContext> &context,
+                                 const std::shared_ptr<api::EventReceiver> &receiver) {
+            std::lock_guard<std::mutex> guard(_lock);
+            auto current = std::atomic_load(&_subscribers);
+            for (auto& subscriber : *current) {
+                if (subscriber->receiver == receiver)
+                    return;
+            }
+            auto subscriber = std::make_shared<Subscriber>(context, receiver);
+            // Post all sticky events to the receiver
+            for (auto& event : _stickies) {
+                enqueue(subscriber, event.second, false);
+            }
+            auto subscribers = std::make_shared<SubscribersList>(*current);
+            subscribers->push_back(subscriber);
+            std::atomic_store(&_subscribers, std::shared_ptr<const SubscribersList>(subscribers));
         }
-        for (auto it = local_self->_subscribers.begin(); it != local_self->_subscribers.end(); it++) {
-            auto& r = std::get<1>(*it);
-            if (r == receiver) {
-                local_self->_subscribers.erase(it);
-                return unit;
+
+        void EventBus::unsubscribe(const std::shared_ptr<api::EventReceiver> &receiver) {
+            std::lock_guard<std::mutex> guard(_lock);
+            auto current = std::atomic_load(&_subscribers);
+            auto subscribers = std::make_shared<SubscribersList>();
+            subscribers->reserve(current->size());
+            for (auto& subscriber : *current) {
+                if (subscriber->receiver != receiver)
+                    subscribers->push_back(subscriber);
             }
+            std::atomic_store(&_subscribers, std::shared_ptr<const SubscribersList>(subscribers));
         }
-        return unit;
-    });
-}
 
-void ledger::core::EventBus::post(const std::shared_ptr<ledger::core::Event>& event) {
-    std::weak_ptr<EventBus> weak_self(shared_from_this());
-    run([=] () {
-        auto local_self = weak_self.lock();
-        if (!local_self) {
-            throw make_exception(api::ErrorCode::NULL_POINTER, "EventBus was released.");
+        void EventBus::setCoalesced(api::EventCode code, bool coalesced) {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (coalesced) {
+                _coalescedCodes.insert(static_cast<int32_t>(code));
+            } else {
+                _coalescedCodes.erase(static_cast<int32_t>(code));
+            }
         }
-        if (event->isSticky()) {
-            local_self->_stickies[event->getStickyTag()] = event;
+
+        void EventBus::setLogger(const std::shared_ptr<spdlog::logger> &logger) {
+            std::atomic_store(&_logger, logger);
         }
-        for (auto& subscriber : local_self->_subscribers) {
-            auto& c = std::get<0>(subscriber);
-            auto& r = std::get<1>(subscriber);
 
-            std::weak_ptr<ledger::core::api::EventReceiver> weak_receiver(r);
+        void EventBus::post(const std::shared_ptr<Event> &event) {
+            std::shared_ptr<const SubscribersList> subscribers;
+            bool coalesced;
+            {
+                // Stickies are stored and read under the same lock as subscribe, a concurrent subscriber either
+                // gets the event from the stickies or from the list below, never twice
+                std::lock_guard<std::mutex> guard(_lock);
+                if (event->isSticky()) {
+                    _stickies[event->getStickyTag()] = event;
+                }
+                coalesced = _coalescedCodes.find(static_cast<int32_t>(event->getCode())) != _coalescedCodes.end();
+                subscribers = std::atomic_load(&_subscribers);
+            }
+            for (auto& subscriber : *subscribers) {
+                enqueue(subscriber, event, coalesced);
+            }
+        }
 
-            Future<Unit>::async(c, [=] () {
-                auto local_receiver = weak_receiver.lock();
-                if (!local_receiver) {
-                    throw make_exception(api::ErrorCode::NULL_POINTER, "Receiver was released.");
+        void EventBus::enqueue(const std::shared_ptr<Subscriber> &subscriber, const std::shared_ptr<Event> &event, bool coalesced) {
+            {
+                std::lock_guard<std::mutex> guard(subscriber->lock);
+                auto code = static_cast<int32_t>(event->getCode());
+                auto position = coalesced ? subscriber->coalescedPositions.find(code) : subscriber->coalescedPositions.end();
+                if (position != subscriber->coalescedPositions.end()) {
+                    // The replaced event leaves an empty slot so that the newer one is delivered after the
+                    // events posted in between, as if it had been posted alone
+                    subscriber->pending[position->second] = nullptr;
+                    position->second = subscriber->pending.size();
+                } else if (coalesced) {
+                    subscriber->coalescedPositions[code] = subscriber->pending.size();
+                }
+                subscriber->pending.push_back(event);
+                if (subscriber->scheduled) {
+                    return;
                 }
-                local_receiver->onEvent(event);
-                return unit;
-            });
+                subscriber->scheduled = true;
+            }
+            auto logger = std::atomic_load(&_logger);
+            subscriber->context->execute(make_runnable([subscriber, logger] () {
+                drain(subscriber, logger);
+            }));
         }
-    });
-}
 
-ledger::core::EventBus::EventBus(const std::shared_ptr<ledger::core::api::ExecutionContext> &context)
-    : DedicatedContext(context) {
+        void EventBus::drain(const std::shared_ptr<Subscriber> &subscriber, const std::shared_ptr<spdlog::logger> &logger) {
+            std::vector<std::shared_ptr<Event>> events;
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> guard(subscriber->lock);
+                    if (subscriber->pending.empty()) {
+                        // Only an empty queue lets the next event schedule a new drain, otherwise events
+                        // posted during the delivery below would be delivered by two runnables at once
+                        subscriber->scheduled = false;
+                        return;
+                    }
+                    events.clear();
+                    events.swap(subscriber->pending);
+                    subscriber->coalescedPositions.clear();
+                }
+                for (auto& event : events) {
+                    if (!event) {
+                        continue;
+                    }
+                    // A failing receiver must not prevent the delivery of the rest of the batch
+                    try {
+                        subscriber->receiver->onEvent(event);
+                    } catch (const std::exception& ex) {
+                        if (logger) {
+                            logger->error("Event receiver failed on {}: {}", api::to_string(event->getCode()), ex.what());
+                        }
+                    } catch (...) {
+                        if (logger) {
+                            logger->error("Event receiver failed on {} with an unknown error", api::to_string(event->getCode()));
+                        }
+                    }
+                }
+            }
+        }
 
+    }
 }
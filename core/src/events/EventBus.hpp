@@ -33,29 +33,56 @@
 
 #include "EventPublisher.hpp"
 #include "Event.hpp"
-#include <tuple>
+#include <mutex>
 #include <unordered_map>
-#include <list>
+#include <unordered_set>
+#include <vector>
+#include <spdlog/logger.h>
 
 namespace ledger {
     namespace core {
+        /**
+         * Fans out events to subscribers. Every subscriber has its own queue of pending events which is drained
+         * by a single runnable on the subscriber's context: a burst of events costs one runnable per subscriber,
+         * not one per event. The subscriber list is copy-on-write, posting an event reads it without any hop.
+         */
         class EventBus : public api::EventBus, public DedicatedContext, public std::enable_shared_from_this<EventBus> {
         public:
             void subscribe(const std::shared_ptr<api::ExecutionContext> &context,
                            const std::shared_ptr<api::EventReceiver> &receiver) override;
             void unsubscribe(const std::shared_ptr<api::EventReceiver> &receiver) override;
 
+            /**
+             * Opt-in coalescing for high volume event codes: while an event with this code is waiting in a
+             * subscriber's queue, a newer event with the same code replaces it. The newer event keeps its own
+             * place in the queue, after the events posted before it.
+             */
+            void setCoalesced(api::EventCode code, bool coalesced);
+
+            /**
+             * Logger receiving the failures of receivers, which are otherwise dropped.
+             */
+            void setLogger(const std::shared_ptr<spdlog::logger>& logger);
+
         private:
             explicit EventBus(const std::shared_ptr<api::ExecutionContext>& context);
             friend class EventPublisher;
             void post(const std::shared_ptr<Event>& event);
 
+            struct Subscriber;
+            void enqueue(const std::shared_ptr<Subscriber>& subscriber, const std::shared_ptr<Event>& event, bool coalesced);
+            static void drain(const std::shared_ptr<Subscriber>& subscriber, const std::shared_ptr<spdlog::logger>& logger);
 
         private:
-            using SubscribersList = std::list<std::tuple<std::shared_ptr<api::ExecutionContext>, std::shared_ptr<api::EventReceiver>>>;
-            SubscribersList _subscribers;
+            using SubscribersList = std::vector<std::shared_ptr<Subscriber>>;
+            // Replaced, never modified, once published
+            std::shared_ptr<const SubscribersList> _subscribers;
             using StickiesMap = std::unordered_map<int32_t, std::shared_ptr<Event>>;
             StickiesMap _stickies;
+            std::unordered_set<int32_t> _coalescedCodes;
+            // Guards writers of the subscribers list, the stickies and the coalesced codes
+            std::mutex _lock;
+            std::shared_ptr<spdlog::logger> _logger;
         };
     }
 }
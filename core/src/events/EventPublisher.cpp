@@ -101,6 +101,14 @@ namespace ledger {
             _filter = filter;
         }
 
+        void EventPublisher::setCoalesced(api::EventCode code, bool coalesced) {
+            _bus->setCoalesced(code, coalesced);
+        }
+
+        void EventPublisher::setLogger(const std::shared_ptr<spdlog::logger> &logger) {
+            _bus->setLogger(logger);
+        }
+
         namespace api {
             std::shared_ptr<EventPublisher> EventPublisher::newInstance(const std::shared_ptr<ExecutionContext> &context) {
                 return std::make_shared<ledger::core::EventPublisher>(context);
@@ -39,6 +39,7 @@
 #include <unordered_set>
 #include <memory>
 #include <async/DedicatedContext.hpp>
+#include <spdlog/logger.h>
 
 namespace ledger {
     namespace core {
@@ -52,6 +53,8 @@ namespace ledger {
             void postSticky(const std::shared_ptr<api::Event> &event, int32_t tag) override;
             void relay(const std::shared_ptr<api::EventBus> &bus) override;
             void setFilter(const EventFilter& filter);
+            void setCoalesced(api::EventCode code, bool coalesced);
+            void setLogger(const std::shared_ptr<spdlog::logger>& logger);
 
 
         private:
@@ -29,9 +29,8 @@
  *
  */
 #include "Base58.hpp"
-#include "BigInt.h"
-#include <sstream>
-#include "../collections/vector.hpp"
+#include "Base58Codec.hpp"
+#include <algorithm>
 #include <crypto/HashAlgorithm.h>
 #include <utils/hex.h>
 #include <functional>
@@ -39,19 +38,6 @@
 
 using namespace ledger::core;
 static const std::string DIGITS = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-static const ledger::core::BigInt V_58(58);
-
-static void _encode(const ledger::core::BigInt &v,
-                    std::stringstream &ss,
-                    const std::string &networkIdentifier,
-                    const std::string &networkBase58Dictionary) {
-    if (v == ledger::core::BigInt::ZERO) {
-        return ;
-    }
-    auto r = (v % V_58).toUnsignedInt();
-    _encode(v / V_58, ss, networkIdentifier, networkBase58Dictionary);
-    ss << networkBase58Dictionary[r];
-}
 
 static std::string getNetworkIdentifier(const std::shared_ptr<api::DynamicObject> &config) {
     return config->getString("networkIdentifier").value_or("");
@@ -65,22 +51,31 @@ static bool shouldUseNetworkBase58Dictionary(const std::shared_ptr<api::DynamicO
     return config->getBoolean("useNetworkDictionary").value_or(false);
 }
 
+static std::string encodeWithDictionary(const uint8_t *data, size_t size, const std::string &dictionary) {
+    return Base58Codec::forAlphabet(dictionary).encode(data, size);
+}
+
+static std::vector<uint8_t> decodeWithDictionary(const std::string &str, const std::string &dictionary) {
+    return Base58Codec::forAlphabet(dictionary).decode(str);
+}
+
+static std::string getDecodingDictionary(const std::shared_ptr<api::DynamicObject> &config) {
+    return shouldUseNetworkBase58Dictionary(config) ? getNetworkBase58Dictionary(config) : DIGITS;
+}
+
 std::string ledger::core::Base58::encode(const std::vector<uint8_t> &bytes,
                                          const std::shared_ptr<api::DynamicObject> &config) {
-    BigInt intData(bytes.data(), bytes.size(), false);
-    std::stringstream ss;
-    auto base58Dictionary = getNetworkBase58Dictionary(config);
-    for (auto i = 0; i < bytes.size() && bytes[i] == 0; i++) {
-        ss << base58Dictionary[0];
-    }
-    _encode(intData, ss, getNetworkIdentifier(config), base58Dictionary);
-    return ss.str();
+    return encodeWithDictionary(bytes.data(), bytes.size(), getNetworkBase58Dictionary(config));
 }
 
 std::string ledger::core::Base58::encodeWithChecksum(const std::vector<uint8_t> &bytes,
                                                      const std::shared_ptr<api::DynamicObject> &config) {
-
-    return encode(vector::concat<uint8_t>(bytes, computeChecksum(bytes, getNetworkIdentifier(config))), config);
+    auto checksum = computeChecksum(bytes, getNetworkIdentifier(config));
+    std::vector<uint8_t> payload;
+    payload.reserve(bytes.size() + checksum.size());
+    payload.insert(payload.end(), bytes.begin(), bytes.end());
+    payload.insert(payload.end(), checksum.begin(), checksum.end());
+    return encodeWithDictionary(payload.data(), payload.size(), getNetworkBase58Dictionary(config));
 }
 
 std::string ledger::core::Base58::encodeWithEIP55(const std::vector<uint8_t> &bytes) {
@@ -118,24 +113,7 @@ std::string ledger::core::Base58::encodeWithEIP55(const std::string &address) {
 
 std::vector<uint8_t> ledger::core::Base58::decode(const std::string &str,
                                                   const std::shared_ptr<api::DynamicObject> &config) {
-    BigInt intData(0);
-    std::vector<uint8_t> prefix;
-    auto useBase58Dict = shouldUseNetworkBase58Dictionary(config);
-    auto base58Dictionary = useBase58Dict ? getNetworkBase58Dictionary(config) : DIGITS;
-    for (auto& c : str) {
-        if (c == base58Dictionary[0] && intData == BigInt::ZERO) {
-            prefix.push_back(0);
-        } else {
-            auto digitIndex = base58Dictionary.find(c);
-            if (digitIndex != std::string::npos) {
-                intData = (intData * V_58) + BigInt((unsigned int)digitIndex);
-            } else {
-                throw Exception(api::ErrorCode::INVALID_BASE58_FORMAT, "Invalid base 58 format");
-            }
-        }
-    }
-
-    return vector::concat(prefix, intData.toByteArray());
+    return decodeWithDictionary(str, getDecodingDictionary(config));
 }
 
 std::vector<uint8_t> ledger::core::Base58::computeChecksum(const std::vector<uint8_t> &bytes,
@@ -155,11 +133,10 @@ ledger::core::Try<std::vector<uint8_t>> ledger::core::Base58::checkAndDecode(con
             throw Exception(api::ErrorCode::INVALID_BASE58_FORMAT, "Invalid address : Invalid base 58 format");
         }
         std::vector<uint8_t> data(decoded.begin(), decoded.end() - 4);
-        std::vector<uint8_t> checksum(decoded.end() - 4, decoded.end());
         auto chks = computeChecksum(data, getNetworkIdentifier(config));
-        if (checksum != chks) {
+        if (!std::equal(chks.begin(), chks.end(), decoded.end() - 4)) {
             throw Exception(api::ErrorCode::INVALID_CHECKSUM, "Base 58 invalid checksum");
         }
         return data;
     });
-}
\ No newline at end of file
+}
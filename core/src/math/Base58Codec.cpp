@@ -0,0 +1,159 @@
+/*
+ *
+ * Base58Codec.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "Base58Codec.hpp"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "../utils/Exception.hpp"
+
+namespace ledger {
+    namespace core {
+
+        static const char BITCOIN_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+        Base58Codec::Base58Codec(const std::string& alphabet) : _alphabet(alphabet) {
+            if (_alphabet.size() != 58) {
+                throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Base58 alphabet must contain 58 characters, got {}", _alphabet.size());
+            }
+            _indexes.fill(-1);
+            for (auto i = 0; i < _alphabet.size(); i++) {
+                _indexes[static_cast<uint8_t>(_alphabet[i])] = static_cast<int16_t>(i);
+            }
+        }
+
+        const Base58Codec& Base58Codec::bitcoin() {
+            static const Base58Codec codec(BITCOIN_ALPHABET);
+            return codec;
+        }
+
+        const Base58Codec& Base58Codec::forAlphabet(const std::string& alphabet) {
+            const auto& bitcoinCodec = bitcoin();
+            if (alphabet == bitcoinCodec.getAlphabet()) {
+                return bitcoinCodec;
+            }
+            static std::mutex lock;
+            static std::unordered_map<std::string, std::unique_ptr<Base58Codec>> codecs;
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = codecs.find(alphabet);
+            if (it == codecs.end()) {
+                it = codecs.emplace(alphabet, std::unique_ptr<Base58Codec>(new Base58Codec(alphabet))).first;
+            }
+            return *it->second;
+        }
+
+        std::string Base58Codec::encode(const uint8_t* data, size_t size) const {
+            size_t zeroes = 0;
+            while (zeroes < size && data[zeroes] == 0) {
+                zeroes += 1;
+            }
+            // log(256) / log(58), rounded up
+            const size_t capacity = (size - zeroes) * 138 / 100 + 1;
+            uint8_t stackBuffer[STACK_BUFFER_SIZE];
+            std::vector<uint8_t> heapBuffer;
+            uint8_t* digits = stackBuffer;
+            if (capacity > STACK_BUFFER_SIZE) {
+                heapBuffer.resize(capacity);
+                digits = heapBuffer.data();
+            }
+            std::fill(digits, digits + capacity, 0);
+
+            size_t length = 0;
+            for (auto offset = zeroes; offset < size; offset++) {
+                uint32_t carry = data[offset];
+                size_t i = 0;
+                for (auto it = capacity; (carry != 0 || i < length) && it > 0; --it, ++i) {
+                    carry += 256 * static_cast<uint32_t>(digits[it - 1]);
+                    digits[it - 1] = static_cast<uint8_t>(carry % 58);
+                    carry /= 58;
+                }
+                length = i;
+            }
+
+            auto start = capacity - length;
+            while (start < capacity && digits[start] == 0) {
+                start += 1;
+            }
+            std::string result(zeroes + (capacity - start), _alphabet[0]);
+            for (auto i = start; i < capacity; i++) {
+                result[zeroes + i - start] = _alphabet[digits[i]];
+            }
+            return result;
+        }
+
+        std::vector<uint8_t> Base58Codec::decode(const std::string& str) const {
+            size_t zeroes = 0;
+            while (zeroes < str.size() && str[zeroes] == _alphabet[0]) {
+                zeroes += 1;
+            }
+            // log(58) / log(256), rounded up
+            const size_t capacity = (str.size() - zeroes) * 733 / 1000 + 1;
+            uint8_t stackBuffer[STACK_BUFFER_SIZE];
+            std::vector<uint8_t> heapBuffer;
+            uint8_t* bytes = stackBuffer;
+            if (capacity > STACK_BUFFER_SIZE) {
+                heapBuffer.resize(capacity);
+                bytes = heapBuffer.data();
+            }
+            std::fill(bytes, bytes + capacity, 0);
+
+            size_t length = 0;
+            for (auto offset = zeroes; offset < str.size(); offset++) {
+                auto digit = _indexes[static_cast<uint8_t>(str[offset])];
+                if (digit < 0) {
+                    throw Exception(api::ErrorCode::INVALID_BASE58_FORMAT, "Invalid base 58 format");
+                }
+                uint32_t carry = static_cast<uint32_t>(digit);
+                size_t i = 0;
+                for (auto it = capacity; (carry != 0 || i < length) && it > 0; --it, ++i) {
+                    carry += 58 * static_cast<uint32_t>(bytes[it - 1]);
+                    bytes[it - 1] = static_cast<uint8_t>(carry % 256);
+                    carry /= 256;
+                }
+                length = i;
+            }
+
+            auto start = capacity - length;
+            while (start < capacity && bytes[start] == 0) {
+                start += 1;
+            }
+            std::vector<uint8_t> result(zeroes, 0);
+            if (start == capacity) {
+                // A null value is serialized as a single zero byte, as the former BigInt based decoding did
+                result.push_back(0);
+            } else {
+                result.insert(result.end(), bytes + start, bytes + capacity);
+            }
+            return result;
+        }
+
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ *
+ * Base58Codec.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_BASE58CODEC_HPP
+#define LEDGER_CORE_BASE58CODEC_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+        /**
+         * Base58 encoder/decoder working on raw bytes with a precomputed alphabet. Conversions are done
+         * in place in a stack buffer for common payload sizes (addresses, extended keys) and only fall
+         * back to the heap for larger inputs.
+         */
+        class Base58Codec {
+        public:
+            explicit Base58Codec(const std::string& alphabet);
+
+            std::string encode(const uint8_t* data, size_t size) const;
+            std::string encode(const std::vector<uint8_t>& bytes) const {
+                return encode(bytes.data(), bytes.size());
+            }
+
+            /**
+             * Decodes the given string, throws INVALID_BASE58_FORMAT on characters outside of the alphabet.
+             */
+            std::vector<uint8_t> decode(const std::string& str) const;
+
+            const std::string& getAlphabet() const {
+                return _alphabet;
+            }
+
+            /**
+             * Codec for the default Bitcoin alphabet.
+             */
+            static const Base58Codec& bitcoin();
+
+            /**
+             * Interned codec for the given alphabet, built on first use and shared afterwards.
+             */
+            static const Base58Codec& forAlphabet(const std::string& alphabet);
+
+        private:
+            // Large enough to convert an 82 bytes extended key without touching the heap
+            static const size_t STACK_BUFFER_SIZE = 128;
+
+            std::string _alphabet;
+            std::array<int16_t, 256> _indexes;
+        };
+    }
+}
+
+#endif //LEDGER_CORE_BASE58CODEC_HPP
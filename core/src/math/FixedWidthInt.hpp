@@ -0,0 +1,470 @@
+/*
+ *
+ * FixedWidthInt.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_FIXEDWIDTHINT_HPP
+#define LEDGER_CORE_FIXEDWIDTHINT_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "BigInt.h"
+#include "../utils/Exception.hpp"
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Stack allocated unsigned integer of a fixed bit width. Unlike BigInt no operation touches the heap
+         * (except string conversions), which makes it suitable for sums over amounts on hot paths. Every
+         * arithmetic operation is checked and throws OUT_OF_RANGE instead of silently wrapping.
+         * @headerfile FixedWidthInt.hpp <ledger/core/math/FixedWidthInt.hpp>
+         */
+        template <size_t Bits>
+        class FixedUnsignedInt {
+            static_assert(Bits >= 64 && Bits % 64 == 0, "Bit width must be a multiple of 64");
+        public:
+            static constexpr size_t LIMBS = Bits / 64;
+
+            FixedUnsignedInt() : _limbs() {}
+            explicit FixedUnsignedInt(uint64_t value) : _limbs() {
+                _limbs[0] = value;
+            }
+
+            /**
+             * Parses an unsigned decimal string (e.g. "125").
+             */
+            static FixedUnsignedInt fromDecimal(const char* str, size_t length) {
+                if (length == 0) {
+                    throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Empty decimal string");
+                }
+                FixedUnsignedInt result;
+                for (size_t i = 0; i < length; i++) {
+                    auto digit = static_cast<uint32_t>(str[i] - '0');
+                    if (digit > 9) {
+                        throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Non-numeric base 10 integer");
+                    }
+                    result.multiplyAdd(10, digit);
+                }
+                return result;
+            }
+
+            static FixedUnsignedInt fromDecimal(const std::string& str) {
+                return fromDecimal(str.data(), str.size());
+            }
+
+            /**
+             * Parses an hexadecimal string, with or without the "0x" prefix (e.g. "E0A1B3").
+             */
+            static FixedUnsignedInt fromHex(const std::string& str) {
+                size_t offset = (str.size() >= 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) ? 2 : 0;
+                if (str.size() == offset) {
+                    throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Empty hexadecimal string");
+                }
+                FixedUnsignedInt result;
+                for (size_t i = offset; i < str.size(); i++) {
+                    auto c = str[i];
+                    uint32_t nibble;
+                    if (c >= '0' && c <= '9') {
+                        nibble = static_cast<uint32_t>(c - '0');
+                    } else if (c >= 'a' && c <= 'f') {
+                        nibble = static_cast<uint32_t>(c - 'a' + 10);
+                    } else if (c >= 'A' && c <= 'F') {
+                        nibble = static_cast<uint32_t>(c - 'A' + 10);
+                    } else {
+                        throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Non-hexadecimal integer");
+                    }
+                    result.multiplyAdd(16, nibble);
+                }
+                return result;
+            }
+
+            /**
+             * Converts a non negative BigInt, throws OUT_OF_RANGE if it does not fit.
+             */
+            static FixedUnsignedInt fromBigInt(const BigInt& value) {
+                if (value.isNegative() && !value.isZero()) {
+                    throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Cannot store negative value {} in an unsigned integer", value.toString());
+                }
+                return fromByteArray(value.toByteArray());
+            }
+
+            /**
+             * Initializes from big endian bytes, throws OUT_OF_RANGE if they do not fit.
+             */
+            static FixedUnsignedInt fromByteArray(const std::vector<uint8_t>& bytes) {
+                FixedUnsignedInt result;
+                auto size = bytes.size();
+                for (size_t i = 0; i < size; i++) {
+                    auto byte = bytes[size - 1 - i];
+                    if (byte == 0) {
+                        continue;
+                    }
+                    if (i >= LIMBS * 8) {
+                        throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Value does not fit in {} bits", Bits);
+                    }
+                    result._limbs[i / 8] |= static_cast<uint64_t>(byte) << ((i % 8) * 8);
+                }
+                return result;
+            }
+
+            std::vector<uint8_t> toByteArray() const {
+                std::vector<uint8_t> bytes(LIMBS * 8);
+                for (size_t i = 0; i < LIMBS * 8; i++) {
+                    bytes[LIMBS * 8 - 1 - i] = static_cast<uint8_t>(_limbs[i / 8] >> ((i % 8) * 8));
+                }
+                return bytes;
+            }
+
+            BigInt toBigInt() const {
+                auto bytes = toByteArray();
+                return BigInt(bytes.data(), bytes.size(), false);
+            }
+
+            std::string toString() const {
+                if (isZero()) {
+                    return "0";
+                }
+                // Extract 9 digits at a time so that each chunk division fits in 64 bits
+                static const uint32_t CHUNK = 1000000000U;
+                std::string result;
+                FixedUnsignedInt value = *this;
+                while (!value.isZero()) {
+                    auto chunk = value.divideBy(CHUNK);
+                    for (auto i = 0; i < 9; i++) {
+                        result.push_back(static_cast<char>('0' + chunk % 10));
+                        chunk /= 10;
+                        if (value.isZero() && chunk == 0) {
+                            break;
+                        }
+                    }
+                }
+                return std::string(result.rbegin(), result.rend());
+            }
+
+            std::string toHexString() const {
+                static const char* DIGITS = "0123456789abcdef";
+                std::string result;
+                bool leading = true;
+                for (size_t i = LIMBS * 16; i-- > 0;) {
+                    auto nibble = (_limbs[i / 16] >> ((i % 16) * 4)) & 0xF;
+                    if (leading && nibble == 0) {
+                        continue;
+                    }
+                    leading = false;
+                    result.push_back(DIGITS[nibble]);
+                }
+                return result.empty() ? "0" : result;
+            }
+
+            uint64_t toUint64() const {
+                for (size_t i = 1; i < LIMBS; i++) {
+                    if (_limbs[i] != 0) {
+                        throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Value {} does not fit in 64 bits", toString());
+                    }
+                }
+                return _limbs[0];
+            }
+
+            bool isZero() const {
+                for (auto limb : _limbs) {
+                    if (limb != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            unsigned getBitSize() const {
+                for (size_t i = LIMBS; i-- > 0;) {
+                    if (_limbs[i] != 0) {
+                        unsigned bits = 64;
+                        while ((_limbs[i] >> (bits - 1)) == 0) {
+                            bits -= 1;
+                        }
+                        return static_cast<unsigned>(i * 64) + bits;
+                    }
+                }
+                return 0;
+            }
+
+            int compare(const FixedUnsignedInt& rhs) const {
+                for (size_t i = LIMBS; i-- > 0;) {
+                    if (_limbs[i] != rhs._limbs[i]) {
+                        return _limbs[i] < rhs._limbs[i] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            FixedUnsignedInt& operator+=(const FixedUnsignedInt& rhs) {
+                uint64_t carry = 0;
+                for (size_t i = 0; i < LIMBS; i++) {
+                    auto sum = _limbs[i] + rhs._limbs[i];
+                    auto overflow = sum < _limbs[i];
+                    _limbs[i] = sum + carry;
+                    carry = (overflow || _limbs[i] < sum) ? 1 : 0;
+                }
+                if (carry) {
+                    throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Addition overflows {} bits", Bits);
+                }
+                return *this;
+            }
+
+            FixedUnsignedInt& operator-=(const FixedUnsignedInt& rhs) {
+                if (compare(rhs) < 0) {
+                    throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Subtraction underflows unsigned integer");
+                }
+                uint64_t borrow = 0;
+                for (size_t i = 0; i < LIMBS; i++) {
+                    auto diff = _limbs[i] - rhs._limbs[i];
+                    auto underflow = _limbs[i] < rhs._limbs[i];
+                    _limbs[i] = diff - borrow;
+                    borrow = (underflow || diff < borrow) ? 1 : 0;
+                }
+                return *this;
+            }
+
+            FixedUnsignedInt& operator*=(const FixedUnsignedInt& rhs) {
+                FixedUnsignedInt result;
+                for (size_t i = 0; i < LIMBS; i++) {
+                    if (_limbs[i] == 0) {
+                        continue;
+                    }
+                    uint64_t carry = 0;
+                    for (size_t j = 0; j < LIMBS; j++) {
+                        if (i + j >= LIMBS) {
+                            if (rhs._limbs[j] != 0) {
+                                throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Multiplication overflows {} bits", Bits);
+                            }
+                            continue;
+                        }
+                        uint64_t high, low;
+                        multiply64(_limbs[i], rhs._limbs[j], high, low);
+                        low += carry;
+                        high += low < carry ? 1 : 0;
+                        result._limbs[i + j] += low;
+                        high += result._limbs[i + j] < low ? 1 : 0;
+                        carry = high;
+                    }
+                    if (carry != 0) {
+                        throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Multiplication overflows {} bits", Bits);
+                    }
+                }
+                *this = result;
+                return *this;
+            }
+
+            FixedUnsignedInt operator+(const FixedUnsignedInt& rhs) const {
+                FixedUnsignedInt result = *this;
+                return result += rhs;
+            }
+
+            FixedUnsignedInt operator-(const FixedUnsignedInt& rhs) const {
+                FixedUnsignedInt result = *this;
+                return result -= rhs;
+            }
+
+            FixedUnsignedInt operator*(const FixedUnsignedInt& rhs) const {
+                FixedUnsignedInt result = *this;
+                return result *= rhs;
+            }
+
+            bool operator==(const FixedUnsignedInt& rhs) const { return _limbs == rhs._limbs; }
+            bool operator!=(const FixedUnsignedInt& rhs) const { return _limbs != rhs._limbs; }
+            bool operator<(const FixedUnsignedInt& rhs) const { return compare(rhs) < 0; }
+            bool operator<=(const FixedUnsignedInt& rhs) const { return compare(rhs) <= 0; }
+            bool operator>(const FixedUnsignedInt& rhs) const { return compare(rhs) > 0; }
+            bool operator>=(const FixedUnsignedInt& rhs) const { return compare(rhs) >= 0; }
+
+            /**
+             * Divides in place by a 32 bits divisor and returns the remainder.
+             */
+            uint32_t divideBy(uint32_t divisor) {
+                if (divisor == 0) {
+                    throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "Division by zero");
+                }
+                uint64_t remainder = 0;
+                for (size_t i = LIMBS; i-- > 0;) {
+                    auto high = (remainder << 32) | (_limbs[i] >> 32);
+                    auto highQuotient = high / divisor;
+                    remainder = high % divisor;
+                    auto low = (remainder << 32) | (_limbs[i] & 0xFFFFFFFFULL);
+                    auto lowQuotient = low / divisor;
+                    remainder = low % divisor;
+                    _limbs[i] = (highQuotient << 32) | lowQuotient;
+                }
+                return static_cast<uint32_t>(remainder);
+            }
+
+        private:
+            // this = this * multiplier + addend
+            void multiplyAdd(uint32_t multiplier, uint32_t addend) {
+                uint64_t carry = addend;
+                for (size_t i = 0; i < LIMBS; i++) {
+                    uint64_t high, low;
+                    multiply64(_limbs[i], multiplier, high, low);
+                    low += carry;
+                    high += low < carry ? 1 : 0;
+                    _limbs[i] = low;
+                    carry = high;
+                }
+                if (carry != 0) {
+                    throw make_exception(api::ErrorCode::OUT_OF_RANGE, "Value does not fit in {} bits", Bits);
+                }
+            }
+
+            // Portable 64x64 -> 128 bits multiplication
+            static void multiply64(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) {
+                uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+                uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+                auto ll = aLow * bLow;
+                auto lh = aLow * bHigh;
+                auto hl = aHigh * bLow;
+                auto hh = aHigh * bHigh;
+                auto middle = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+                low = (middle << 32) | (ll & 0xFFFFFFFFULL);
+                high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+            }
+
+            std::array<uint64_t, LIMBS> _limbs;
+        };
+
+        /**
+         * Signed counterpart of FixedUnsignedInt, stored as sign and magnitude like BigInt.
+         * @headerfile FixedWidthInt.hpp <ledger/core/math/FixedWidthInt.hpp>
+         */
+        template <size_t Bits>
+        class FixedSignedInt {
+        public:
+            using Magnitude = FixedUnsignedInt<Bits>;
+
+            FixedSignedInt() : _magnitude(), _negative(false) {}
+            explicit FixedSignedInt(int64_t value) :
+                _magnitude(value < 0 ? static_cast<uint64_t>(-(value + 1)) + 1 : static_cast<uint64_t>(value)),
+                _negative(value < 0) {}
+            FixedSignedInt(const Magnitude& magnitude, bool negative = false) :
+                _magnitude(magnitude), _negative(negative && !magnitude.isZero()) {}
+
+            /**
+             * Parses a decimal string with an optional leading minus sign (e.g. "-125").
+             */
+            static FixedSignedInt fromDecimal(const std::string& str) {
+                auto negative = !str.empty() && str[0] == '-';
+                auto offset = negative ? 1 : 0;
+                return FixedSignedInt(Magnitude::fromDecimal(str.data() + offset, str.size() - offset), negative);
+            }
+
+            static FixedSignedInt fromBigInt(const BigInt& value) {
+                return FixedSignedInt(Magnitude::fromByteArray(value.toByteArray()), value.isNegative());
+            }
+
+            BigInt toBigInt() const {
+                auto bytes = _magnitude.toByteArray();
+                return BigInt(bytes.data(), bytes.size(), _negative);
+            }
+
+            std::string toString() const {
+                return _negative ? "-" + _magnitude.toString() : _magnitude.toString();
+            }
+
+            const Magnitude& magnitude() const {
+                return _magnitude;
+            }
+
+            bool isNegative() const {
+                return _negative;
+            }
+
+            bool isZero() const {
+                return _magnitude.isZero();
+            }
+
+            FixedSignedInt negative() const {
+                return FixedSignedInt(_magnitude, !_negative);
+            }
+
+            int compare(const FixedSignedInt& rhs) const {
+                if (_negative != rhs._negative) {
+                    return _negative ? -1 : 1;
+                }
+                auto cmp = _magnitude.compare(rhs._magnitude);
+                return _negative ? -cmp : cmp;
+            }
+
+            FixedSignedInt& operator+=(const FixedSignedInt& rhs) {
+                if (_negative == rhs._negative) {
+                    _magnitude += rhs._magnitude;
+                } else if (_magnitude >= rhs._magnitude) {
+                    _magnitude -= rhs._magnitude;
+                } else {
+                    _magnitude = rhs._magnitude - _magnitude;
+                    _negative = rhs._negative;
+                }
+                if (_magnitude.isZero()) {
+                    _negative = false;
+                }
+                return *this;
+            }
+
+            FixedSignedInt& operator-=(const FixedSignedInt& rhs) {
+                return *this += rhs.negative();
+            }
+
+            FixedSignedInt operator+(const FixedSignedInt& rhs) const {
+                FixedSignedInt result = *this;
+                return result += rhs;
+            }
+
+            FixedSignedInt operator-(const FixedSignedInt& rhs) const {
+                FixedSignedInt result = *this;
+                return result -= rhs;
+            }
+
+            bool operator==(const FixedSignedInt& rhs) const { return compare(rhs) == 0; }
+            bool operator!=(const FixedSignedInt& rhs) const { return compare(rhs) != 0; }
+            bool operator<(const FixedSignedInt& rhs) const { return compare(rhs) < 0; }
+            bool operator<=(const FixedSignedInt& rhs) const { return compare(rhs) <= 0; }
+            bool operator>(const FixedSignedInt& rhs) const { return compare(rhs) > 0; }
+            bool operator>=(const FixedSignedInt& rhs) const { return compare(rhs) >= 0; }
+
+        private:
+            Magnitude _magnitude;
+            bool _negative;
+        };
+
+        using UInt128 = FixedUnsignedInt<128>;
+        using UInt256 = FixedUnsignedInt<256>;
+        using Int128 = FixedSignedInt<128>;
+        using Int256 = FixedSignedInt<256>;
+    }
+}
+
+#endif //LEDGER_CORE_FIXEDWIDTHINT_HPP
@@ -30,7 +30,6 @@
 
 
 #include "Bech32.h"
-#include <collections/vector.hpp>
 namespace ledger {
     namespace core {
 
@@ -49,38 +48,53 @@ namespace ledger {
                 1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1
         };
 
+        // Checksums are at most 8 symbols long (cash addresses)
+        static const size_t MAX_CHECKSUM_SIZE = 8;
+        static const uint8_t ZEROES[MAX_CHECKSUM_SIZE] = {0};
+
+        void Bech32::initializeHrpPolymod() {
+            auto expanded = expandHrp(_bech32Params.hrp);
+            _hrpPolymod = polymod(1, expanded.data(), expanded.size());
+        }
+
         // Verify a checksum.
-        bool Bech32::verifyChecksum(const std::vector<uint8_t>& values) const {
-            return polymod(vector::concat(expandHrp(_bech32Params.hrp), values)) == 1;
+        bool Bech32::verifyChecksum(const uint8_t* values, size_t size) const {
+            return polymod(_hrpPolymod, values, size) == 1;
         }
 
         // Create a checksum.
-        std::vector<uint8_t> Bech32::createChecksum(const std::vector<uint8_t>& values) const {
-            std::vector<uint8_t> enc = vector::concat(expandHrp(_bech32Params.hrp), values);
-            enc.resize(enc.size() + _bech32Params.checksumSize);
-            uint64_t mod = polymod(enc) ^ 1;
-            std::vector<uint8_t> ret;
-            ret.resize(_bech32Params.checksumSize);
+        void Bech32::createChecksum(const uint8_t* values, size_t size, uint8_t* out) const {
+            auto checksumSize = _bech32Params.checksumSize;
+            uint64_t mod = polymod(polymod(_hrpPolymod, values, size), ZEROES, checksumSize) ^ 1;
             // Can't use ssize_t because it's posix specific (problem with MSVC build) so let's
             // just use int ...
-            for (int i = _bech32Params.checksumSize - 1; i >= 0; --i) {
-                ret[i] = mod & 31;
+            for (int i = checksumSize - 1; i >= 0; --i) {
+                out[i] = mod & 31;
                 mod >>= 5;
             }
+        }
+
+        std::vector<uint8_t> Bech32::createChecksum(const std::vector<uint8_t>& values) const {
+            std::vector<uint8_t> ret(_bech32Params.checksumSize);
+            createChecksum(values.data(), values.size(), ret.data());
             return ret;
         }
-        
+
         std::string Bech32::encodeBech32(const std::vector<uint8_t>& values) const {
             // Values here should be concatenation of version (base256) + hash (base32)
-            std::vector<uint8_t> checksum = createChecksum(values);
-            std::vector<uint8_t> combined = vector::concat(values, checksum);
-            std::string ret = _bech32Params.hrp + _bech32Params.separator;
-            ret.reserve(ret.size() + combined.size());
-            for (size_t i = 0; i < combined.size(); ++i) {
-                // There is not check on size here because this method is called
-                // after calling Bech32::convertBits which basically guarantees
-                // combined[i] being in range
-                ret += charset[combined[i]];
+            uint8_t checksum[MAX_CHECKSUM_SIZE];
+            createChecksum(values.data(), values.size(), checksum);
+            std::string ret;
+            ret.reserve(_bech32Params.hrp.size() + _bech32Params.separator.size() + values.size() + _bech32Params.checksumSize);
+            ret.append(_bech32Params.hrp).append(_bech32Params.separator);
+            // There is not check on size here because this method is called
+            // after calling Bech32::convertBits which basically guarantees
+            // values[i] being in range
+            for (auto value : values) {
+                ret += charset[value];
+            }
+            for (size_t i = 0; i < _bech32Params.checksumSize; ++i) {
+                ret += charset[checksum[i]];
             }
             return ret;
         }
@@ -105,14 +119,13 @@ namespace ledger {
                     if (charsetRev[c] == -1) ok = false;
                     values[i] = charsetRev[c];
                 }
-                if (ok) {
-                    std::string hrp;
+                if (ok && verifyChecksum(values.data(), values.size())) {
+                    std::string hrp(pos, '\0');
                     for (size_t i = 0; i < pos; ++i) {
-                        hrp += toLowerCase(str[i]);
-                    }
-                    if (verifyChecksum(values)) {
-                        return std::make_pair(hrp, std::vector<uint8_t>(values.begin(), values.end() - _bech32Params.checksumSize));
+                        hrp[i] = toLowerCase(str[i]);
                     }
+                    values.resize(values.size() - _bech32Params.checksumSize);
+                    return std::make_pair(std::move(hrp), std::move(values));
                 }
             }
             return std::make_pair(std::string(), std::vector<uint8_t>());
@@ -124,7 +137,8 @@ namespace ledger {
         }
 
         // Convert from one power-of-2 number base to another. */
-        bool Bech32::convertBits(const std::vector<uint8_t>& in,
+        bool Bech32::convertBits(const uint8_t* in,
+                                 size_t size,
                                  int fromBits,
                                  int toBits,
                                  bool pad,
@@ -133,7 +147,8 @@ namespace ledger {
             int bits = 0;
             const int maxv = (1 << toBits) - 1;
             const int max_acc = (1 << (fromBits + toBits - 1)) - 1;
-            for (size_t i = 0; i < in.size(); ++i) {
+            out.reserve(out.size() + (size * fromBits + toBits - 1) / toBits);
+            for (size_t i = 0; i < size; ++i) {
                 int value = in[i];
                 acc = ((acc << fromBits) | value) & max_acc;
                 bits += fromBits;
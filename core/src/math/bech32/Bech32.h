@@ -45,16 +45,27 @@ namespace ledger {
     namespace core {
         class Bech32 {
         public:
-            Bech32(Bech32Parameters::Bech32Struct bech32Params) : _bech32Params(bech32Params) {}
+            Bech32(Bech32Parameters::Bech32Struct bech32Params) : _bech32Params(bech32Params), _hrpPolymod(1) {}
+            virtual ~Bech32() = default;
+
             // Find the polynomial with value coefficients mod the generator as 64-bit.
-            virtual uint64_t polymod(const std::vector<uint8_t>& values) const = 0;
+            uint64_t polymod(const std::vector<uint8_t>& values) const {
+                return polymod(1, values.data(), values.size());
+            }
+            // Same as above, resuming from the state chk of a previous call.
+            virtual uint64_t polymod(uint64_t chk, const uint8_t* values, size_t size) const = 0;
 
             // Expand a HRP for use in checksum computation.
             virtual std::vector<uint8_t> expandHrp(const std::string& hrp) const = 0;
 
-            bool verifyChecksum(const std::vector<uint8_t>& values) const;
+            bool verifyChecksum(const std::vector<uint8_t>& values) const {
+                return verifyChecksum(values.data(), values.size());
+            }
+            bool verifyChecksum(const uint8_t* values, size_t size) const;
 
             std::vector<uint8_t> createChecksum(const std::vector<uint8_t>& values) const;
+            // Writes the checksumSize symbols of the checksum to out
+            void createChecksum(const uint8_t* values, size_t size, uint8_t* out) const;
 
             virtual std::string encode(const std::vector<uint8_t>& hash,
                                        const std::vector<uint8_t>& version) const = 0;
@@ -70,18 +81,30 @@ namespace ledger {
             static unsigned char toLowerCase(unsigned char c);
 
             static bool convertBits(const std::vector<uint8_t>& in,
+                                    int fromBits,
+                                    int toBits,
+                                    bool pad,
+                                    std::vector<uint8_t>& out) {
+                return convertBits(in.data(), in.size(), fromBits, toBits, pad, out);
+            }
+            static bool convertBits(const uint8_t* in,
+                                    size_t size,
                                     int fromBits,
                                     int toBits,
                                     bool pad,
                                     std::vector<uint8_t>& out);
 
-            Bech32Parameters::Bech32Struct getBech32Params() const {
+            const Bech32Parameters::Bech32Struct& getBech32Params() const {
                 return _bech32Params;
             }
 
         protected:
             std::string encodeBech32(const std::vector<uint8_t>& values) const;
+            // To be called by implementations once polymod and expandHrp are usable
+            void initializeHrpPolymod();
             Bech32Parameters::Bech32Struct _bech32Params;
+            // Polymod state after the expanded HRP, the HRP of an instance never changes
+            uint64_t _hrpPolymod;
         };
     }
 }
@@ -34,6 +34,8 @@
 #include <cosmos/bech32/CosmosBech32.hpp>
 #include <api/CosmosBech32Type.hpp>
 #include <utils/Exception.hpp>
+#include <algorithm>
+#include <unordered_map>
 namespace ledger {
     namespace core {
         Option<std::shared_ptr<Bech32>> Bech32Factory::newBech32Instance(const std::string &networkIdentifier) {
@@ -65,5 +67,25 @@ namespace ledger {
             }
             return Option<std::shared_ptr<Bech32>>();
         }
+
+        Option<std::shared_ptr<Bech32>> Bech32Factory::getBech32Instance(const std::string &networkIdentifier) {
+            // Built on first use, thread safe and read only afterwards
+            static const std::unordered_map<std::string, std::shared_ptr<Bech32>> INSTANCES = [] () {
+                std::unordered_map<std::string, std::shared_ptr<Bech32>> instances;
+                for (auto& identifier : {"btc", "btc_testnet", "dgb", "ltc", "abc"}) {
+                    instances.emplace(identifier, newBech32Instance(identifier).getValue());
+                }
+                for (auto type : {api::CosmosBech32Type::ADDRESS, api::CosmosBech32Type::ADDRESS_VAL,
+                                  api::CosmosBech32Type::PUBLIC_KEY, api::CosmosBech32Type::PUBLIC_KEY_VAL}) {
+                    instances.emplace(api::to_string(type), CosmosBech32::forType(type));
+                }
+                return instances;
+            }();
+            auto it = INSTANCES.find(networkIdentifier);
+            if (it == INSTANCES.end()) {
+                return Option<std::shared_ptr<Bech32>>();
+            }
+            return Option<std::shared_ptr<Bech32>>(it->second);
+        }
     }
 }
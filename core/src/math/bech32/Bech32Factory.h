@@ -41,6 +41,8 @@ namespace ledger {
         class Bech32Factory {
         public:
             static Option<std::shared_ptr<Bech32>> newBech32Instance(const std::string &networkIdentifier);
+            // Codecs are immutable: this returns an instance shared by all callers, built once per network
+            static Option<std::shared_ptr<Bech32>> getBech32Instance(const std::string &networkIdentifier);
         };
     }
 }
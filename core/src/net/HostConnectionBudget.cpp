@@ -0,0 +1,100 @@
+/*
+ *
+ * HostConnectionBudget
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "HostConnectionBudget.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+namespace ledger {
+    namespace core {
+
+        const size_t HostConnectionBudget::DEFAULT_MAX_CONCURRENT_REQUESTS;
+
+        HostConnectionBudget::HostConnectionBudget(size_t maxConcurrentRequests)
+            : _maxConcurrentRequests(std::max<size_t>(1, maxConcurrentRequests)), _inFlight(0) {
+
+        }
+
+        bool HostConnectionBudget::acquire(const std::function<void ()> &start) {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (_inFlight < _maxConcurrentRequests) {
+                _inFlight += 1;
+                return true;
+            }
+            _pending.push_back(start);
+            return false;
+        }
+
+        void HostConnectionBudget::release() {
+            std::function<void ()> next;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (_pending.empty()) {
+                    _inFlight -= 1;
+                    return;
+                }
+                // The slot is handed over to the oldest waiting request
+                next = std::move(_pending.front());
+                _pending.pop_front();
+            }
+            next();
+        }
+
+        size_t HostConnectionBudget::getMaxConcurrentRequests() const {
+            return _maxConcurrentRequests;
+        }
+
+        size_t HostConnectionBudget::getInFlightRequests() const {
+            std::lock_guard<std::mutex> lock(_lock);
+            return _inFlight;
+        }
+
+        std::string HostConnectionBudget::getHost(const std::string &url) {
+            auto authority = url.find("://");
+            authority = authority == std::string::npos ? 0 : authority + 3;
+            auto end = url.find('/', authority);
+            return end == std::string::npos ? url : url.substr(0, end);
+        }
+
+        std::shared_ptr<HostConnectionBudget> HostConnectionBudget::forUrl(const std::string &url,
+                                                                           size_t maxConcurrentRequests) {
+            static std::mutex lock;
+            static std::unordered_map<std::string, std::weak_ptr<HostConnectionBudget>> budgets;
+            auto host = getHost(url);
+            std::lock_guard<std::mutex> guard(lock);
+            auto budget = budgets[host].lock();
+            if (!budget) {
+                budget = std::make_shared<HostConnectionBudget>(maxConcurrentRequests);
+                budgets[host] = budget;
+            }
+            return budget;
+        }
+    }
+}
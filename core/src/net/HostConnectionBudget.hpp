@@ -0,0 +1,104 @@
+/*
+ *
+ * HostConnectionBudget
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_HOSTCONNECTIONBUDGET_HPP
+#define LEDGER_CORE_HOSTCONNECTIONBUDGET_HPP
+
+#include "../api/ExecutionContext.hpp"
+#include "../async/Future.hpp"
+#include "../async/Promise.hpp"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ledger {
+    namespace core {
+
+        /*
+         * Bounds the number of requests in flight to one host, whatever the number of accounts
+         * synchronizing against it. Requests above the budget wait in FIFO order for a slot.
+         * Only leaf requests should go through a budget: a task holding a slot while waiting
+         * for another budgeted request of the same host could starve it.
+         */
+        class HostConnectionBudget : public std::enable_shared_from_this<HostConnectionBudget> {
+        public:
+            static const size_t DEFAULT_MAX_CONCURRENT_REQUESTS = 8;
+
+            explicit HostConnectionBudget(size_t maxConcurrentRequests);
+
+            template <typename T>
+            Future<T> run(const std::shared_ptr<api::ExecutionContext> &context,
+                          const std::function<Future<T> ()> &task) {
+                Promise<T> promise;
+                auto future = promise.getFuture();
+                auto self = shared_from_this();
+                std::function<void ()> start = [self, context, task, promise] () mutable {
+                    auto launched = Try<Future<T>>::from(task);
+                    if (launched.isFailure()) {
+                        self->release();
+                        promise.failure(launched.getFailure());
+                        return;
+                    }
+                    Future<T> pending = launched.getValue();
+                    pending.onComplete(context, [self, promise] (const Try<T> &result) mutable {
+                        self->release();
+                        promise.complete(result);
+                    });
+                };
+                if (acquire(start)) {
+                    start();
+                }
+                return future;
+            }
+
+            size_t getMaxConcurrentRequests() const;
+            size_t getInFlightRequests() const;
+
+            // Budget shared by every client of the host of the given URL (scheme and authority)
+            static std::shared_ptr<HostConnectionBudget> forUrl(const std::string &url,
+                                                                size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS);
+            static std::string getHost(const std::string &url);
+
+        private:
+            // Takes a slot, or queues the request and returns false when the budget is exhausted
+            bool acquire(const std::function<void ()> &start);
+            void release();
+
+            mutable std::mutex _lock;
+            const size_t _maxConcurrentRequests;
+            size_t _inFlight;
+            std::deque<std::function<void ()>> _pending;
+        };
+    }
+}
+
+#endif //LEDGER_CORE_HOSTCONNECTIONBUDGET_HPP
@@ -102,7 +102,8 @@ namespace ledger {
                     body,
                     _client,
                     _context,
-                    _logger
+                    _logger,
+                    _cache
             );
         }
 
@@ -110,12 +111,25 @@ namespace ledger {
             _logger = make_option(logger);
         }
 
+        void HttpClient::setResponseCache(const std::shared_ptr<HttpResponseCache> &cache) {
+            _cache = cache;
+        }
+
+        std::shared_ptr<HttpResponseCache> HttpClient::getResponseCache() const {
+            return _cache;
+        }
+
+        const std::string& HttpClient::getBaseUrl() const {
+            return _baseUrl;
+        }
+
         HttpRequest::HttpRequest(api::HttpMethod method, const std::string &url,
                                  const std::unordered_map<std::string, std::string> &headers,
                                  const std::experimental::optional<std::vector<uint8_t >> body,
                                  const std::shared_ptr<api::HttpClient> &client,
                                  const std::shared_ptr<api::ExecutionContext> &context,
-                                 const Option<std::shared_ptr<spdlog::logger>>& logger) {
+                                 const Option<std::shared_ptr<spdlog::logger>>& logger,
+                                 const std::shared_ptr<HttpResponseCache> &cache) {
             _method = method;
             _url = url;
             _headers = headers;
@@ -123,6 +137,13 @@ namespace ledger {
             _client = client;
             _context = context;
             _logger = logger;
+            _cache = cache;
+            _cacheable = false;
+        }
+
+        HttpRequest& HttpRequest::cacheable() {
+            _cacheable = true;
+            return *this;
         }
 
         HttpRequest::ApiRequest::ApiRequest(const std::shared_ptr<const ledger::core::HttpRequest>& self) {
@@ -134,16 +155,28 @@ namespace ledger {
             return std::dynamic_pointer_cast<api::HttpRequest>(request);
         }
 
-        Future<std::shared_ptr<api::HttpUrlConnection>> HttpRequest::operator()() const {
+        Future<std::shared_ptr<api::HttpUrlConnection>> HttpRequest::execute() const {
             auto request = std::dynamic_pointer_cast<ApiRequest>(toApiRequest());
             _client->execute(request);
             _logger.foreach([&] (const std::shared_ptr<spdlog::logger>& logger) {
                 logger->info("{} {}", api::to_string(request->getMethod()), request->getUrl());
             });
+            return request->getFuture();
+        }
+
+        Future<std::shared_ptr<api::HttpUrlConnection>> HttpRequest::operator()() const {
+            auto method = _method;
+            auto url = _url;
+            auto self = std::make_shared<HttpRequest>(*this);
+            auto response = _cache && _method == api::HttpMethod::GET ?
+                            _cache->get(HttpResponseCache::makeKey(_url, _headers), _cacheable, [self] () {
+                                return self->execute();
+                            }) :
+                            execute();
             auto logger = _logger;
-            return  request->getFuture().map<std::shared_ptr<api::HttpUrlConnection>>(_context, [=] (const std::shared_ptr<api::HttpUrlConnection>& connection) {
+            return response.map<std::shared_ptr<api::HttpUrlConnection>>(_context, [=] (const std::shared_ptr<api::HttpUrlConnection>& connection) {
                 logger.foreach([&] (const std::shared_ptr<spdlog::logger>& l) {
-                    l->info("{} {} - {} {}", api::to_string(request->getMethod()), request->getUrl(),  connection->getStatusCode(), connection->getStatusText());
+                    l->info("{} {} - {} {}", api::to_string(method), url,  connection->getStatusCode(), connection->getStatusText());
                 });
                 if (connection->getStatusCode() < 200 || connection->getStatusCode() >= 300) {
                     throw Exception(HttpRequest::getErrorCode(connection->getStatusCode()), connection->getStatusText(),
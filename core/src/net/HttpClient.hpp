@@ -44,6 +44,7 @@
 #include "../async/Promise.hpp"
 #include "../utils/Either.hpp"
 #include "HttpUrlConnectionInputStream.hpp"
+#include "HttpResponseCache.hpp"
 
 #include "../debug/logger.hpp"
 #include "../utils/Option.hpp"
@@ -67,9 +68,13 @@ namespace ledger {
                         const std::experimental::optional<std::vector<uint8_t >> body,
                         const std::shared_ptr<api::HttpClient> &client,
                         const std::shared_ptr<api::ExecutionContext> &context,
-                        const Option<std::shared_ptr<spdlog::logger>>& logger);
+                        const Option<std::shared_ptr<spdlog::logger>>& logger,
+                        const std::shared_ptr<HttpResponseCache> &cache = nullptr);
             Future<std::shared_ptr<api::HttpUrlConnection>> operator()() const;
 
+            // Allow the response of this request to be served from the client cache (idempotent GET only)
+            HttpRequest& cacheable();
+
             template <typename Success, typename Failure, typename Handler>
             Future<Either<Failure, std::shared_ptr<Success>>> json(Handler handler) const {
                 return operator()().recover(_context, [] (const Exception& exception) {
@@ -101,6 +106,10 @@ namespace ledger {
             std::shared_ptr<api::HttpClient> _client;
             std::shared_ptr<api::ExecutionContext> _context;
             Option<std::shared_ptr<spdlog::logger>> _logger;
+            std::shared_ptr<HttpResponseCache> _cache;
+            bool _cacheable;
+
+            Future<std::shared_ptr<api::HttpUrlConnection>> execute() const;
 
             static api::ErrorCode getErrorCode(int32_t statusCode) {
                 return statusCode >= 200 && statusCode < 300 ? api::ErrorCode::FUTURE_WAS_SUCCESSFULL :
@@ -157,6 +166,9 @@ namespace ledger {
             HttpClient& addHeader(const std::string& key, const std::string& value);
             HttpClient& removeHeader(const std::string& key);
             void setLogger(const std::shared_ptr<spdlog::logger>& logger);
+            void setResponseCache(const std::shared_ptr<HttpResponseCache>& cache);
+            std::shared_ptr<HttpResponseCache> getResponseCache() const;
+            const std::string& getBaseUrl() const;
 
         private:
             HttpRequest createRequest(api::HttpMethod method,
@@ -171,6 +183,7 @@ namespace ledger {
             std::shared_ptr<api::ExecutionContext> _context;
             std::unordered_map<std::string, std::string> _headers;
             Option<std::shared_ptr<spdlog::logger>> _logger;
+            std::shared_ptr<HttpResponseCache> _cache;
         };
     }
 }
@@ -0,0 +1,189 @@
+/*
+ *
+ * HttpResponseCache
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "HttpResponseCache.hpp"
+#include "../api/HttpReadBodyResult.hpp"
+#include "../utils/ImmediateExecutionContext.hpp"
+#include <algorithm>
+
+namespace ledger {
+    namespace core {
+
+        HttpResponseCache::HttpResponseCache(const std::chrono::milliseconds &ttl)
+            : _ttl(ttl), _hits(0), _coalesced(0), _misses(0) {
+        }
+
+        Future<std::shared_ptr<api::HttpUrlConnection>> HttpResponseCache::get(const std::string &key,
+                                                                                bool cacheable,
+                                                                                const Fetcher &fetcher) {
+            Promise<std::shared_ptr<const Response>> promise;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (cacheable) {
+                    auto cached = _responses.find(key);
+                    if (cached != _responses.end()) {
+                        if (std::chrono::steady_clock::now() - cached->second.second <= _ttl) {
+                            _hits++;
+                            return Future<std::shared_ptr<api::HttpUrlConnection>>::successful(
+                                    std::make_shared<BufferedUrlConnection>(cached->second.first));
+                        }
+                        _responses.erase(cached);
+                    }
+                }
+                auto pending = _inFlight.find(key);
+                if (pending != _inFlight.end()) {
+                    _coalesced++;
+                    pending->second.cacheable = pending->second.cacheable || cacheable;
+                    return toConnection(pending->second.promise.getFuture());
+                }
+                _misses++;
+                _inFlight[key] = InFlight{promise, cacheable};
+            }
+            auto self = shared_from_this();
+            Try<Future<std::shared_ptr<api::HttpUrlConnection>>> request = Try<Future<std::shared_ptr<api::HttpUrlConnection>>>::from(fetcher);
+            if (request.isFailure()) {
+                Try<std::shared_ptr<api::HttpUrlConnection>> failure;
+                failure.fail(request.getFailure());
+                onResponse(key, failure);
+            } else {
+                auto response = request.getValue();
+                response.onComplete(ImmediateExecutionContext::INSTANCE, [self, key] (const Try<std::shared_ptr<api::HttpUrlConnection>> &result) {
+                    self->onResponse(key, result);
+                });
+            }
+            return toConnection(promise.getFuture());
+        }
+
+        void HttpResponseCache::onResponse(const std::string &key,
+                                           const Try<std::shared_ptr<api::HttpUrlConnection>> &result) {
+            Try<std::shared_ptr<const Response>> response;
+            if (result.isSuccess()) {
+                response = Try<std::shared_ptr<const Response>>::from([&result] () {
+                    return bufferize(result.getValue());
+                });
+            } else {
+                response.fail(result.getFailure());
+            }
+
+            InFlight pending;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                auto it = _inFlight.find(key);
+                if (it == _inFlight.end()) {
+                    return;
+                }
+                pending = it->second;
+                _inFlight.erase(it);
+
+                auto isSuccessful = response.isSuccess() &&
+                        response.getValue()->statusCode >= 200 && response.getValue()->statusCode < 300;
+                if (pending.cacheable && isSuccessful && _ttl.count() > 0) {
+                    auto now = std::chrono::steady_clock::now();
+                    for (auto it = _responses.begin(); it != _responses.end();) {
+                        it = now - it->second.second > _ttl ? _responses.erase(it) : std::next(it);
+                    }
+                    _responses[key] = std::make_pair(response.getValue(), now);
+                }
+            }
+            pending.promise.complete(response);
+        }
+
+        HttpResponseCacheStatistics HttpResponseCache::getStatistics() const {
+            return HttpResponseCacheStatistics{_hits.load(), _coalesced.load(), _misses.load()};
+        }
+
+        void HttpResponseCache::clear() {
+            std::lock_guard<std::mutex> lock(_lock);
+            _responses.clear();
+        }
+
+        std::string HttpResponseCache::makeKey(const std::string &url,
+                                               const std::unordered_map<std::string, std::string> &headers) {
+            std::vector<std::pair<std::string, std::string>> sortedHeaders(headers.begin(), headers.end());
+            std::sort(sortedHeaders.begin(), sortedHeaders.end());
+            auto key = url;
+            for (const auto &header : sortedHeaders) {
+                key += '\n';
+                key += header.first;
+                key += ':';
+                key += header.second;
+            }
+            return key;
+        }
+
+        std::shared_ptr<const HttpResponseCache::Response>
+        HttpResponseCache::bufferize(const std::shared_ptr<api::HttpUrlConnection> &connection) {
+            auto response = std::make_shared<Response>();
+            response->statusCode = connection->getStatusCode();
+            response->statusText = connection->getStatusText();
+            response->headers = connection->getHeaders();
+            // Like HttpUrlConnectionInputStream, consider the first chunk as the whole body
+            auto body = connection->readBody();
+            if (body.error) {
+                throw Exception(body.error.value().code, body.error.value().message);
+            }
+            if (body.data) {
+                response->body = std::move(body.data.value());
+            }
+            return response;
+        }
+
+        Future<std::shared_ptr<api::HttpUrlConnection>>
+        HttpResponseCache::toConnection(Future<std::shared_ptr<const Response>> response) {
+            return response.map<std::shared_ptr<api::HttpUrlConnection>>(ImmediateExecutionContext::INSTANCE, [] (const std::shared_ptr<const Response> &r) -> std::shared_ptr<api::HttpUrlConnection> {
+                return std::make_shared<BufferedUrlConnection>(r);
+            });
+        }
+
+        HttpResponseCache::BufferedUrlConnection::BufferedUrlConnection(const std::shared_ptr<const Response> &response)
+            : _response(response), _consumed(false) {
+        }
+
+        int32_t HttpResponseCache::BufferedUrlConnection::getStatusCode() {
+            return _response->statusCode;
+        }
+
+        std::string HttpResponseCache::BufferedUrlConnection::getStatusText() {
+            return _response->statusText;
+        }
+
+        std::unordered_map<std::string, std::string> HttpResponseCache::BufferedUrlConnection::getHeaders() {
+            return _response->headers;
+        }
+
+        api::HttpReadBodyResult HttpResponseCache::BufferedUrlConnection::readBody() {
+            if (_consumed) {
+                return api::HttpReadBodyResult(std::experimental::nullopt, std::vector<uint8_t>());
+            }
+            _consumed = true;
+            return api::HttpReadBodyResult(std::experimental::nullopt, _response->body);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ *
+ * HttpResponseCache
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_HTTPRESPONSECACHE_HPP
+#define LEDGER_CORE_HTTPRESPONSECACHE_HPP
+
+#include "../api/HttpUrlConnection.hpp"
+#include "../api/ExecutionContext.hpp"
+#include "../async/Future.hpp"
+#include "../async/Promise.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ledger {
+    namespace core {
+
+        struct HttpResponseCacheStatistics {
+            // Requests served from a fresh cached response
+            uint64_t hits;
+            // Requests attached to an identical request already in flight
+            uint64_t coalesced;
+            // Requests that actually reached the HTTP engine
+            uint64_t misses;
+        };
+
+        /*
+         * Single-flight layer for GET requests. Identical requests issued while one is in flight
+         * share its response, and responses of requests flagged as cacheable are kept for a
+         * short TTL. Responses are buffered so that every caller reads its own copy of the body.
+         */
+        class HttpResponseCache : public std::enable_shared_from_this<HttpResponseCache> {
+        public:
+            using Fetcher = std::function<Future<std::shared_ptr<api::HttpUrlConnection>> ()>;
+
+            explicit HttpResponseCache(const std::chrono::milliseconds &ttl);
+
+            Future<std::shared_ptr<api::HttpUrlConnection>> get(const std::string &key,
+                                                                 bool cacheable,
+                                                                 const Fetcher &fetcher);
+
+            HttpResponseCacheStatistics getStatistics() const;
+            void clear();
+
+            static std::string makeKey(const std::string &url,
+                                       const std::unordered_map<std::string, std::string> &headers);
+
+        private:
+            struct Response {
+                int32_t statusCode;
+                std::string statusText;
+                std::unordered_map<std::string, std::string> headers;
+                std::vector<uint8_t> body;
+            };
+
+            class BufferedUrlConnection : public api::HttpUrlConnection {
+            public:
+                explicit BufferedUrlConnection(const std::shared_ptr<const Response> &response);
+                int32_t getStatusCode() override;
+                std::string getStatusText() override;
+                std::unordered_map<std::string, std::string> getHeaders() override;
+                api::HttpReadBodyResult readBody() override;
+
+            private:
+                std::shared_ptr<const Response> _response;
+                bool _consumed;
+            };
+
+            struct InFlight {
+                Promise<std::shared_ptr<const Response>> promise;
+                bool cacheable;
+            };
+
+            static std::shared_ptr<const Response> bufferize(const std::shared_ptr<api::HttpUrlConnection> &connection);
+            static Future<std::shared_ptr<api::HttpUrlConnection>> toConnection(Future<std::shared_ptr<const Response>> response);
+            void onResponse(const std::string &key, const Try<std::shared_ptr<api::HttpUrlConnection>> &result);
+
+            std::chrono::milliseconds _ttl;
+            mutable std::mutex _lock;
+            std::unordered_map<std::string, InFlight> _inFlight;
+            std::unordered_map<std::string, std::pair<std::shared_ptr<const Response>, std::chrono::steady_clock::time_point>> _responses;
+            std::atomic<uint64_t> _hits;
+            std::atomic<uint64_t> _coalesced;
+            std::atomic<uint64_t> _misses;
+        };
+    }
+}
+
+#endif //LEDGER_CORE_HTTPRESPONSECACHE_HPP
@@ -93,7 +93,8 @@ namespace ledger {
                 }
                 _index = 0;
                 _offset += _buffer.size();
-               _buffer = result.data.value();
+                // Take ownership of the chunk instead of copying it
+                _buffer = std::move(result.data.value());
             }
         }
     }
@@ -32,7 +32,6 @@
 #include <string>
 #include <cstdlib>
 #include "collections/vector.hpp"
-#include <sstream>
 #include "fmt/format.h"
 #include "collections/strings.hpp"
 #include <algorithm>
@@ -42,7 +41,7 @@ namespace ledger {
 
         static const auto HARD_BIT = 0x80000000;
 
-        DerivationPath::DerivationPath(const std::string &path) : DerivationPath(parse(path)) {
+        DerivationPath::DerivationPath(const std::string &path) : _path(parse(path)) {
 
         }
 
@@ -50,6 +49,10 @@ namespace ledger {
 
         }
 
+        DerivationPath::DerivationPath(std::vector<uint32_t> &&path) : _path(std::move(path)) {
+
+        }
+
         std::vector<uint32_t> DerivationPath::parse(const std::string &path) {
             std::string currentNode = "";
             bool hardened = false;
@@ -153,32 +156,59 @@ namespace ledger {
             return !((*this) == path);
         }
 
+        bool DerivationPath::operator<(const DerivationPath &path) const {
+            return _path < path._path;
+        }
+
         DerivationPath DerivationPath::getParent() const {
             assertIndexIsValid(getDepth() - 1, "ledger::core::DerivationPath::getParent");
             return DerivationPath(std::vector<uint32_t>(_path.begin(), _path.end() - 1));
         }
 
+        DerivationPath DerivationPath::getChild(uint32_t childNum) const {
+            std::vector<uint32_t> path;
+            path.reserve(_path.size() + 1);
+            path.insert(path.end(), _path.begin(), _path.end());
+            path.push_back(childNum);
+            return DerivationPath(std::move(path));
+        }
+
+        std::size_t DerivationPath::hash() const {
+            // boost::hash_combine over the child numbers
+            std::size_t seed = _path.size();
+            for (const auto& childNum : _path) {
+                seed ^= std::hash<uint32_t>()(childNum) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+
         bool DerivationPath::isRoot() const {
             return getDepth() == 0;
         }
 
         std::string DerivationPath::toString(bool addLeadingM) const {
-            std::stringstream ss;
+            std::string result;
+            // At most 10 digits, a hardened mark and a separator per level
+            result.reserve((addLeadingM ? 2 : 0) + _path.size() * 12);
             if (addLeadingM) {
-                ss << "m/";
+                result += "m/";
             }
-            auto index = 0;
-            auto depth = getDepth();
-            for (const auto& childNum : _path) {
-                auto v = ~HARD_BIT & childNum;
-                ss << v;
-                if ((HARD_BIT & childNum) == HARD_BIT)
-                    ss << '\'';
-                index += 1;
-                if (index < depth)
-                    ss << '/';
+            char digits[10];
+            for (auto it = _path.begin(); it != _path.end(); it++) {
+                if (it != _path.begin())
+                    result += '/';
+                auto v = ~HARD_BIT & *it;
+                auto end = digits + sizeof(digits);
+                auto begin = end;
+                do {
+                    *--begin = static_cast<char>('0' + v % 10);
+                    v /= 10;
+                } while (v != 0);
+                result.append(begin, end);
+                if ((HARD_BIT & *it) == HARD_BIT)
+                    result += '\'';
             }
-            return ss.str();
+            return result;
         }
 
         std::vector<uint32_t> DerivationPath::toVector() const {
@@ -207,12 +237,12 @@ namespace ledger {
 
         }
 
-        DerivationPath::DerivationPath(DerivationPath &&path) : _path(path._path) {
+        DerivationPath::DerivationPath(DerivationPath &&path) : _path(std::move(path._path)) {
 
         }
 
         DerivationPath& DerivationPath::operator=(DerivationPath &&path) {
-            this->_path = path._path;
+            this->_path = std::move(path._path);
             return *this;
         }
 
@@ -31,6 +31,7 @@
 #ifndef LEDGER_CORE_DERIVATIONPATH_HPP
 #define LEDGER_CORE_DERIVATIONPATH_HPP
 
+#include <functional>
 #include <string>
 #include <vector>
 #include "Exception.hpp"
@@ -41,6 +42,7 @@ namespace ledger {
         public:
             explicit DerivationPath(const std::string& path);
             explicit DerivationPath(const std::vector<uint32_t>& path);
+            explicit DerivationPath(std::vector<uint32_t>&& path);
             DerivationPath(const DerivationPath& path);
             DerivationPath(DerivationPath&& path);
             DerivationPath& operator=(DerivationPath&& path);
@@ -53,7 +55,11 @@ namespace ledger {
             DerivationPath operator+(const DerivationPath& derivationPath) const;
             bool operator==(const DerivationPath& path) const;
             bool operator!=(const DerivationPath& path) const;
+            bool operator<(const DerivationPath& path) const;
             DerivationPath getParent() const;
+            // Extends the path by one level, childNum carries the hardened bit if any
+            DerivationPath getChild(uint32_t childNum) const;
+            std::size_t hash() const;
             bool isRoot() const;
             std::string toString(bool addLeadingM = false) const;
             std::vector<uint32_t> toVector() const;
@@ -80,5 +86,14 @@ namespace ledger {
     }
 }
 
+namespace std {
+    template <>
+    struct hash<ledger::core::DerivationPath> {
+        std::size_t operator()(const ledger::core::DerivationPath& path) const {
+            return path.hash();
+        }
+    };
+}
+
 
 #endif //LEDGER_CORE_DERIVATIONPATH_HPP
@@ -32,6 +32,8 @@
 #include "collections/collections.hpp"
 #include "boost/lexical_cast.hpp"
 #include <sstream>
+#include <mutex>
+#include <unordered_map>
 
 namespace ledger {
     namespace core {
@@ -106,7 +108,7 @@ namespace ledger {
             _scheme = cpy._scheme;
         }
 
-        DerivationScheme DerivationScheme::getSchemeFrom(DerivationSchemeLevel level) {
+        DerivationScheme DerivationScheme::getSchemeFrom(DerivationSchemeLevel level) const {
             auto it = _scheme.begin();
             auto end = _scheme.end();
             while (it != end) {
@@ -119,7 +121,7 @@ namespace ledger {
             return *this;
         }
 
-        DerivationScheme DerivationScheme::shift(int n) {
+        DerivationScheme DerivationScheme::shift(int n) const {
             auto it = _scheme.begin() + n;
             auto end = _scheme.end();
             auto scheme = std::vector<DerivationSchemeNode>(it, end);
@@ -146,12 +148,17 @@ namespace ledger {
             return *this;
         }
 
-        DerivationPath DerivationScheme::getPath() {
-            std::function<uint32_t (const DerivationSchemeNode&)> map = [] (const DerivationSchemeNode &item) -> uint32_t {
-                return item.value | (item.hardened ? 0x80000000 : 0x00);
-            };
-            auto segments = functional::map(_scheme, map);
-            return DerivationPath(segments);
+        DerivationPath DerivationScheme::getPath() const {
+            std::vector<uint32_t> segments;
+            segments.reserve(_scheme.size());
+            for (const auto& item : _scheme) {
+                segments.push_back(item.value | (item.hardened ? 0x80000000 : 0x00));
+            }
+            return DerivationPath(std::move(segments));
+        }
+
+        size_t DerivationScheme::getDepth() const {
+            return _scheme.size();
         }
 
         DerivationScheme &DerivationScheme::setCoinType(int type) {
@@ -235,6 +242,18 @@ namespace ledger {
             return ss.str();
         }
 
+        const DerivationScheme& DerivationScheme::intern(const std::string &scheme) {
+            static std::mutex lock;
+            // Node based map: references to the values stay valid when it grows
+            static std::unordered_map<std::string, DerivationScheme> schemes;
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = schemes.find(scheme);
+            if (it == schemes.end()) {
+                it = schemes.emplace(scheme, DerivationScheme(scheme)).first;
+            }
+            return it->second;
+        }
+
         int DerivationScheme::getPositionForLevel(DerivationSchemeLevel level) const {
             auto index = 0;
             for (auto& i : _scheme) {
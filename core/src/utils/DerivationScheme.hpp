@@ -57,12 +57,13 @@ namespace ledger {
             DerivationScheme(const std::string& scheme);
             DerivationScheme(const std::vector<DerivationSchemeNode>& nodes);
             DerivationScheme(const DerivationScheme& cpy);
-            DerivationScheme getSchemeFrom(DerivationSchemeLevel level);
+            DerivationScheme getSchemeFrom(DerivationSchemeLevel level) const;
             DerivationScheme getSchemeTo(DerivationSchemeLevel level) const;
             DerivationScheme getSchemeToDepth(size_t depth) const;
-            DerivationScheme shift(int n = 1);
+            DerivationScheme shift(int n = 1) const;
 
-            DerivationPath getPath();
+            DerivationPath getPath() const;
+            size_t getDepth() const;
 
             int getCoinType() const;
             int getAccountIndex() const;
@@ -78,6 +79,10 @@ namespace ledger {
 
             std::string toString() const;
 
+            // Parses a scheme once per process: wallets and keychains of the same configuration share
+            // the parsed nodes instead of splitting the configuration string for each account
+            static const DerivationScheme& intern(const std::string& scheme);
+
         private:
             DerivationScheme& setVariable(DerivationSchemeLevel level, int value);
             int getVariable(DerivationSchemeLevel level) const;
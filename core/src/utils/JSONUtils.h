@@ -33,6 +33,8 @@
 
 #include <rapidjson/reader.h>
 #include <string>
+#include <limits>
+#include <math/BigInt.h>
 #include <wallet/common/explorers/LedgerApiParser.hpp>
 
 namespace ledger {
@@ -53,6 +55,40 @@ namespace ledger {
                 }
                 return result.getRight();
             };
+
+            // Parse a raw JSON number in place, returns false if it is not an unsigned integer fitting in 64 bits
+            static bool parseUint64(const char* str, size_t length, uint64_t& result) {
+                if (length == 0) {
+                    return false;
+                }
+                uint64_t value = 0;
+                for (size_t i = 0; i < length; i++) {
+                    auto digit = static_cast<uint64_t>(str[i] - '0');
+                    if (digit > 9 || value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+                        return false;
+                    }
+                    value = value * 10 + digit;
+                }
+                result = value;
+                return true;
+            }
+
+            // Parse a raw JSON number as an unsigned 64 bits integer, only going through BigInt for inputs the fast path rejects
+            static uint64_t parseUint64(const char* str, size_t length) {
+                uint64_t value;
+                if (parseUint64(str, length, value)) {
+                    return value;
+                }
+                return BigInt::fromString(std::string(str, length)).toUint64();
+            }
+
+            static BigInt parseBigInt(const char* str, size_t length) {
+                uint64_t value;
+                if (parseUint64(str, length, value)) {
+                    return BigInt(static_cast<unsigned long long>(value));
+                }
+                return BigInt::fromString(std::string(str, length));
+            }
         };
 
     }
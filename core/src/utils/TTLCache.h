@@ -31,56 +31,171 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
 #include <unordered_map>
 #include <mutex>
-#include <iostream>
+#include <vector>
 #include "Option.hpp"
 /*
- * A really simple implementation of TTL cache
+ * Bounded TTL cache. Keys are spread over independently locked shards, each shard keeps its entries in LRU
+ * order (evicted when the shard is full) and in write order (expired entries are dropped from the oldest on each
+ * access to the shard, not only when the expired key itself is read).
  */
 namespace ledger {
     namespace core {
-        template <typename K, typename V, typename Duration = std::chrono::seconds>
+        struct TTLCacheStats {
+            uint64_t hits;
+            uint64_t misses;
+            uint64_t evictions;
+            uint64_t expirations;
+        };
+
+        template <typename K, typename V, typename Duration = std::chrono::seconds, typename Hash = std::hash<K>>
         class TTLCache {
         public:
-            TTLCache(const Duration &ttl) : _ttl(ttl) {};
+            static constexpr size_t DEFAULT_CAPACITY = 4096;
+            static constexpr size_t DEFAULT_SHARDS = 8;
+
+            TTLCache(const Duration &ttl, size_t capacity = DEFAULT_CAPACITY, size_t shards = DEFAULT_SHARDS)
+                : _ttl(ttl), _hits(0), _misses(0), _evictions(0), _expirations(0) {
+                shards = std::max<size_t>(shards, 1);
+                _shardCapacity = std::max<size_t>((capacity + shards - 1) / shards, 1);
+                _shards.reserve(shards);
+                for (size_t i = 0; i < shards; i++) {
+                    _shards.emplace_back(new Shard());
+                }
+            };
 
             Option<V> get(const K &key) {
-                std::lock_guard<std::mutex> lock(_lock);
-                auto it = _cache.find(key);
-                if (it == _cache.end()) {
-                    return Option<V>();
-                } else if (getNowDurationSinceEpoch() - (*it).second.second > _ttl) {
-                    // Clean the cache
-                    _cache.erase(key);
+                auto& shard = getShard(key);
+                std::lock_guard<std::mutex> lock(shard.lock);
+                purgeExpired(shard, now());
+                auto it = shard.entries.find(key);
+                if (it == shard.entries.end()) {
+                    _misses++;
                     return Option<V>();
                 }
-                return Option<V>((*it).second.first);
+                _hits++;
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+                return Option<V>(it->second.value);
             }
 
             void put(const K &key, const V &value) {
-                std::lock_guard<std::mutex> lock(_lock);
-                _cache.insert(
-                        { key,
-                          { value,
-                            getNowDurationSinceEpoch()
-                          }
-                        });
+                auto& shard = getShard(key);
+                auto writtenAt = now();
+                std::lock_guard<std::mutex> lock(shard.lock);
+                purgeExpired(shard, writtenAt);
+                auto it = shard.entries.find(key);
+                if (it != shard.entries.end()) {
+                    // Refresh both the value and its expiry
+                    it->second.value = value;
+                    it->second.writtenAt = writtenAt;
+                    shard.lru.splice(shard.lru.begin(), shard.lru, it->second.lruPosition);
+                    shard.writes.splice(shard.writes.end(), shard.writes, it->second.writePosition);
+                    return;
+                }
+                if (shard.entries.size() >= _shardCapacity) {
+                    _evictions++;
+                    remove(shard, shard.entries.find(*shard.lru.back()));
+                }
+                it = shard.entries.emplace(key, Entry(value, writtenAt)).first;
+                // Node keys of an unordered_map are stable until erased
+                shard.lru.push_front(&it->first);
+                it->second.lruPosition = shard.lru.begin();
+                shard.writes.push_back(&it->first);
+                it->second.writePosition = std::prev(shard.writes.end());
             }
 
             void erase(const K &key) {
-                std::lock_guard<std::mutex> lock(_lock);
-                _cache.erase(key);
+                auto& shard = getShard(key);
+                std::lock_guard<std::mutex> lock(shard.lock);
+                auto it = shard.entries.find(key);
+                if (it != shard.entries.end()) {
+                    remove(shard, it);
+                }
+            }
+
+            /**
+             * Drop every expired entry, for owners willing to release memory of keys not accessed anymore.
+             */
+            void purgeExpired() {
+                auto time = now();
+                for (auto& shard : _shards) {
+                    std::lock_guard<std::mutex> lock(shard->lock);
+                    purgeExpired(*shard, time);
+                }
+            }
+
+            size_t size() {
+                size_t result = 0;
+                for (auto& shard : _shards) {
+                    std::lock_guard<std::mutex> lock(shard->lock);
+                    result += shard->entries.size();
+                }
+                return result;
+            }
+
+            TTLCacheStats getStats() const {
+                return TTLCacheStats {_hits.load(), _misses.load(), _evictions.load(), _expirations.load()};
             }
 
         private:
-            Duration getNowDurationSinceEpoch() {
+            struct Entry {
+                Entry(const V& v, const Duration& w) : value(v), writtenAt(w) {};
+                V value;
+                Duration writtenAt;
+                typename std::list<const K*>::iterator lruPosition;
+                typename std::list<const K*>::iterator writePosition;
+            };
+
+            struct Shard {
+                std::mutex lock;
+                std::unordered_map<K, Entry, Hash> entries;
+                // Most recently used first
+                std::list<const K*> lru;
+                // Oldest write first, with a single TTL this is also the expiry order
+                std::list<const K*> writes;
+            };
+
+            Shard& getShard(const K &key) {
+                return *_shards[Hash()(key) % _shards.size()];
+            }
+
+            void purgeExpired(Shard& shard, const Duration& time) {
+                while (!shard.writes.empty()) {
+                    auto it = shard.entries.find(*shard.writes.front());
+                    if (time - it->second.writtenAt <= _ttl) {
+                        break;
+                    }
+                    _expirations++;
+                    remove(shard, it);
+                }
+            }
+
+            void remove(Shard& shard, typename std::unordered_map<K, Entry, Hash>::iterator it) {
+                shard.lru.erase(it->second.lruPosition);
+                shard.writes.erase(it->second.writePosition);
+                shard.entries.erase(it);
+            }
+
+            Duration now() const {
                 return std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now().time_since_epoch());
             }
+
             Duration _ttl;
-            std::unordered_map<K, std::pair<V, Duration>> _cache;
-            std::mutex _lock;
+            size_t _shardCapacity;
+            std::vector<std::unique_ptr<Shard>> _shards;
+            std::atomic<uint64_t> _hits;
+            std::atomic<uint64_t> _misses;
+            std::atomic<uint64_t> _evictions;
+            std::atomic<uint64_t> _expirations;
         };
     }
-}
\ No newline at end of file
+}
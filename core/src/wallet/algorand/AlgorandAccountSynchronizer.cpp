@@ -30,6 +30,10 @@
 
 #include "AlgorandAccountSynchronizer.hpp"
 #include "AlgorandAccount.hpp"
+#include "AlgorandExplorerConstants.hpp"
+
+#include <algorithm>
+#include <limits>
 
 #include <wallet/common/database/AccountDatabaseHelper.h>
 #include <utils/DateUtils.hpp>
@@ -38,6 +42,7 @@
 #include <collections/vector.hpp>
 #include <debug/Benchmarker.h>
 #include <async/Future.hpp>
+#include <async/algorithm.h>
 #include <api/Configuration.hpp>
 #include <api/ConfigurationDefaults.hpp>
 
@@ -77,6 +82,13 @@ namespace algorand {
         return _notifier;
     };
 
+    namespace {
+        // Bounded fan-out of the initial synchronization
+        constexpr uint64_t MAX_PARALLEL_WINDOWS = 4;
+        // Below this span, splitting costs more requests than it saves round trips
+        constexpr uint64_t MIN_WINDOW_ROUNDS = 500000;
+    }
+
     Future<Unit> AccountSynchronizer::performSynchronization(const std::shared_ptr<Account> & account) {
 
         _internalPreferences = account->getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer");
@@ -91,8 +103,8 @@ namespace algorand {
         }
 
         return updateLatestBlock(account->getContext())
-            .template flatMap<bool>(account->getContext(), [this, account, firstRound] (const Unit&) -> Future<bool> {
-                return synchronizeBatch(account, false, firstRound);
+            .template flatMap<bool>(account->getContext(), [this, account, firstRound] (const uint64_t& latestRound) -> Future<bool> {
+                return synchronizeRounds(account, firstRound.getValueOr(0), latestRound);
             }).template flatMap<Unit>(account->getContext(), [] (const bool hadTransactions) -> Future<Unit> {
                 return Future<Unit>::successful(unit);
             }).recoverWith(ImmediateExecutionContext::INSTANCE, [] (const Exception & exception) -> Future<Unit> {
@@ -100,52 +112,97 @@ namespace algorand {
             });
     }
 
-    Future<bool> AccountSynchronizer::synchronizeBatch(const std::shared_ptr<Account> & account,
-                                                       const bool hadTransactions,
-                                                       const Option<uint64_t> & lowestRound,
-                                                       const Option<uint64_t> & highestRound) {
-        return _explorer->getTransactionsForAddress(account->getAddress().toString(), lowestRound, highestRound)
-            .template flatMap<bool>(getContext(),
-                [this, account, hadTransactions, lowestRound](const model::TransactionsBulk& bulk) -> Future<bool> {
-
-                soci::session sql(account->getWallet()->getDatabase()->getPool());
-                soci::transaction tr(sql);
+    Future<bool> AccountSynchronizer::synchronizeRounds(const std::shared_ptr<Account> & account,
+                                                        uint64_t firstRound,
+                                                        uint64_t latestRound) {
+        const auto span = latestRound > firstRound ? latestRound - firstRound : 0;
+        const auto windowsCount = std::max<uint64_t>(1, std::min(MAX_PARALLEL_WINDOWS, span / MIN_WINDOW_ROUNDS));
+        const auto windowSize = span / windowsCount + 1;
+
+        // Windows are disjoint: [first, first + size - 1], [first + size, ...], the last one has no upper bound
+        // so that transactions confirmed after the latest block was fetched are not missed
+        std::vector<Future<uint64_t>> windows;
+        windows.reserve(windowsCount);
+        for (uint64_t index = 0; index < windowsCount; index++) {
+            const auto lowest = firstRound + index * windowSize;
+            const auto highest = index + 1 < windowsCount ? Option<uint64_t>(lowest + windowSize - 1) : Option<uint64_t>();
+            auto window = std::make_shared<RoundWindow>(lowest, highest);
+            windows.push_back(synchronizeWindow(account, window, highest, Option<std::string>()));
+        }
 
+        return async::sequence(getContext(), windows)
+            .template map<bool>(getContext(), [this] (const std::vector<uint64_t> & highestRounds) -> bool {
                 auto savedState = _internalPreferences->template getObject<SavedState>("state");
                 if (savedState.isEmpty()) {
                     throw Exception(api::ErrorCode::ILLEGAL_STATE, "Saved State not available during account synchronization");
                 }
+                // Only move the saved round once every window is stored, a failed window is fetched again next time
+                const auto highestRound = *std::max_element(highestRounds.begin(), highestRounds.end());
+                savedState->round = std::max(savedState->round, highestRound);
+                _internalPreferences->editor()->template putObject<SavedState>("state", savedState.getValue())->commit();
+                return highestRound > 0;
+            });
+    }
+
+    Future<uint64_t> AccountSynchronizer::synchronizeWindow(const std::shared_ptr<Account> & account,
+                                                            const std::shared_ptr<RoundWindow> & window,
+                                                            const Option<uint64_t> & highestRound,
+                                                            const Option<std::string> & nextToken) {
+        return _explorer->getTransactionsForAddress(account->getAddress().toString(), window->lowestRound, highestRound, nextToken)
+            .template flatMap<uint64_t>(getContext(),
+                [this, account, window, highestRound](const model::TransactionsBulk& bulk) -> Future<uint64_t> {
 
                 auto lowestBatchRound = std::numeric_limits<uint64_t>::max();
+                auto newTransactions = 0;
                 for (const auto& tx : bulk.transactions) {
-
-                    auto tryPutTx = Try<int>::from([account, &sql, &tx] () {
-                        return (account->putTransaction(sql, tx));
-                    });
-
                     // Record the lowest round in this batch, to continue fetching txs below it if needed
                     lowestBatchRound = std::min(lowestBatchRound, tx.header.round.getValueOr(lowestBatchRound));
 
-                    // Record the highest round ever seen, to update the cache for next incremental sychronization
-                    savedState->round = std::max(savedState->round, tx.header.round.getValueOr(0));
+                    // The next page starts at the lowest round of this one, its transactions are fetched twice
+                    if (window->transactionIds.insert(tx.header.id.getValueOr("")).second) {
+                        window->transactions.push_back(tx);
+                        newTransactions += 1;
+                    }
                 }
-                tr.commit();
-
-                // Update the cache for next incremental sychronization
-                _internalPreferences->editor()->template putObject<SavedState>("state", savedState.getValue())->commit();
 
-                auto hadTX = hadTransactions || bulk.transactions.size() > 0;
                 if (bulk.hasNext) {
-                    return synchronizeBatch(account, hadTX, lowestRound, lowestBatchRound);
-                } else {
-                    return Future<bool>::successful(hadTX);
+                    // The indexer cursor pages through the same query exactly, even inside a round holding more than a page
+                    if (bulk.nextToken.nonEmpty()) {
+                        return synchronizeWindow(account, window, highestRound, bulk.nextToken);
+                    }
+                    if (newTransactions > 0) {
+                        return synchronizeWindow(account, window, lowestBatchRound, Option<std::string>());
+                    }
+                    // Only known transactions: the round holds more than a page, walking below it would drop the rest
+                    throw make_exception(api::ErrorCode::API_ERROR,
+                                         "Round {} holds more than {} transactions of {} and no next token was returned",
+                                         lowestBatchRound, constants::EXPLORER_QUERY_LIMIT, account->getAddress().toString());
                 }
+                return Future<uint64_t>::successful(storeWindow(account, *window));
             });
     }
 
-    Future<Unit> AccountSynchronizer::updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context) {
+    uint64_t AccountSynchronizer::storeWindow(const std::shared_ptr<Account> & account, const RoundWindow & window) {
+        std::lock_guard<std::mutex> lock(_storeLock);
+        soci::session sql(account->getWallet()->getDatabase()->getPool());
+        soci::transaction tr(sql);
+
+        uint64_t highestRound = 0;
+        for (const auto& tx : window.transactions) {
+            auto tryPutTx = Try<int>::from([&account, &sql, &tx] () {
+                return (account->putTransaction(sql, tx));
+            });
+
+            // Record the highest round ever seen, to update the cache for next incremental sychronization
+            highestRound = std::max(highestRound, tx.header.round.getValueOr(0));
+        }
+        tr.commit();
+        return highestRound;
+    }
+
+    Future<uint64_t> AccountSynchronizer::updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context) {
         return _explorer->getLatestBlock()
-            .template flatMap<Unit>(context, [this] (const Try<api::Block>& block) -> Future<Unit> {
+            .template flatMap<uint64_t>(context, [this] (const Try<api::Block>& block) -> Future<uint64_t> {
                 if (block.isSuccess()) {
                     soci::session sql(_account->getWallet()->getDatabase()->getPool());
                     soci::transaction tr(sql);
@@ -157,9 +214,9 @@ namespace algorand {
                     } catch(...) {
                         tr.rollback();
                     }
-                    return Future<Unit>::successful(unit);
+                    return Future<uint64_t>::successful(static_cast<uint64_t>(block.getValue().height));
                 }
-                return Future<Unit>::failure(block.getFailure());
+                return Future<uint64_t>::failure(block.getFailure());
             });
     }
 
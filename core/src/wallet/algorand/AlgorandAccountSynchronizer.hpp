@@ -41,6 +41,7 @@
 #include <mutex>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <vector>
 
 namespace ledger {
@@ -72,20 +73,43 @@ namespace algorand {
 
     private:
 
+        // Transactions of one round window, fetched from its highest round down to its lowest one
+        struct RoundWindow {
+            uint64_t lowestRound;
+            Option<uint64_t> highestRound;
+            std::vector<model::Transaction> transactions;
+            std::unordered_set<std::string> transactionIds;
+
+            RoundWindow(uint64_t lowest, const Option<uint64_t> & highest) :
+                lowestRound(lowest), highestRound(highest) {}
+        };
+
         Future<Unit> performSynchronization(const std::shared_ptr<Account> & account);
 
-        Future<bool> synchronizeBatch(const std::shared_ptr<Account> & account,
-                                      const bool hadTransactions,
-                                      const Option<uint64_t> & lowestRound = Option<uint64_t>(),
-                                      const Option<uint64_t> & highestRound = Option<uint64_t>());
+        // Splits [firstRound, latestRound] into windows synchronized concurrently
+        Future<bool> synchronizeRounds(const std::shared_ptr<Account> & account,
+                                       uint64_t firstRound,
+                                       uint64_t latestRound);
+
+        // Fetches the window page by page, then stores it in a single database transaction
+        // Pages follow the indexer next token when there is one, otherwise the max round walks down
+        // Returns the highest round of the window transactions, 0 if there were none
+        Future<uint64_t> synchronizeWindow(const std::shared_ptr<Account> & account,
+                                           const std::shared_ptr<RoundWindow> & window,
+                                           const Option<uint64_t> & highestRound,
+                                           const Option<std::string> & nextToken);
+
+        uint64_t storeWindow(const std::shared_ptr<Account> & account, const RoundWindow & window);
 
-        Future<Unit> updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context);
+        Future<uint64_t> updateLatestBlock(const std::shared_ptr<api::ExecutionContext> &context);
 
         std::shared_ptr<Account> _account;
         std::shared_ptr<BlockchainExplorer> _explorer;
         std::shared_ptr<Preferences> _internalPreferences;
         std::shared_ptr<ProgressNotifier<Unit>> _notifier;
         std::mutex _lock;
+        // Windows are fetched concurrently but written one at a time
+        std::mutex _storeLock;
 
     };
 
@@ -29,6 +29,7 @@
 
 #include "AlgorandBlockchainExplorer.hpp"
 #include "AlgorandJsonParser.hpp"
+#include "AlgorandTransactionsBulkParser.hpp"
 #include "AlgorandExplorerConstants.hpp"
 
 #include <api/Configuration.hpp>
@@ -55,6 +56,7 @@ namespace algorand {
         const std::string limitQueryParam = "{}?limit={}";
         const std::string minRoundQueryParam = "{}&min-round={}";
         const std::string maxRoundQueryParam = "{}&max-round={}";
+        const std::string nextTokenQueryParam = "{}&next={}";
 
     } // namespace constants
 
@@ -164,7 +166,8 @@ namespace algorand {
     Future<model::TransactionsBulk>
     BlockchainExplorer::getTransactionsForAddress(const std::string & address,
                                                   const Option<uint64_t> & firstRound,
-                                                  const Option<uint64_t> & lastRound) const
+                                                  const Option<uint64_t> & lastRound,
+                                                  const Option<std::string> & nextToken) const
     {
         auto url = fmt::format(constants::purestakeAccountTransactionsEndpoint, address);
         url = fmt::format(constants::limitQueryParam, url, constants::EXPLORER_QUERY_LIMIT);
@@ -174,21 +177,18 @@ namespace algorand {
         if (lastRound) {
             url = fmt::format(constants::maxRoundQueryParam, url, *lastRound);
         }
+        if (nextToken) {
+            url = fmt::format(constants::nextTokenQueryParam, url, *nextToken);
+        }
 
+        // Streamed: a page is never held as a whole DOM
         return _http->GET(url)
-            .json(false)
-            .map<model::TransactionsBulk>(getContext(), [](const HttpRequest::JsonResult& response) {
-                    const auto& json = std::get<1>(response)->GetObject();
-                    if (!json.HasMember(constants::xTransactions.c_str())) {
-                        throw make_exception(api::ErrorCode::NO_SUCH_ELEMENT, fmt::format("Missing '{}' field in JSON.", constants::xTransactions));
+            .template json<TransactionsBulkParser::Result, Exception>(TransactionsBulkParser())
+            .map<model::TransactionsBulk>(getContext(), [](const Either<Exception, std::shared_ptr<model::TransactionsBulk>>& result) {
+                    if (result.isLeft()) {
+                        throw result.getLeft();
                     }
-                    const auto& jsonArray = json[constants::xTransactions.c_str()].GetArray();
-                    auto txs = model::TransactionsBulk();
-                    JsonParser::parseTransactions(jsonArray, txs.transactions);
-
-                    // Manage limit
-                    txs.hasNext = txs.transactions.size() >= constants::EXPLORER_QUERY_LIMIT;
-                    return txs;
+                    return *result.getRight();
             });
     }
 
@@ -66,7 +66,8 @@ namespace algorand {
 
         Future<model::TransactionsBulk> getTransactionsForAddress(const std::string & address,
                                                                   const Option<uint64_t> & firstRound = Option<uint64_t>(),
-                                                                  const Option<uint64_t> & lastRound = Option<uint64_t>()) const;
+                                                                  const Option<uint64_t> & lastRound = Option<uint64_t>(),
+                                                                  const Option<std::string> & nextToken = Option<std::string>()) const;
 
         Future<model::TransactionParams> getTransactionParams() const;
 
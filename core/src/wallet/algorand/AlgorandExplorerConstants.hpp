@@ -129,6 +129,7 @@ namespace constants {
     static const std::string xCurfrz = "asset-freeze-transaction";
 
     static const std::string xTransactions = "transactions";
+    static const std::string xNextToken = "next-token";
     static const std::string xTxId = "txId";
     static const std::string xMinFee = "min-fee";
     static const std::string xConsensusVersion = "consensus-version";
@@ -0,0 +1,272 @@
+/*
+ *
+ * AlgorandTransactionsBulkParser
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#ifndef LEDGER_CORE_ALGORANDTRANSACTIONSBULKPARSER_H
+#define LEDGER_CORE_ALGORANDTRANSACTIONSBULKPARSER_H
+
+#include "AlgorandJsonParser.hpp"
+#include "AlgorandExplorerConstants.hpp"
+#include "model/transactions/AlgorandTransaction.hpp"
+
+#include <api/HttpUrlConnection.hpp>
+#include <utils/Either.hpp>
+#include <utils/Exception.hpp>
+#include <utils/Option.hpp>
+
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace ledger {
+namespace core {
+namespace algorand {
+
+    /**
+     * SAX handler for the indexer transactions endpoint. Only one transaction of the "transactions" array is
+     * held as a DOM at a time: it is handed to JsonParser::parseTransaction as soon as its object ends, then its
+     * memory is released. Numbers are expected as raw strings (see HttpRequest::json(Handler)).
+     */
+    class TransactionsBulkParser {
+    public:
+        using Result = model::TransactionsBulk;
+
+        TransactionsBulkParser() :
+            _result(std::make_shared<model::TransactionsBulk>()),
+            _depth(0),
+            _inTransactions(false),
+            _inNextToken(false),
+            _hasTransactions(false),
+            _transactionsClosed(false),
+            _closed(false),
+            _statusCode(200)
+        {}
+
+        TransactionsBulkParser(const TransactionsBulkParser& cpy) :
+            _result(std::make_shared<model::TransactionsBulk>(*cpy._result)),
+            _depth(0),
+            _inTransactions(false),
+            _inNextToken(false),
+            _hasTransactions(false),
+            _transactionsClosed(false),
+            _closed(false),
+            _statusCode(cpy._statusCode),
+            _statusText(cpy._statusText)
+        {}
+
+        bool Null() {
+            return value(rapidjson::Value());
+        }
+
+        bool Bool(bool b) {
+            return value(rapidjson::Value(b));
+        }
+
+        bool Int(int i) {
+            return value(rapidjson::Value(i));
+        }
+
+        bool Uint(unsigned i) {
+            return value(rapidjson::Value(i));
+        }
+
+        bool Int64(int64_t i) {
+            return value(rapidjson::Value(i));
+        }
+
+        bool Uint64(uint64_t i) {
+            return value(rapidjson::Value(i));
+        }
+
+        bool Double(double d) {
+            return value(rapidjson::Value(d));
+        }
+
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) {
+            if (!capturing()) {
+                return true;
+            }
+            const std::string number(str, length);
+            if (number.find_first_of(".eE") != std::string::npos) {
+                return Double(std::strtod(number.c_str(), nullptr));
+            } else if (!number.empty() && number[0] == '-') {
+                return Int64(std::strtoll(number.c_str(), nullptr, 10));
+            }
+            return Uint64(std::strtoull(number.c_str(), nullptr, 10));
+        }
+
+        bool String(const char* str, rapidjson::SizeType length, bool copy) {
+            if (_depth == 1 && _inNextToken) {
+                _result->nextToken = std::string(str, length);
+                return true;
+            }
+            if (!capturing()) {
+                return true;
+            }
+            return value(rapidjson::Value(str, length, _allocator));
+        }
+
+        bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+            if (_depth == 1) {
+                _inTransactions = constants::xTransactions.compare(0, std::string::npos, str, length) == 0;
+                _hasTransactions = _hasTransactions || _inTransactions;
+                _inNextToken = constants::xNextToken.compare(0, std::string::npos, str, length) == 0;
+            } else if (capturing()) {
+                _keys.emplace_back(str, length, _allocator);
+            }
+            return true;
+        }
+
+        bool StartObject() {
+            _depth += 1;
+            if (capturing()) {
+                _values.emplace_back(rapidjson::kObjectType);
+            }
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType memberCount) {
+            return endContainer();
+        }
+
+        bool StartArray() {
+            _depth += 1;
+            // The transactions array itself is not captured, only its elements
+            if (capturing() && _depth > 2) {
+                _values.emplace_back(rapidjson::kArrayType);
+            }
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType elementCount) {
+            if (_depth == 2) {
+                _depth -= 1;
+                _transactionsClosed = _transactionsClosed || _inTransactions;
+                _inTransactions = false;
+                return true;
+            }
+            return endContainer();
+        }
+
+        Either<Exception, std::shared_ptr<model::TransactionsBulk>> build() {
+            if (_statusCode < 200 || _statusCode >= 400) {
+                return Either<Exception, std::shared_ptr<model::TransactionsBulk>>(
+                        make_exception(api::ErrorCode::API_ERROR, "{} - {}", _statusCode, _statusText));
+            }
+            if (_exception.nonEmpty()) {
+                return Either<Exception, std::shared_ptr<model::TransactionsBulk>>(_exception.getValue());
+            }
+            // The reader stops silently on malformed or truncated payloads, only a closed document is complete
+            if (!_closed || (_hasTransactions && !_transactionsClosed)) {
+                return Either<Exception, std::shared_ptr<model::TransactionsBulk>>(
+                        make_exception(api::ErrorCode::API_ERROR, "Incomplete '{}' payload.", constants::xTransactions));
+            }
+            if (!_hasTransactions) {
+                return Either<Exception, std::shared_ptr<model::TransactionsBulk>>(
+                        make_exception(api::ErrorCode::NO_SUCH_ELEMENT, "Missing '{}' field in JSON.", constants::xTransactions));
+            }
+            // Manage limit
+            _result->hasNext = _result->transactions.size() >= constants::EXPLORER_QUERY_LIMIT;
+            return Either<Exception, std::shared_ptr<model::TransactionsBulk>>(_result);
+        }
+
+        void attach(const std::shared_ptr<api::HttpUrlConnection>& connection) {
+            _statusCode = connection->getStatusCode();
+            _statusText = connection->getStatusText();
+        }
+
+    private:
+        // True while inside an element of the top level transactions array
+        bool capturing() const {
+            return _inTransactions && _depth >= 3;
+        }
+
+        bool value(rapidjson::Value&& v) {
+            if (!capturing()) {
+                return true;
+            }
+            auto& parent = _values.back();
+            if (parent.IsObject()) {
+                parent.AddMember(_keys.back(), v, _allocator);
+                _keys.pop_back();
+            } else {
+                parent.PushBack(v, _allocator);
+            }
+            return true;
+        }
+
+        bool endContainer() {
+            if (!capturing()) {
+                _depth -= 1;
+                _closed = _depth == 0;
+                return true;
+            }
+            _depth -= 1;
+            rapidjson::Value completed(std::move(_values.back()));
+            _values.pop_back();
+            if (!_values.empty()) {
+                return value(std::move(completed));
+            }
+            // A whole transaction is available
+            try {
+                model::Transaction tx;
+                JsonParser::parseTransaction(completed.GetObject(), tx);
+                _result->transactions.push_back(std::move(tx));
+            } catch (const Exception& exception) {
+                _exception = exception;
+            }
+            completed.SetNull();
+            _allocator.Clear();
+            return _exception.isEmpty();
+        }
+
+        std::shared_ptr<model::TransactionsBulk> _result;
+        rapidjson::MemoryPoolAllocator<> _allocator;
+        std::vector<rapidjson::Value> _values;
+        std::vector<rapidjson::Value> _keys;
+        int _depth;
+        bool _inTransactions;
+        bool _inNextToken;
+        bool _hasTransactions;
+        bool _transactionsClosed;
+        bool _closed;
+        int32_t _statusCode;
+        std::string _statusText;
+        Option<Exception> _exception;
+    };
+
+} // namespace algorand
+} // namespace core
+} // namespace ledger
+
+#endif // LEDGER_CORE_ALGORANDTRANSACTIONSBULKPARSER_H
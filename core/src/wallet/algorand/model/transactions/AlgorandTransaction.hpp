@@ -126,6 +126,8 @@ namespace model {
     struct TransactionsBulk {
         std::vector<Transaction> transactions;
         bool hasNext;
+        // Indexer cursor of the next page of the same query
+        Option<std::string> nextToken;
     };
 
 } // namespace model
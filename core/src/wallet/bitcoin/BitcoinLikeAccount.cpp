@@ -37,9 +37,11 @@
 
 #include <memory>
 #include <utils/DateUtils.hpp>
+#include <math/FixedWidthInt.hpp>
 
 #include <wallet/common/Operation.h>
 #include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
+#include <wallet/bitcoin/database/BitcoinLikeDatabaseUtxoSource.hpp>
 #include <wallet/bitcoin/database/BitcoinLikeBlockDatabaseHelper.h>
 #include <wallet/common/database/OperationDatabaseHelper.h>
 #include <wallet/bitcoin/api_impl/BitcoinLikeOutputApi.h>
@@ -82,7 +84,6 @@ namespace ledger {
             _observer = observer;
             _synchronizer = synchronizer;
             _keychain = keychain;
-            _keychain->getAllObservableAddresses(0, 40);
             _picker = std::make_shared<BitcoinLikeStrategyUtxoPicker>(getWallet()->getPool()->getThreadPoolExecutionContext(), getWallet()->getCurrency());
             _currentBlockHeight = 0;
         }
@@ -133,12 +134,12 @@ namespace ledger {
                 // Extend input with derivation paths
 
                 if (input.address.nonEmpty() && input.value.nonEmpty()) {
-                    auto path = _keychain->getAddressDerivationPath(input.address.getValue());
+                    auto path = _keychain->getAddressDerivation(input.address.getValue());
                     if (path.nonEmpty()) {
                         // This address is part of the account.
                         sentAmount += input.value.getValue().toUint64();
-                        accountInputs.push_back(std::make_pair(const_cast<BitcoinLikeBlockchainExplorerInput *>(&input), DerivationPath(path.getValue())));
-                        if (_keychain->markPathAsUsed(DerivationPath(path.getValue()))) {
+                        accountInputs.push_back(std::make_pair(const_cast<BitcoinLikeBlockchainExplorerInput *>(&input), path.getValue()));
+                        if (_keychain->markPathAsUsed(path.getValue())) {
                             result = result | FLAG_TRANSACTION_ON_PREVIOUSLY_EMPTY_ADDRESS;
                         } else {
                             result = result | FLAG_TRANSACTION_ON_USED_ADDRESS;
@@ -156,9 +157,9 @@ namespace ledger {
             for (auto index = 0; index < outputCount; index++) {
                 auto& output = transaction.outputs[index];
                 if (output.address.nonEmpty()) {
-                    auto path = _keychain->getAddressDerivationPath(output.address.getValue());
+                    auto path = _keychain->getAddressDerivation(output.address.getValue());
                     if (path.nonEmpty()) {
-                        DerivationPath p(path.getValue());
+                        const auto& p = path.getValue();
                         accountOutputs.push_back(std::make_pair(const_cast<BitcoinLikeBlockchainExplorerOutput *>(&output), p));
                         if (p.getNonHardenedChildNum(nodeIndex) == 1) {
                             if (hasSpentNothing) {
@@ -171,7 +172,7 @@ namespace ledger {
                             receivedAmount += output.value.toUint64();
                             recipients.push_back(output.address.getValue());
                         }
-                        if (_keychain->markPathAsUsed(DerivationPath(path.getValue()))) {
+                        if (_keychain->markPathAsUsed(p)) {
                             result = result | FLAG_TRANSACTION_ON_PREVIOUSLY_EMPTY_ADDRESS;
                         } else {
                             result = result | FLAG_TRANSACTION_ON_USED_ADDRESS;
@@ -215,7 +216,6 @@ namespace ledger {
 
             if (accountOutputs.size() > 0) {
                 // Receive
-                BigInt amount;
                 auto flag = 0;
                 bool filterChangeAddresses = true;
 
@@ -223,16 +223,16 @@ namespace ledger {
                     filterChangeAddresses = false;
                 }
 
-                BigInt finalAmount;
+                uint64_t finalAmount = 0L;
                 auto accountOutputCount = 0;
                 for (auto& o : accountOutputs) {
                     if (filterChangeAddresses && o.second.getNonHardenedChildNum(nodeIndex) == 1)
                         continue;
-                    finalAmount = finalAmount + o.first->value;
+                    finalAmount += o.first->value.toUint64();
                     accountOutputCount += 1;
                 }
                 if (accountOutputCount > 0) {
-                    operation.amount = finalAmount;
+                    operation.amount = BigInt(static_cast<unsigned long long>(finalAmount));
                     operation.type = api::OperationType::RECEIVE;
                     operation.refreshUid();
                     if (OperationDatabaseHelper::putOperation(sql, operation))
@@ -389,6 +389,26 @@ namespace ledger {
             return _keychain->isEmpty();
         }
 
+        void BitcoinLikeAccount::stageLocalChanges() {
+            _keychain->stageUsedPaths();
+        }
+
+        size_t BitcoinLikeAccount::markLocalChanges() {
+            return _keychain->markUsedPaths();
+        }
+
+        void BitcoinLikeAccount::dropLocalChanges(size_t mark) {
+            _keychain->dropUsedPaths(mark);
+        }
+
+        void BitcoinLikeAccount::commitLocalChanges() {
+            _keychain->commitUsedPaths();
+        }
+
+        void BitcoinLikeAccount::discardLocalChanges() {
+            _keychain->discardUsedPaths();
+        }
+
         Future<AbstractAccount::AddressList> BitcoinLikeAccount::getFreshPublicAddresses() {
             auto keychain = getKeychain();
             return async<AbstractAccount::AddressList>([=] () -> AbstractAccount::AddressList {
@@ -420,17 +440,12 @@ namespace ledger {
             return async<std::shared_ptr<Amount>>([=] () -> std::shared_ptr<Amount> {
                 const auto& uid = self->getAccountUid();
                 soci::session sql(self->getWallet()->getDatabase()->getPool());
-                std::vector<BitcoinLikeBlockchainExplorerOutput> utxos;
-                BigInt sum(0);
                 auto keychain = self->getKeychain();
                 std::function<bool (const std::string&)> filter = [&keychain] (const std::string addr) -> bool {
                     return keychain->contains(addr);
                 };
-                BitcoinLikeUTXODatabaseHelper::queryUTXO(sql, uid, 0, std::numeric_limits<int32_t>::max(), utxos, filter);
-                for (const auto& utxo : utxos) {
-                    sum = sum + utxo.value;
-                }
-                Amount balance(self->getWallet()->getCurrency(), 0, sum);
+                auto sum = BitcoinLikeUTXODatabaseHelper::sumUTXO(sql, uid, filter);
+                Amount balance(self->getWallet()->getCurrency(), 0, sum.toBigInt());
                 self->getWallet()->updateBalanceCache(self->getIndex(), balance);
                 return std::make_shared<Amount>(balance);
             });
@@ -452,7 +467,7 @@ namespace ledger {
 
                 const auto &uid = self->getAccountUid();
                 soci::session sql(self->getWallet()->getDatabase()->getPool());
-                std::vector<Operation> operations;
+                std::vector<OperationAmount> operations;
 
                 auto keychain = self->getKeychain();
                 std::function<bool(const std::string &)> filter = [&keychain](const std::string addr) -> bool {
@@ -460,32 +475,32 @@ namespace ledger {
                 };
 
                 //Get operations related to an account
-                OperationDatabaseHelper::queryOperations(sql, uid, operations, filter);
+                OperationDatabaseHelper::queryOperationAmounts(sql, uid, operations, filter);
 
                 auto lowerDate = startDate;
                 auto upperDate = DateUtils::incrementDate(startDate, precision);
 
                 std::vector<std::shared_ptr<api::Amount>> amounts;
                 std::size_t operationsCount = 0;
-                BigInt sum;
+                Int256 sum;
                 while (lowerDate <= endDate && operationsCount < operations.size()) {
 
-                    auto operation = operations[operationsCount];
+                    auto& operation = operations[operationsCount];
                     while (operation.date > upperDate && lowerDate < endDate) {
                         lowerDate = DateUtils::incrementDate(lowerDate, precision);
                         upperDate = DateUtils::incrementDate(upperDate, precision);
                         amounts.emplace_back(
-                                std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                                std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                     }
 
                     if (operation.date <= upperDate) {
                         switch (operation.type) {
                             case api::OperationType::RECEIVE: {
-                                sum = sum + operation.amount;
+                                sum += Int256(operation.amount);
                                 break;
                             }
                             case api::OperationType::SEND: {
-                                sum = sum - (operation.amount + operation.fees.getValueOr(BigInt::ZERO));
+                                sum -= Int256(operation.amount + operation.fees);
                                 break;
                             }
                             case api::OperationType::NONE:
@@ -498,7 +513,7 @@ namespace ledger {
                 while (lowerDate < endDate) {
                     lowerDate = DateUtils::incrementDate(lowerDate, precision);
                     amounts.emplace_back(
-                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum));
+                            std::make_shared<ledger::core::Amount>(self->getWallet()->getCurrency(), 0, sum.toBigInt()));
                 }
 
                 return amounts;
@@ -571,9 +586,10 @@ namespace ledger {
                     txExplorer.confirmations = 0;
 
                     //Inputs
-                    auto inputCount = tx->getInputs().size();
+                    auto inputs = tx->getInputs();
+                    auto inputCount = inputs.size();
                     for (auto index = 0; index < inputCount; index++) {
-                        auto input = tx->getInputs()[index];
+                        auto &input = inputs[index];
                         BitcoinLikeBlockchainExplorerInput in;
                         in.index = index;
                         auto prevTxHash = input->getPreviousTxHash().value_or("");
@@ -593,9 +609,10 @@ namespace ledger {
 
                     //Outputs
                     auto keychain = self->getKeychain();
-                    auto outputCount = tx->getOutputs().size();
+                    auto outputs = tx->getOutputs();
+                    auto outputCount = outputs.size();
                     for (auto index = 0; index < outputCount; index++) {
-                        auto output = tx->getOutputs()[index];
+                        auto &output = outputs[index];
                         BitcoinLikeBlockchainExplorerOutput out;
                         out.value = BigInt(output->getValue()->toString());
                         out.time = DateUtils::toJSON(std::chrono::system_clock::now());
@@ -650,6 +667,12 @@ namespace ledger {
                 lastBlockHeight = getLastBlockFromDB(sql, self->getWallet()->getCurrency().name);
             }
 
+            Option<std::chrono::milliseconds> selectionTimeBudget;
+            auto configuredBudget = getWallet()->getConfig()->getInt(api::Configuration::UTXO_SELECTION_TIME_BUDGET);
+            if (configuredBudget) {
+                selectionTimeBudget = std::chrono::milliseconds(std::max(configuredBudget.value(), 0));
+            }
+
             return std::make_shared<BitcoinLikeTransactionBuilder>(
                     getMainExecutionContext(),
                     getWallet()->getCurrency(),
@@ -660,7 +683,13 @@ namespace ledger {
                                               _keychain,
                                               lastBlockHeight,
                                               logger(),
-                                              partial)
+                                              partial,
+                                              std::make_shared<BitcoinLikeDatabaseUtxoSource>(
+                                                      getWallet()->getDatabase(),
+                                                      getAccountUid(),
+                                                      getWallet()->getCurrency(),
+                                                      _keychain)),
+                    selectionTimeBudget
             );
         }
 
@@ -149,6 +149,13 @@ namespace ledger {
         protected:
             bool checkIfWalletIsEmpty();
 
+            // Paths marked as used while synchronization stages its changes are persisted once committed
+            void stageLocalChanges() override;
+            size_t markLocalChanges() override;
+            void dropLocalChanges(size_t mark) override;
+            void commitLocalChanges() override;
+            void discardLocalChanges() override;
+
         private:
             std::shared_ptr<BitcoinLikeAccount> getSelf();
             inline void inflateOperation(Operation& out,
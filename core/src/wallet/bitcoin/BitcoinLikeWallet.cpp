@@ -53,7 +53,8 @@ namespace ledger {
                                              const std::shared_ptr<DynamicObject>& configuration,
                                              const DerivationScheme& scheme
         )
-        : AbstractWallet(name, network, pool, configuration, scheme) {
+        : AbstractWallet(name, network, pool, configuration, scheme),
+          _accountScheme(DerivationScheme(scheme).setCoinType(network.bip44CoinType).getSchemeTo(DerivationSchemeLevel::ACCOUNT_INDEX)) {
             _explorer = explorer;
             _observer = observer;
             _keychainFactory = keychainFactory;
@@ -132,9 +133,7 @@ namespace ledger {
         FuturePtr<ledger::core::api::Account>
         BitcoinLikeWallet::newAccountWithExtendedKeyInfo(const api::ExtendedKeyAccountCreationInfo &info) {
             auto self = getSelf();
-            auto scheme = getDerivationScheme();
-            scheme.setCoinType(getCurrency().bip44CoinType).setAccountIndex(info.index);
-            auto xpubPath = scheme.getSchemeTo(DerivationSchemeLevel::ACCOUNT_INDEX).getPath();
+            auto xpubPath = getAccountDerivationPath(info.index);
             auto index = info.index;
             return async<std::shared_ptr<api::Account> >([=] () -> std::shared_ptr<api::Account> {
                 auto keychain = self->_keychainFactory->build(
@@ -172,14 +171,12 @@ namespace ledger {
             return async<api::ExtendedKeyAccountCreationInfo>([self, accountIndex] () -> api::ExtendedKeyAccountCreationInfo {
                 api::ExtendedKeyAccountCreationInfo info;
                 info.index = accountIndex;
-                auto scheme = self->getDerivationScheme();
-                scheme.setCoinType(self->getCurrency().bip44CoinType).setAccountIndex(accountIndex);;
                 auto keychainEngine = self->getConfiguration()->getString(api::Configuration::KEYCHAIN_ENGINE).value_or(api::ConfigurationDefaults::DEFAULT_KEYCHAIN);
                 if (keychainEngine == api::KeychainEngines::BIP32_P2PKH ||
                     keychainEngine == api::KeychainEngines::BIP49_P2SH ||
                     keychainEngine == api::KeychainEngines::BIP173_P2WPKH ||
                     keychainEngine == api::KeychainEngines::BIP173_P2WSH) {
-                    auto xpubPath = scheme.getSchemeTo(DerivationSchemeLevel::ACCOUNT_INDEX).getPath();
+                    auto xpubPath = self->getAccountDerivationPath(accountIndex);
                     info.derivations.push_back(xpubPath.toString());
                     info.owners.push_back(std::string("main"));
                 } else {
@@ -212,13 +209,16 @@ namespace ledger {
             return std::dynamic_pointer_cast<BitcoinLikeWallet>(shared_from_this());
         }
 
+        DerivationPath BitcoinLikeWallet::getAccountDerivationPath(int32_t accountIndex) const {
+            auto scheme = _accountScheme;
+            return scheme.setAccountIndex(accountIndex).getPath();
+        }
+
         std::shared_ptr<AbstractAccount>
         BitcoinLikeWallet::createAccountInstance(soci::session &sql, const std::string &accountUid) {
             BitcoinLikeAccountDatabaseEntry entry;
             BitcoinLikeAccountDatabaseHelper::queryAccount(sql, accountUid, entry);
-            auto scheme = getDerivationScheme();
-            scheme.setCoinType(getCurrency().bip44CoinType).setAccountIndex(entry.index);
-            auto xpubPath = scheme.getSchemeTo(DerivationSchemeLevel::ACCOUNT_INDEX).getPath();
+            auto xpubPath = getAccountDerivationPath(entry.index);
             auto keychain = _keychainFactory->restore(entry.index, xpubPath, getConfig(), entry.xpub,
             getAccountInternalPreferences(entry.index), getCurrency());
             return std::make_shared<BitcoinLikeAccount>(shared_from_this(),
@@ -82,12 +82,15 @@ namespace ledger {
 
         private:
             std::shared_ptr<BitcoinLikeWallet> getSelf();
+            DerivationPath getAccountDerivationPath(int32_t accountIndex) const;
 
         private:
             std::shared_ptr<BitcoinLikeBlockchainExplorer> _explorer;
             std::shared_ptr<BitcoinLikeBlockchainObserver> _observer;
             std::shared_ptr<BitcoinLikeKeychainFactory> _keychainFactory;
             BitcoinLikeAccountSynchronizerFactory _synchronizerFactory;
+            // Derivation scheme down to the account level, with the coin type of the wallet set
+            DerivationScheme _accountScheme;
         };
     }
 }
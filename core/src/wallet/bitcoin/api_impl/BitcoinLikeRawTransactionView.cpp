@@ -0,0 +1,257 @@
+/*
+ *
+ * BitcoinLikeRawTransactionView
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#include "BitcoinLikeRawTransactionView.h"
+#include <algorithm>
+#include <bytes/BytesReader.h>
+#include <crypto/SHA256.hpp>
+#include <wallet/bitcoin/networks.hpp>
+#include <utils/Exception.hpp>
+
+namespace ledger {
+    namespace core {
+
+        namespace {
+            std::string toHex(const uint8_t *data, size_t size, bool reversed) {
+                static const char DIGITS[] = "0123456789abcdef";
+                std::string out(size * 2, '0');
+                for (size_t i = 0; i < size; i++) {
+                    auto const byte = reversed ? data[size - 1 - i] : data[i];
+                    out[2 * i] = DIGITS[byte >> 4];
+                    out[2 * i + 1] = DIGITS[byte & 0x0F];
+                }
+                return out;
+            }
+
+            BitcoinLikeRawTransactionView::Slice readSlice(BytesReader &reader, uint64_t size) {
+                auto const offset = static_cast<uint32_t>(reader.getCursor());
+                reader.readView(size);
+                return BitcoinLikeRawTransactionView::Slice{offset, static_cast<uint32_t>(size)};
+            }
+
+            uint32_t offsetOf(const BytesReader &reader) {
+                return static_cast<uint32_t>(reader.getCursor());
+            }
+        }
+
+        BitcoinLikeRawTransactionView::BitcoinLikeRawTransactionView(const api::Currency &currency,
+                                                                     const std::vector<uint8_t> &rawTransaction,
+                                                                     int32_t currentBlockHeight,
+                                                                     bool isSigned)
+            : BitcoinLikeRawTransactionView(currency, rawTransaction.data(), rawTransaction.size(), currentBlockHeight, isSigned) {
+        }
+
+        BitcoinLikeRawTransactionView::BitcoinLikeRawTransactionView(const api::Currency &currency,
+                                                                     const uint8_t *rawTransaction,
+                                                                     size_t size,
+                                                                     int32_t currentBlockHeight,
+                                                                     bool isSigned)
+            : _data(rawTransaction), _size(size), _lockTime(0), _isSegwit(false), _markerOffset(0) {
+            BytesReader reader(rawTransaction, size);
+            // Parse version
+            _version = reader.readNextLeUint();
+            _params = &networks::getCachedNetworkParameters(currency.name, _version);
+            _isDecred = _params->Identifier == "dcr";
+            //Parse additionalBIPs if there are any
+            auto &additionalBIPs = _params->AdditionalBIPs;
+            if (std::find(additionalBIPs.begin(), additionalBIPs.end(), "ZIP") != additionalBIPs.end() &&
+                currentBlockHeight > networks::ZIP143_PARAMETERS.blockHeight) {
+                auto &zipParameters = currentBlockHeight > networks::ZIP_SAPLING_PARAMETERS.blockHeight ?
+                                      networks::ZIP_SAPLING_PARAMETERS : networks::ZIP143_PARAMETERS;
+                //Substract overwinterFlag
+                auto overwinterFlag = zipParameters.overwinterFlag[0];
+                _version -= (~(overwinterFlag << 24) + 1);
+
+                //Skip version group Id
+                reader.readView(zipParameters.versionGroupId.size());
+            }
+
+            // Parse timestamp
+            if (_params->UsesTimestampedTransaction) {
+                _timestamp = reader.readNextLeUint();
+            }
+
+            // Parse segwit marker and flag
+            _markerOffset = offsetOf(reader);
+            if (reader.hasNext() && reader.peek() == 0x00) {
+                _isSegwit = true;
+                reader.readView(2);
+            }
+
+            // Parse inputs
+            auto inputsCount = reader.readNextVarInt();
+            _inputs.reserve(std::min<uint64_t>(inputsCount, reader.available()));
+            for (uint64_t index = 0; index < inputsCount; index++) {
+                Input input{};
+                input.previousTxHash = readSlice(reader, 32);
+                input.outputIndex = reader.readNextLeUint();
+                //Decred has a tree field (1 bytes) and nothing else
+                if (_isDecred) {
+                    reader.readNextByte();
+                } else {
+                    auto const fieldOffset = offsetOf(reader);
+                    input.scriptSig = readSlice(reader, reader.readNextVarInt());
+                    input.scriptSigField = Slice{fieldOffset, offsetOf(reader) - fieldOffset};
+                }
+                input.sequence = reader.readNextLeUint();
+                _inputs.push_back(input);
+            }
+
+            // Parse outputs
+            auto outputsCount = reader.readNextVarInt();
+            _outputs.reserve(std::min<uint64_t>(outputsCount, reader.available()));
+            for (uint64_t index = 0; index < outputsCount; index++) {
+                Output output{};
+                output.value = reader.readNextLeUlong();
+                //Decred has an additional version script (2 byte)
+                if (_isDecred) {
+                    reader.readView(2);
+                }
+                output.script = readSlice(reader, reader.readNextVarInt());
+                _outputs.push_back(output);
+            }
+
+            //Decred has lockTime, expiry height and nb of witnesses before witness
+            if (_isDecred) {
+                _lockTime = reader.readNextLeUint();
+                //Expiry Height
+                reader.readView(4);
+                //Number of inputs
+                reader.readNextVarInt();
+            }
+            _prefixEnd = offsetOf(reader);
+
+            //Get witness if needed
+            if (isSigned && (_isSegwit || _isDecred)) {
+                for (auto &input : _inputs) {
+                    //Decred has no stack size on witness
+                    auto stackSize = _isDecred ? 2 : reader.readNextVarInt();
+                    if (stackSize != 0 && stackSize != 2) {
+                        throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
+                                             "Stack size not valid in signed segwit transaction");
+                    }
+
+                    if (stackSize == 2) {
+                        if (_isDecred) {
+                            //Amount, block height and block index
+                            reader.readView(8 + 4 + 4);
+                            //Whole script size
+                            reader.readNextVarInt();
+                        }
+                        auto const witnessOffset = offsetOf(reader);
+                        readSlice(reader, reader.readNextVarInt());
+                        input.witnessPublicKey = readSlice(reader, reader.readNextVarInt());
+                        input.witness = Slice{witnessOffset, offsetOf(reader) - witnessOffset};
+                    }
+                }
+            }
+
+            //Decred has lockTime before witness
+            if (!_isDecred) {
+                _lockTimeOffset = offsetOf(reader);
+                _lockTime = reader.readNextLeUint();
+            }
+        }
+
+        const api::BitcoinLikeNetworkParameters& BitcoinLikeRawTransactionView::getNetworkParameters() const {
+            return *_params;
+        }
+
+        uint32_t BitcoinLikeRawTransactionView::getVersion() const {
+            return _version;
+        }
+
+        Option<uint32_t> BitcoinLikeRawTransactionView::getTimestamp() const {
+            return _timestamp;
+        }
+
+        uint32_t BitcoinLikeRawTransactionView::getLockTime() const {
+            return _lockTime;
+        }
+
+        bool BitcoinLikeRawTransactionView::isSegwit() const {
+            return _isSegwit;
+        }
+
+        bool BitcoinLikeRawTransactionView::isDecred() const {
+            return _isDecred;
+        }
+
+        const std::vector<BitcoinLikeRawTransactionView::Input>& BitcoinLikeRawTransactionView::getInputs() const {
+            return _inputs;
+        }
+
+        const std::vector<BitcoinLikeRawTransactionView::Output>& BitcoinLikeRawTransactionView::getOutputs() const {
+            return _outputs;
+        }
+
+        std::vector<uint8_t> BitcoinLikeRawTransactionView::getBytes(const Slice &slice) const {
+            return std::vector<uint8_t>(_data + slice.offset, _data + slice.offset + slice.size);
+        }
+
+        std::string BitcoinLikeRawTransactionView::toHexString(const Slice &slice) const {
+            return toHex(_data + slice.offset, slice.size, false);
+        }
+
+        std::string BitcoinLikeRawTransactionView::getPreviousTxHash(const Input &input) const {
+            return toHex(_data + input.previousTxHash.offset, input.previousTxHash.size, true);
+        }
+
+        std::string BitcoinLikeRawTransactionView::computeHash() const {
+            std::vector<uint8_t> hashed;
+            hashed.reserve(_prefixEnd + 4);
+            auto append = [&] (uint32_t from, uint32_t to) {
+                hashed.insert(hashed.end(), _data + from, _data + to);
+            };
+
+            // Segwit marker and flag are not part of the transaction id
+            append(0, _markerOffset);
+            auto cursor = _isSegwit ? _markerOffset + 2 : _markerOffset;
+            // For XST the script sigs are replaced by empty scripts
+            // Reference: https://github.com/StealthSend/Stealth/commit/5be35d6c2c500b32ed82e5d6913d66d18a4b0a7f#diff-e8db9b851adc2422aadfffca88f14c91R566
+            if (_params->Identifier == "xst" && !_params->UsesTimestampedTransaction) {
+                for (auto &input : _inputs) {
+                    append(cursor, input.scriptSigField.offset);
+                    hashed.push_back(0x00);
+                    cursor = input.scriptSigField.offset + input.scriptSigField.size;
+                }
+            }
+            append(cursor, _prefixEnd);
+            if (_lockTimeOffset.hasValue()) {
+                append(_lockTimeOffset.getValue(), _lockTimeOffset.getValue() + 4);
+            }
+
+            // Double hash, to little endian
+            auto doubleHash = SHA256::bytesToBytesHash(SHA256::bytesToBytesHash(hashed));
+            return toHex(doubleHash.data(), doubleHash.size(), true);
+        }
+
+    }
+}
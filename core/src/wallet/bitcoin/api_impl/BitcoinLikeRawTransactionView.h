@@ -0,0 +1,119 @@
+/*
+ *
+ * BitcoinLikeRawTransactionView
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_BITCOINLIKERAWTRANSACTIONVIEW_H
+#define LEDGER_CORE_BITCOINLIKERAWTRANSACTIONVIEW_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <api/Currency.hpp>
+#include <api/BitcoinLikeNetworkParameters.hpp>
+#include <utils/Option.hpp>
+
+namespace ledger {
+    namespace core {
+
+        /**
+         * Structure of a raw Bitcoin like transaction, parsed in a single pass. The view doesn't copy the raw
+         * transaction: it only records where each field lives, fields are decoded when they are asked for.
+         * The raw transaction must outlive the view.
+         */
+        class BitcoinLikeRawTransactionView {
+        public:
+            // A range of bytes in the raw transaction
+            struct Slice {
+                uint32_t offset;
+                uint32_t size;
+            };
+
+            struct Input {
+                Slice previousTxHash; // Little endian
+                uint32_t outputIndex;
+                Slice scriptSigField; // Script sig with its var int size prefix (empty for Decred)
+                Slice scriptSig;
+                uint32_t sequence;
+                Slice witness; // <sig size> <sig> <pubkey size> <pubkey>, only for signed segwit or Decred
+                Slice witnessPublicKey;
+            };
+
+            struct Output {
+                uint64_t value;
+                Slice script;
+            };
+
+            BitcoinLikeRawTransactionView(const api::Currency &currency,
+                                          const uint8_t *rawTransaction,
+                                          size_t size,
+                                          int32_t currentBlockHeight,
+                                          bool isSigned);
+
+            BitcoinLikeRawTransactionView(const api::Currency &currency,
+                                          const std::vector<uint8_t> &rawTransaction,
+                                          int32_t currentBlockHeight,
+                                          bool isSigned);
+
+            const api::BitcoinLikeNetworkParameters& getNetworkParameters() const;
+            uint32_t getVersion() const;
+            Option<uint32_t> getTimestamp() const;
+            uint32_t getLockTime() const;
+            bool isSegwit() const;
+            bool isDecred() const;
+            const std::vector<Input>& getInputs() const;
+            const std::vector<Output>& getOutputs() const;
+
+            std::vector<uint8_t> getBytes(const Slice &slice) const;
+            std::string toHexString(const Slice &slice) const;
+            // Hex encoded, in the usual (reversed) order
+            std::string getPreviousTxHash(const Input &input) const;
+            // Transaction id (without witnesses), only meaningful for signed transactions
+            std::string computeHash() const;
+
+        private:
+            const uint8_t *_data;
+            size_t _size;
+            const api::BitcoinLikeNetworkParameters *_params;
+            uint32_t _version;
+            Option<uint32_t> _timestamp;
+            uint32_t _lockTime;
+            bool _isSegwit;
+            bool _isDecred;
+            uint32_t _markerOffset;
+            // End of the part hashed for the transaction id (lock time excepted)
+            uint32_t _prefixEnd;
+            Option<uint32_t> _lockTimeOffset;
+            std::vector<Input> _inputs;
+            std::vector<Output> _outputs;
+        };
+
+    }
+}
+
+#endif //LEDGER_CORE_BITCOINLIKERAWTRANSACTIONVIEW_H
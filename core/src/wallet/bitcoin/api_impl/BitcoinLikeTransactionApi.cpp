@@ -31,6 +31,7 @@
 #include "BitcoinLikeTransactionApi.h"
 #include <bytes/BytesWriter.h>
 #include <bytes/BytesReader.h>
+#include "BitcoinLikeRawTransactionView.h"
 #include <wallet/common/Amount.h>
 #include <wallet/common/AbstractAccount.hpp>
 #include <wallet/bitcoin/scripts/BitcoinLikeScript.h>
@@ -481,285 +482,131 @@ namespace ledger {
                                                        const std::vector<uint8_t> &rawTransaction,
                                                        int32_t currentBlockHeight,
                                                        bool isSigned) {
-            BytesReader reader(rawTransaction);
-            // Parse version
-            auto version = reader.readNextLeUint();
-            auto params = networks::getNetworkParameters(currency.name, version);
-            auto isDecred = params.Identifier == "dcr";
+            BitcoinLikeRawTransactionView view(currency, rawTransaction, currentBlockHeight, isSigned);
+            auto &params = view.getNetworkParameters();
+            auto isSegwit = view.isSegwit();
             HashAlgorithm hashAlgorithm(params.Identifier);
-            //Parse additionalBIPs if there are any
-            auto &additionalBIPs = params.AdditionalBIPs;
-            auto it = std::find(additionalBIPs.begin(), additionalBIPs.end(), "ZIP");
-            auto zipParameters = currentBlockHeight > networks::ZIP_SAPLING_PARAMETERS.blockHeight ?
-                                 networks::ZIP_SAPLING_PARAMETERS : networks::ZIP143_PARAMETERS;
-            if (it != additionalBIPs.end() &&
-                currentBlockHeight > networks::ZIP143_PARAMETERS.blockHeight) {
-                //Substract overwinterFlag
-                auto overwinterFlag = zipParameters.overwinterFlag[0];
-                version -= (~(overwinterFlag << 24) + 1);
-
-                //Read version group Id
-                reader.read(zipParameters.versionGroupId.size());
-            }
-
-            // Parse timestamp
-            auto usesTimeStamp = params.UsesTimestampedTransaction;
-            uint32_t timeStamp = 0;
-            if (usesTimeStamp) {
-                timeStamp = reader.readNextLeUint();
-            }
-
-            // Parse segwit marker and flag
-            bool isSegwit = false;
-            auto marker = reader.peek();
-            auto offsetToMarker = reader.getCursor();
-            if (marker == 0x00) {
-                isSegwit = true;
-                marker = reader.readNextByte();
-                auto flag = reader.readNextByte();
-            }
 
             auto keychainEngine = isSegwit ? api::KeychainEngines::BIP49_P2SH : api::KeychainEngines::BIP32_P2PKH;
             auto tx = std::make_shared<BitcoinLikeTransactionApi>(currency, keychainEngine, currentBlockHeight);
-            tx->setVersion(version);
-            if (usesTimeStamp) {
-                tx->setTimestamp(timeStamp);
+            tx->setVersion(view.getVersion());
+            if (view.getTimestamp().hasValue()) {
+                tx->setTimestamp(view.getTimestamp().getValue());
+            }
+            tx->setLockTime(view.getLockTime());
+            if (isSigned) {
+                tx->setHash(view.computeHash());
             }
 
-            // Parse inputs
-            std::vector<BitcoinLikePreparedInput> preparedInputs;
-            std::vector<std::vector<uint8_t>> scriptSigs;
-            auto inputsCount = reader.readNextVarInt();
-            for (auto index = 0; index < inputsCount; index++) {
-                //Previous Tx Hash in LE
-                auto prevTxHashBytes = reader.read(32);
-                std::reverse(prevTxHashBytes.begin(), prevTxHashBytes.end());
-                auto previousTxHash = hex::toString(prevTxHashBytes);
-                auto outputIndex = reader.readNextLeUint();
-
+            // Outputs
+            auto &outputs = view.getOutputs();
+            for (size_t index = 0; index < outputs.size(); index++) {
                 ledger::core::BitcoinLikeBlockchainExplorerOutput output;
+                output.index = static_cast<uint64_t>(index);
+                output.value = BigInt(static_cast<unsigned long long>(outputs[index].value));
+                auto lockScript = view.getBytes(outputs[index].script);
+                auto parsedScript = ledger::core::BitcoinLikeScript::parse(lockScript);
+                if (parsedScript.isSuccess()) {
+                    auto parsedAddress = parsedScript.getValue().parseAddress(currency);
+                    if (parsedAddress.hasValue())
+                        output.address = Option<std::string>(parsedAddress.getValue().toString());
+                }
+                output.script = hex::toString(lockScript);
+                tx->addOutput(std::shared_ptr<BitcoinLikeOutputApi>(new BitcoinLikeOutputApi(
+                        output, currency
+                )));
+            }
+
+            // Inputs
+            for (auto &input : view.getInputs()) {
+                auto previousTxHash = view.getPreviousTxHash(input);
                 std::string address;
                 std::vector<std::vector<uint8_t>> pubKeys;
+                // Script of the spent output as known from this transaction (script sig or witness)
+                std::vector<uint8_t> script;
 
-                //Decred has a tree field (1 bytes) and nothing else
-                if (isDecred) {
-                    reader.readNextByte();
-                } else {
-                    auto scriptSize = reader.readNextVarInt();
-                    auto scriptSig = reader.read(scriptSize);
+                if (!view.isDecred()) {
+                    auto scriptSig = view.getBytes(input.scriptSig);
                     auto parsedScript = ledger::core::BitcoinLikeScript::parse(scriptSig);
                     if (parsedScript.isSuccess()) {
-
-                        // Useful to remove script sigs from rawTx to compute txHash (e.g. XST)
-                        {
-                            BytesWriter localWriter;
-                            localWriter.writeVarInt(scriptSize);
-                            localWriter.writeByteArray(scriptSig);
-                            scriptSigs.emplace_back(localWriter.toByteArray());
-                        }
-
-                        BytesReader localReader(scriptSig);
+                        BytesReader localReader(scriptSig.data(), scriptSig.size());
                         if (isSigned && !isSegwit) {
                             //Get address from signed script
                             auto sigSize = localReader.readNextVarInt();
-                            auto sig = localReader.read(sigSize);
+                            localReader.readView(sigSize);
                             // For example XST, sometimes does not have pubKey in signature ... (e.g. 6a1e7109ce7cae649c2f79200c946622f97ea6c86b2366cbbb7a512acdb3c1c2)
-                            if (scriptSize - sigSize > 1) {
+                            if (scriptSig.size() - sigSize > 1) {
                                 auto pubKeySize = localReader.readNextVarInt();
                                 auto pubKey = localReader.read(pubKeySize);
-                                pubKeys.push_back(pubKey);
                                 BitcoinLikeAddress localAddress(currency,
                                                                 HASH160::hash(pubKey, hashAlgorithm),
                                                                 api::KeychainEngines::BIP32_P2PKH);
                                 address = localAddress.toBase58();
+                                pubKeys.push_back(std::move(pubKey));
                             }
-                            output.script = hex::toString(scriptSig);
+                            script = std::move(scriptSig);
                         } else if (isSigned && isSegwit && !scriptSig.empty()) {
                             //Get address from redeem script
                             auto redeemScriptSize = localReader.readNextVarInt();
                             auto redeemScript = localReader.read(redeemScriptSize);
                             //Get pubKeys from Redeem script : 0x00 0x14 <pubKey>
-                            std::vector<uint8_t> pubKey(redeemScript.begin() + 2, redeemScript.end());
-                            pubKeys.push_back(pubKey);
+                            pubKeys.emplace_back(redeemScript.begin() + 2, redeemScript.end());
                             BitcoinLikeAddress localAddress(currency,
                                                             HASH160::hash(redeemScript, hashAlgorithm),
                                                             api::KeychainEngines::BIP49_P2SH);
                             address = localAddress.toBase58();
-
                         } else {
                             auto parsedAddress = parsedScript.getValue().parseAddress(currency);
                             if (parsedAddress.hasValue()) {
                                 address = parsedAddress.getValue().toString();
                             }
-                            output.script = hex::toString(parsedScript.getValue().serialize());
+                            script = parsedScript.getValue().serialize();
                         }
                     }
                 }
-                auto sequence = reader.readNextLeUint();
-                output.address = address;
-                output.transactionHash = previousTxHash;
-                output.index = outputIndex;
-                preparedInputs.emplace_back(BitcoinLikePreparedInput(sequence, address, previousTxHash, outputIndex, pubKeys, output));
-            }
 
-            // Parse outputs
-            auto outputsCount = reader.readNextVarInt();
-            for (auto index = 0; index < outputsCount; index++) {
-                ledger::core::BitcoinLikeBlockchainExplorerOutput output;
-                output.index = static_cast<uint64_t>(index);
-                output.value = reader.readNextLeBigInt(8);
-                //Decred has an additional version script (2 byte)
-                if (isDecred) {
-                    reader.read(2);
-                }
-                auto scriptSize = reader.readNextVarInt();
-                auto lockScript = reader.read(scriptSize);
-                auto parsedScript = ledger::core::BitcoinLikeScript::parse(lockScript);
-                if (parsedScript.isSuccess()) {
-                    auto parsedAddress = parsedScript.getValue().parseAddress(currency);
-                    if (parsedAddress.hasValue())
-                        output.address = Option<std::string>(parsedAddress.getValue().toString());
-                }
-                output.script = hex::toString(lockScript);
-                tx->addOutput(std::shared_ptr<BitcoinLikeOutputApi>(new BitcoinLikeOutputApi(
-                        output, currency
-                )));
-            }
-
-            //Decred has lockTime, expiry height and nb of witnesses before witness
-            if (isDecred) {
-                //LockTime
-                tx->setLockTime(reader.readNextLeUint());
-                //Expiry Height
-                reader.read(4);
-                //Number of inputs
-                reader.readNextVarInt();
-            }
-
-            //This will usefull to computes tx hash (txID)
-            std::vector<uint8_t> modifTx(rawTransaction.begin(), rawTransaction.begin() + reader.getCursor());
-
-            // For XST we should remove the script sigs
-            // Reference: https://github.com/StealthSend/Stealth/commit/5be35d6c2c500b32ed82e5d6913d66d18a4b0a7f#diff-e8db9b851adc2422aadfffca88f14c91R566
-            if (params.Identifier == "xst" && !usesTimeStamp) {
-                auto strRawTx = hex::toString(modifTx);
-                auto removeScriptSig = [] (std::string &rawTx, const std::string &scriptSig) {
-                    size_t pos = rawTx.find(scriptSig);
-                    if (pos != std::string::npos) {
-                        rawTx.erase(pos, scriptSig.length());
-                        rawTx.insert(pos, "00");
+                if (input.witness.size > 0) {
+                    script = view.getBytes(input.witness);
+                    // Get address, if not recovered yet
+                    // This is only possible in case of BIP173_P2WPKH or BIP173_P2WSH
+                    // For BIP32_P2PKH it is recovered from scriptPubKey (see above)
+                    // For BIP49_P2SH it is recovered from redeemScript (see above)
+                    // Note: Decred does not support segwit
+                    if (isSegwit && address.empty()) {
+                        auto pubKey = view.getBytes(input.witnessPublicKey);
+                        // Get keychain engine
+                        // BIP173_P2WPKH script : <sig> <pubKey> (with <pubKey>.size() == 33)
+                        // BIP173_P2WSH script : <sig> <witness>
+                        auto keychain = pubKey.size() == 33 ? api::KeychainEngines::BIP173_P2WPKH : api::KeychainEngines::BIP173_P2WSH;
+                        // Get hash160 to construct address
+                        auto hash160 = BitcoinLikeAddress::fromPublicKeyToHash160(pubKey, currency, keychain);
+                        address = BitcoinLikeAddress(currency, hash160, keychain).toString();
                     }
-                };
-                for (auto &scriptSig : scriptSigs) {
-                    removeScriptSig(strRawTx, hex::toString(scriptSig));
                 }
-                modifTx = hex::toByteArray(strRawTx);
-            }
-
-            // Remove marker and flag if segwit
-            if (isSegwit) {
-                modifTx.erase(modifTx.begin() + offsetToMarker, modifTx.begin() + offsetToMarker + 2);
-            }
-
-            //Get witness if needed
-            if (isSigned && (isSegwit || isDecred)) {
-                for (auto index = 0; index < inputsCount; index++) {
-                    //Decred has no stack size on witness
-                    auto stackSize = isDecred ? 2 : reader.readNextVarInt();
-                    if (stackSize != 0 && stackSize != 2) {
-                        throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
-                                             "Stack size not valid in signed segwit transaction");
-                    }
-
-                    if (stackSize == 2) {
-
-                        if (isDecred) {
-                            //Amount
-                            reader.read(8);
-                            //Block height
-                            reader.read(4);
-                            //Block Index
-                            reader.read(4);
-                            //Whole script size
-                            reader.readNextVarInt();
-                        }
 
-                        auto scriptSigSize = reader.readNextVarInt();
-                        auto scriptSig = reader.read(scriptSigSize);
-                        auto pubKeySize = reader.readNextVarInt();
-                        auto pubKey = reader.read(pubKeySize);
-
-                        //Get script sig
-                        BytesWriter writer;
-                        writer.writeVarInt(scriptSigSize);
-                        writer.writeByteArray(scriptSig);
-                        writer.writeVarInt(pubKeySize);
-                        writer.writeByteArray(pubKey);
-                        preparedInputs[index].output.script = hex::toString(writer.toByteArray());
-
-                        // Get address, if not recovered yet
-                        // This is only possible in case of BIP173_P2WPKH or BIP173_P2WSH
-                        // For BIP32_P2PKH it is recovered from scriptPubKey (see above)
-                        // For BIP49_P2SH it is recovered from redeemScript (see above)
-                        // Note: Decred does not support segwit
-                        auto outAddress = preparedInputs[index].address;
-                        if (isSegwit && preparedInputs[index].address.empty()) {
-                            // Get keychain engine
-                            // BIP173_P2WPKH script : <sig> <pubKey> (with <pubKey>.size() == 33)
-                            // BIP173_P2WSH script : <sig> <witness>
-                            auto keychain = pubKey.size() == 33 ? api::KeychainEngines::BIP173_P2WPKH : api::KeychainEngines::BIP173_P2WSH;
-                            // Get hash160 to construct address
-                            auto hash160 = BitcoinLikeAddress::fromPublicKeyToHash160(pubKey, currency, keychain);
-                            preparedInputs[index].address = BitcoinLikeAddress(currency, hash160, keychain).toString();
-                        }
-                    }
-                }
-            }
-
-
-            //Decred has lockTime before witness
-            if (!isDecred) {
-                auto timelock = reader.read(4);
-                modifTx = vector::concat(modifTx, timelock);
-
-                BytesReader timelockReader(timelock);
-                tx->setLockTime(timelockReader.readNextLeUint());
-            }
-
-            if (isSigned) {
-                auto modifTxStr = hex::toString(modifTx);
-                // Double hash
-                auto doubleHash = SHA256::bytesToBytesHash(SHA256::bytesToBytesHash(modifTx));
-                // To little endian
-                std::reverse(doubleHash.begin(), doubleHash.end());
-                tx->setHash(hex::toString(doubleHash));
-            }
-
-
-            //Finally append inputs to tx
-            for (auto i = 0; i < inputsCount; i++) {
-                auto keychainEngine = isSegwit ? api::KeychainEngines::BIP49_P2SH : api::KeychainEngines::BIP32_P2PKH;
-                std::vector<uint8_t> scriptSig;
-                std::vector<std::vector<uint8_t>> pubKeys;
-                if (isSigned) {
-                    scriptSig = hex::toByteArray(preparedInputs[i].output.script);
-                    pubKeys = preparedInputs[i].pubKeys;
+                ledger::core::BitcoinLikeBlockchainExplorerOutput output;
+                output.address = address;
+                output.transactionHash = previousTxHash;
+                output.index = input.outputIndex;
+                output.script = hex::toString(script);
+                if (!isSigned) {
+                    script.clear();
+                    pubKeys.clear();
                 }
                 tx->addInput(
                         std::shared_ptr<BitcoinLikeWritableInputApi>(
                                 new BitcoinLikeWritableInputApi(nullptr,
                                                                 nullptr,
-                                                                preparedInputs[i].sequence,
+                                                                input.sequence,
                                                                 pubKeys,
                                                                 {},
-                                                                preparedInputs[i].address,
+                                                                address,
                                                                 nullptr,
-                                                                preparedInputs[i].previousTxHash,
-                                                                preparedInputs[i].outputIndex,
-                                                                scriptSig,
+                                                                previousTxHash,
+                                                                input.outputIndex,
+                                                                script,
                                                                 std::shared_ptr<BitcoinLikeOutputApi>(
-                                                                        new BitcoinLikeOutputApi(
-                                                                                preparedInputs[i].output, currency)),
+                                                                        new BitcoinLikeOutputApi(output, currency)),
                                                                 keychainEngine
                                 )
                         )
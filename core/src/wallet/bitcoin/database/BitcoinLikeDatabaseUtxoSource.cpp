@@ -0,0 +1,60 @@
+/*
+ *
+ * BitcoinLikeDatabaseUtxoSource
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "BitcoinLikeDatabaseUtxoSource.hpp"
+#include "BitcoinLikeUTXODatabaseHelper.h"
+
+namespace ledger {
+    namespace core {
+
+        BitcoinLikeDatabaseUtxoSource::BitcoinLikeDatabaseUtxoSource(const std::shared_ptr<DatabaseSessionPool>& database,
+                                                                     const std::string& accountUid,
+                                                                     const api::Currency& currency,
+                                                                     const std::shared_ptr<BitcoinLikeKeychain>& keychain)
+            : _database(database), _accountUid(accountUid), _currency(currency), _keychain(keychain) {
+
+        }
+
+        void BitcoinLikeDatabaseUtxoSource::stream(BitcoinLikeUtxoOrder order,
+                                                   const std::function<bool (const BitcoinLikeUtxoRow&)>& visitor) {
+            soci::session session(_database->getPool());
+            BitcoinLikeUTXODatabaseHelper::streamUtxos(session, _accountUid, order, [&] (const BitcoinLikeUtxoRow& row, const std::string& address) {
+                return !_keychain->contains(address) || visitor(row);
+            });
+        }
+
+        std::vector<BitcoinLikeUtxo> BitcoinLikeDatabaseUtxoSource::resolve(const std::vector<BitcoinLikeUtxoRow>& rows) {
+            soci::session session(_database->getPool());
+            return BitcoinLikeUTXODatabaseHelper::queryUtxos(session, _accountUid, _currency, rows);
+        }
+
+    }
+}
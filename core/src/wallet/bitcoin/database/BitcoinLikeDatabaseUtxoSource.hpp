@@ -0,0 +1,66 @@
+/*
+ *
+ * BitcoinLikeDatabaseUtxoSource
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <api/Currency.hpp>
+#include <database/DatabaseSessionPool.hpp>
+#include <wallet/bitcoin/keychains/BitcoinLikeKeychain.hpp>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoSource.hpp>
+
+namespace ledger {
+    namespace core {
+
+        // Unspent outputs of an account read from its database, restricted to the addresses of its keychain
+        class BitcoinLikeDatabaseUtxoSource : public BitcoinLikeUtxoSource {
+        public:
+            BitcoinLikeDatabaseUtxoSource(const std::shared_ptr<DatabaseSessionPool>& database,
+                                          const std::string& accountUid,
+                                          const api::Currency& currency,
+                                          const std::shared_ptr<BitcoinLikeKeychain>& keychain);
+
+            void stream(BitcoinLikeUtxoOrder order,
+                        const std::function<bool (const BitcoinLikeUtxoRow&)>& visitor) override;
+
+            std::vector<BitcoinLikeUtxo> resolve(const std::vector<BitcoinLikeUtxoRow>& rows) override;
+
+        private:
+            std::shared_ptr<DatabaseSessionPool> _database;
+            std::string _accountUid;
+            api::Currency _currency;
+            std::shared_ptr<BitcoinLikeKeychain> _keychain;
+        };
+
+    }
+}
@@ -34,6 +34,7 @@
 #include <database/soci-option.h>
 #include <database/soci-date.h>
 #include <database/soci-number.h>
+#include <database/BulkDatabaseHelper.hpp>
 
 #include <iostream>
 using namespace std;
@@ -88,84 +89,94 @@ namespace ledger {
                         use(tx.receivedAt),
                         use(tx.lockTime);
                 // Insert inputs
-                bool replaceable = false;
-                for (const auto& input : tx.inputs) {
-                    insertInput(sql, btcTxUid, accountUid, tx.hash, input);
-                    replaceable = replaceable || (input.sequence < std::numeric_limits<uint32_t>::max());
-                }
+                insertInputs(sql, btcTxUid, accountUid, tx);
+                bool replaceable = std::any_of(tx.inputs.begin(), tx.inputs.end(), [] (const BitcoinLikeBlockchainExplorerInput& input) {
+                    return input.sequence < std::numeric_limits<uint32_t>::max();
+                });
                 // Insert outputs
-                for (const auto& output : tx.outputs) {
-                    insertOutput(sql, btcTxUid, accountUid, tx.hash, output, replaceable && blockUid.isEmpty());
-                }
+                insertOutputs(sql, btcTxUid, accountUid, tx, replaceable && blockUid.isEmpty());
                 return btcTxUid;
             }
         }
 
-        void BitcoinLikeTransactionDatabaseHelper::insertOutput(soci::session &sql,
-                                                                const std::string& btcTxUid,
-                                                                const std::string &accountUid,
-                                                                const std::string& transactionHash,
-                                                                const BitcoinLikeBlockchainExplorerOutput &output,
-                                                                bool replaceable) {
-            auto value = output.value.toUint64();
-            int replaceableInt = replaceable ? 1 : 0;
-            if (output.accountUid.hasValue() && output.accountUid.getValue() == accountUid) {
-                sql << "INSERT INTO bitcoin_outputs VALUES(:idx, :tx_uid, :hash, :amount, :script, :address, "
-                       ":account_uid, :block_height, :replaceable)",
-                        use(output.index), use(btcTxUid),
-                        use(transactionHash), use(value),
-                        use(output.script), use(output.address),
-                        use(accountUid), use(output.blockHeight),
-                        use(replaceableInt);
-            } else {
-                sql << "INSERT INTO bitcoin_outputs VALUES(:idx, :tx_uid, :hash, :amount, :script, :address, NULL, "
-                       ":block_height, :replaceable)",
-                        use(output.index), use(btcTxUid),
-                        use(transactionHash), use(value),
-                        use(output.script), use(output.address),
-                        use(output.blockHeight), use(replaceableInt);
+        void BitcoinLikeTransactionDatabaseHelper::insertOutputs(soci::session &sql,
+                                                                 const std::string& btcTxUid,
+                                                                 const std::string &accountUid,
+                                                                 const BitcoinLikeBlockchainExplorerTransaction &tx,
+                                                                 bool replaceable) {
+            struct OutputRow {
+                const BitcoinLikeBlockchainExplorerOutput *output;
+                uint64_t value;
+                // NULL when the output does not belong to the account
+                Option<std::string> accountUid;
+            };
+            std::vector<OutputRow> rows;
+            rows.reserve(tx.outputs.size());
+            for (const auto& output : tx.outputs) {
+                Option<std::string> outputAccountUid;
+                if (output.accountUid.hasValue() && output.accountUid.getValue() == accountUid) {
+                    outputAccountUid = accountUid;
+                }
+                rows.push_back(OutputRow {&output, output.value.toUint64(), outputAccountUid});
             }
+            int replaceableInt = replaceable ? 1 : 0;
+            BulkDatabaseHelper::insert(sql, "bitcoin_outputs", 9, rows, [&] (BulkDatabaseHelper::Statement &statement, const OutputRow &row) {
+                statement, use(row.output->index), use(btcTxUid), use(tx.hash), use(row.value),
+                        use(row.output->script), use(row.output->address), use(row.accountUid),
+                        use(row.output->blockHeight), use(replaceableInt);
+            });
         }
 
-        void BitcoinLikeTransactionDatabaseHelper::insertInput(soci::session &sql,
-                                                               const std::string& btcTxUid,
-                                                               const std::string& accountUid,
-                                                               const std::string& transactionHash,
-                                                               const BitcoinLikeBlockchainExplorerInput &input) {
-            /*
-             * In case transactions are issued with respect to zero knowledge protocol,
-             * previousTxHash is empty which causes conflict in bitcoin_inputs table
-             * Right now we generate a random 'hash' to compute inputUid, should be improved
-             * (e.g. use scriptSig of each input and sha256 it ...)
-            */
-            std::string hash;
-
-            //Returned by explorers when tx from zk protocol
-            std::string emptyPreviousTxHash = "0000000000000000000000000000000000000000000000000000000000000000";
-            auto previousTxHash = input.previousTxHash.getValueOr(emptyPreviousTxHash);
-            if (previousTxHash == emptyPreviousTxHash && input.signatureScript.nonEmpty()) {
-                previousTxHash =  SHA256::stringToHexHash(input.signatureScript.getValue());
-            }
+        void BitcoinLikeTransactionDatabaseHelper::insertInputs(soci::session &sql,
+                                                                const std::string& btcTxUid,
+                                                                const std::string& accountUid,
+                                                                const BitcoinLikeBlockchainExplorerTransaction &tx) {
+            struct InputRow {
+                const BitcoinLikeBlockchainExplorerInput *input;
+                std::string uid;
+                std::string prevBtcTxUid;
+                Option<uint64_t> amount;
+            };
+            std::vector<InputRow> rows;
+            rows.reserve(tx.inputs.size());
+            for (const auto& input : tx.inputs) {
+                /*
+                 * In case transactions are issued with respect to zero knowledge protocol,
+                 * previousTxHash is empty which causes conflict in bitcoin_inputs table
+                 * Right now we generate a random 'hash' to compute inputUid, should be improved
+                 * (e.g. use scriptSig of each input and sha256 it ...)
+                */
+                //Returned by explorers when tx from zk protocol
+                std::string emptyPreviousTxHash = "0000000000000000000000000000000000000000000000000000000000000000";
+                auto previousTxHash = input.previousTxHash.getValueOr(emptyPreviousTxHash);
+                if (previousTxHash == emptyPreviousTxHash && input.signatureScript.nonEmpty()) {
+                    previousTxHash =  SHA256::stringToHexHash(input.signatureScript.getValue());
+                }
 
-            auto uid = createInputUid(accountUid,
-                                      input.previousTxOutputIndex.getValueOr(0),
-                                      previousTxHash,
-                                      input.coinbase.getValueOr(""));
+                auto uid = createInputUid(accountUid,
+                                          input.previousTxOutputIndex.getValueOr(0),
+                                          previousTxHash,
+                                          input.coinbase.getValueOr(""));
 
-            auto amount = input.value.map<uint64_t>([] (const BigInt& v) {
-                return v.toUint64();
-            });
+                auto amount = input.value.map<uint64_t>([] (const BigInt& v) {
+                    return v.toUint64();
+                });
 
-            std::string prevBtcTxUid;
-            if (input.previousTxHash.nonEmpty() && input.previousTxHash.getValue() != emptyPreviousTxHash) {
-                prevBtcTxUid = createBitcoinTransactionUid(accountUid, input.previousTxHash.getValue());
+                std::string prevBtcTxUid;
+                if (input.previousTxHash.nonEmpty() && input.previousTxHash.getValue() != emptyPreviousTxHash) {
+                    prevBtcTxUid = createBitcoinTransactionUid(accountUid, input.previousTxHash.getValue());
+                }
+                rows.push_back(InputRow {&input, uid, prevBtcTxUid, amount});
             }
 
-            sql << "INSERT INTO bitcoin_inputs VALUES(:uid, :idx, :hash, :prev_tx_uid, :amount, :address, :coinbase, :sequence)",
-                    use(uid), use(input.previousTxOutputIndex), use(input.previousTxHash), use(prevBtcTxUid), use(amount),
-                    use(input.address), use(input.coinbase), use(input.sequence);
-            sql << "INSERT INTO bitcoin_transaction_inputs VALUES(:tx_uid, :tx_hash, :input_uid, :input_idx)",
-                    use(btcTxUid), use(transactionHash), use(uid), use(input.index);
+            BulkDatabaseHelper::insert(sql, "bitcoin_inputs", 8, rows, [] (BulkDatabaseHelper::Statement &statement, const InputRow &row) {
+                statement, use(row.uid), use(row.input->previousTxOutputIndex), use(row.input->previousTxHash),
+                        use(row.prevBtcTxUid), use(row.amount), use(row.input->address), use(row.input->coinbase),
+                        use(row.input->sequence);
+            });
+            BulkDatabaseHelper::insert(sql, "bitcoin_transaction_inputs", 4, rows, [&] (BulkDatabaseHelper::Statement &statement, const InputRow &row) {
+                statement, use(btcTxUid), use(tx.hash), use(row.uid), use(row.input->index);
+            });
         }
 
         std::string BitcoinLikeTransactionDatabaseHelper::createInputUid(const std::string& accountUid,
@@ -287,21 +298,24 @@ namespace ledger {
 
         void BitcoinLikeTransactionDatabaseHelper::removeAllMempoolOperation(soci::session &sql,
                                                                              const std::string &accountUid) {
+            // Transactions only stay reachable from the account through its operations, gather them first
             rowset<std::string> rows = (sql.prepare <<
-                    "SELECT transaction_uid FROM bitcoin_operations AS bop "
-                    "JOIN operations AS op ON bop.uid = op.uid "
+                    "SELECT bop.transaction_uid FROM bitcoin_operations AS bop "
+                    "JOIN operations AS op ON op.uid = bop.uid "
                     "WHERE op.account_uid = :uid AND op.block_uid IS NULL", use(accountUid)
             );
             std::vector<std::string> txToDelete(rows.begin(), rows.end());
-            if (!txToDelete.empty()) {
-                sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
-                       "SELECT input_uid FROM bitcoin_transaction_inputs "
-                       "WHERE transaction_uid IN(:uids)"
-                       ")", use(txToDelete);
-                sql << "DELETE FROM operations WHERE account_uid = :uid AND block_uid is NULL", use(accountUid);
-                sql << "DELETE FROM bitcoin_transactions "
-                       "WHERE transaction_uid IN (:uids)", use(txToDelete);
+            if (txToDelete.empty()) {
+                return;
             }
+            sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
+                   "SELECT ti.input_uid FROM bitcoin_transaction_inputs AS ti "
+                   "JOIN bitcoin_operations AS bop ON bop.transaction_uid = ti.transaction_uid "
+                   "JOIN operations AS op ON op.uid = bop.uid "
+                   "WHERE op.account_uid = :uid AND op.block_uid IS NULL"
+                   ")", use(accountUid);
+            sql << "DELETE FROM operations WHERE account_uid = :uid AND block_uid IS NULL", use(accountUid);
+            sql << "DELETE FROM bitcoin_transactions WHERE transaction_uid IN (:uids)", use(txToDelete);
         }
 
     }
@@ -42,17 +42,16 @@ namespace ledger {
             static std::string putTransaction(soci::session& sql,
                                               const std::string &accountUid,
                                               const BitcoinLikeBlockchainExplorerTransaction& tx);
-            static inline void insertOutput(soci::session& sql,
+            // Inputs and outputs of a transaction are inserted with one multi-row statement per table
+            static inline void insertOutputs(soci::session& sql,
+                                             const std::string& btcTxUid,
+                                             const std::string &accountUid,
+                                             const BitcoinLikeBlockchainExplorerTransaction& tx,
+                                             bool replaceable);
+            static inline void insertInputs(soci::session& sql,
                                             const std::string& btcTxUid,
-                                            const std::string &accountUid,
-                                            const std::string& transactionHash,
-                                            const BitcoinLikeBlockchainExplorerOutput& output,
-                                            bool replaceable);
-            static inline void insertInput(soci::session& sql,
-                                           const std::string& btcTxUid,
-                                           const std::string& accountUid,
-                                           const std::string& transactionHash,
-                                           const BitcoinLikeBlockchainExplorerInput& input);
+                                            const std::string& accountUid,
+                                            const BitcoinLikeBlockchainExplorerTransaction& tx);
 
             static std::string createInputUid(const std::string& accountUid, int32_t previousOutputIndex, const std::string& previousTxHash, const std::string& coinbase);
             static std::string createBitcoinTransactionUid(const std::string& accountUid, const std::string& txHash);
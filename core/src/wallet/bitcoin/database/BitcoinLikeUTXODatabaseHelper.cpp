@@ -33,8 +33,13 @@
 #include "BitcoinLikeUTXODatabaseHelper.h"
 #include <database/soci-number.h>
 #include <database/soci-option.h>
+#include <database/BulkDatabaseHelper.hpp>
+#include <utils/Exception.hpp>
 #include <utils/Option.hpp>
 
+#include <algorithm>
+#include <map>
+
 using namespace soci;
 
 namespace ledger {
@@ -55,6 +60,23 @@ namespace ledger {
             return count;
         }
 
+        UInt256 BitcoinLikeUTXODatabaseHelper::sumUTXO(soci::session &sql, const std::string &accountUid,
+                                                       std::function<bool(const std::string &address)> filter) {
+            rowset<row> rows = (sql.prepare <<
+                                            "SELECT o.address, o.amount FROM bitcoin_outputs AS o "
+                                                    " LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid "
+                                                    " AND i.previous_output_idx = o.idx"
+                                                    " WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid",
+                                                    use(accountUid));
+            UInt256 sum;
+            for (auto& row : rows) {
+                if (row.get_indicator(0) != i_null && filter(row.get<std::string>(0))) {
+                    sum += UInt256(get_number<uint64_t>(row, 1));
+                }
+            }
+            return sum;
+        }
+
         std::size_t
         BitcoinLikeUTXODatabaseHelper::queryUTXO(soci::session &sql, const std::string &accountUid, int32_t offset,
                                                  int32_t count, std::vector<BitcoinLikeBlockchainExplorerOutput> &out,
@@ -120,5 +142,102 @@ namespace ledger {
 
             return utxos;
         }
+
+        void BitcoinLikeUTXODatabaseHelper::streamUtxos(
+            soci::session &session, std::string const &accountUid, BitcoinLikeUtxoOrder order,
+            std::function<bool (const BitcoinLikeUtxoRow& row, const std::string& address)> const &visitor)
+        {
+            std::string ordering;
+            switch (order) {
+                case BitcoinLikeUtxoOrder::DEEP_FIRST:
+                    ordering = "o.block_height IS NULL, o.block_height";
+                    break;
+                case BitcoinLikeUtxoOrder::LARGEST_FIRST:
+                    ordering = "o.amount DESC";
+                    break;
+                case BitcoinLikeUtxoOrder::SMALLEST_FIRST:
+                    ordering = "o.amount";
+                    break;
+            }
+
+            soci::rowset<soci::row> rows = (
+                session.prepare <<
+                    "SELECT o.address, o.idx, o.transaction_hash, o.amount, o.block_height "
+                    "FROM bitcoin_outputs AS o "
+                    "LEFT OUTER JOIN bitcoin_inputs AS i ON i.previous_tx_uid = o.transaction_uid AND i.previous_output_idx = o.idx "
+                    "WHERE i.previous_tx_uid IS NULL AND o.account_uid = :uid "
+                    "ORDER BY " << ordering,
+                use(accountUid));
+
+            BitcoinLikeUtxoRow utxo;
+            for (auto& row : rows) {
+                if (row.get_indicator(0) == i_null) {
+                    continue;
+                }
+                const auto &hash = row.get<std::string>(2);
+                if (hash.size() != BitcoinLikeUtxoRow::HASH_LENGTH) {
+                    throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Unexpected transaction hash '{}' for an output", hash);
+                }
+                std::copy(hash.begin(), hash.end(), utxo.transactionHash.begin());
+                utxo.outputIndex = get_number<uint32_t>(row, 1);
+                utxo.value = get_number<int64_t>(row, 3);
+                utxo.blockHeight = row.get_indicator(4) != i_null ? get_number<uint64_t>(row, 4) : std::numeric_limits<uint64_t>::max();
+                if (!visitor(utxo, row.get<std::string>(0))) {
+                    break;
+                }
+            }
+        }
+
+        std::vector<BitcoinLikeUtxo> BitcoinLikeUTXODatabaseHelper::queryUtxos(
+            soci::session &session, std::string const &accountUid, api::Currency const &currency,
+            std::vector<BitcoinLikeUtxoRow> const &rows)
+        {
+            std::vector<std::string> hashes;
+            hashes.reserve(rows.size());
+            for (const auto &row : rows) {
+                hashes.push_back(row.getTransactionHash());
+            }
+            std::sort(hashes.begin(), hashes.end());
+            hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+            std::map<std::pair<std::string, uint64_t>, BitcoinLikeUtxo> found;
+            size_t hashesPerQuery = BulkDatabaseHelper::MAX_BOUND_PARAMETERS - 1;
+            for (size_t offset = 0; offset < hashes.size(); offset += hashesPerQuery) {
+                auto count = std::min(hashesPerQuery, hashes.size() - offset);
+                BulkDatabaseHelper::Statement statement = (session.prepare <<
+                    "SELECT o.address, o.idx, o.transaction_hash, o.amount, o.script, o.block_height "
+                    "FROM bitcoin_outputs AS o "
+                    "WHERE o.account_uid = :uid AND o.transaction_hash IN (" << BulkDatabaseHelper::placeholders(count) << ")");
+                statement, use(accountUid);
+                for (size_t index = 0; index < count; index++) {
+                    statement, use(hashes[offset + index]);
+                }
+                soci::rowset<soci::row> results(statement);
+                for (auto& row : results) {
+                    BitcoinLikeUtxo output{
+                        get_number<uint64_t>(row, 1),
+                        row.get<std::string>(2),
+                        Amount(currency, 0, row.get<BigInt>(3)),
+                        row.get<Option<std::string>>(0),
+                        accountUid,
+                        row.get<std::string>(4),
+                        row.get_indicator(5) != i_null ? Option<uint64_t>{row.get<BigInt>(5).toUint64()} : Option<uint64_t>{}
+                    };
+                    auto key = std::make_pair(output.transactionHash, output.index);
+                    found.emplace(std::move(key), std::move(output));
+                }
+            }
+
+            std::vector<BitcoinLikeUtxo> utxos;
+            utxos.reserve(rows.size());
+            for (const auto &row : rows) {
+                auto utxo = found.find(std::make_pair(row.getTransactionHash(), static_cast<uint64_t>(row.outputIndex)));
+                if (utxo == found.end()) {
+                    throw make_exception(api::ErrorCode::DATABASE_EXCEPTION, "Output {}:{} is missing", row.getTransactionHash(), row.outputIndex);
+                }
+                utxos.push_back(utxo->second);
+            }
+            return utxos;
+        }
     }
 }
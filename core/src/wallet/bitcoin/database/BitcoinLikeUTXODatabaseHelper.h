@@ -34,8 +34,11 @@
 
 #include <soci.h>
 
+#include <math/FixedWidthInt.hpp>
+
 #include <wallet/bitcoin/explorers/BitcoinLikeBlockchainExplorer.hpp>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxo.hpp>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoSource.hpp>
 
 namespace ledger {
     namespace core {
@@ -51,12 +54,28 @@ namespace ledger {
                            std::vector<BitcoinLikeBlockchainExplorerOutput>& out,
                            std::function<bool (const std::string& address)> filter);
 
+            // Sum the unspent amounts of the account, reading them straight into a fixed width integer
+            static UInt256 sumUTXO(soci::session& sql, const std::string& accountUid,
+                                   std::function<bool (const std::string& address)> filter);
+
             static std::size_t UTXOcount(soci::session& sql, const std::string& accountUid,
                                          std::function<bool (const std::string& address)> filter);
 
             static std::vector<BitcoinLikeUtxo> queryAllUtxos(
                 soci::session &session, std::string const &accountUid, api::Currency const &currency);
 
+            // Stream the unspent outputs of an account in the given order, without materializing them.
+            // The visitor gets the output address (outputs without address are skipped) and returns
+            // false to stop the iteration.
+            static void streamUtxos(
+                soci::session &session, std::string const &accountUid, BitcoinLikeUtxoOrder order,
+                std::function<bool (const BitcoinLikeUtxoRow& row, const std::string& address)> const &visitor);
+
+            // Load the full outputs of the given rows, in the same order
+            static std::vector<BitcoinLikeUtxo> queryUtxos(
+                soci::session &session, std::string const &accountUid, api::Currency const &currency,
+                std::vector<BitcoinLikeUtxoRow> const &rows);
+
         };
     }
 }
@@ -107,10 +107,15 @@ namespace ledger {
             return _explorerVersion;
         }
 
+        std::shared_ptr<LedgerApiBlockchainExplorer> LedgerApiBitcoinLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
+
         Future<std::vector<std::shared_ptr<api::BigInt>>> LedgerApiBitcoinLikeBlockchainExplorer::getFees() {
             bool parseNumbersAsString = true;
             auto networkId = getNetworkParameters().Identifier;
             return _http->GET(fmt::format("/blockchain/{}/{}/fees", getExplorerVersion(), networkId))
+                    .cacheable()
                     .json(parseNumbersAsString).map<std::vector<std::shared_ptr<api::BigInt>>>(getExplorerContext(), [networkId] (const HttpRequest::JsonResult& result) {
                         auto& json = *std::get<1>(result);
                         if (!json.IsObject()) {
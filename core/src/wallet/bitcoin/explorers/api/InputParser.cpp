@@ -30,6 +30,7 @@
  */
 #include "InputParser.hpp"
 #include "utils/DateUtils.hpp"
+#include "utils/JSONUtils.h"
 
 namespace ledger {
     namespace core {
@@ -62,16 +63,14 @@ namespace ledger {
         }
 
         bool InputParser::RawNumber(const rapidjson::Reader::Ch *str, rapidjson::SizeType length, bool copy) {
-            std::string number(str, length);
-            BigInt value = BigInt::fromString(number);
             if (_lastKey == "input_index") {
-                _input->index = value.toUint64();
+                _input->index = JSONUtils::parseUint64(str, length);
             } else if (_lastKey == "value") {
-                _input->value = Option<BigInt>(value);
+                _input->value = Option<BigInt>(JSONUtils::parseBigInt(str, length));
             } else if (_lastKey == "output_index") {
-                _input->previousTxOutputIndex = value.toUint64();
+                _input->previousTxOutputIndex = JSONUtils::parseUint64(str, length);
             } else if (_lastKey == "sequence") {
-                _input->sequence = value.toUint64();
+                _input->sequence = JSONUtils::parseUint64(str, length);
             }
             return true;
         }
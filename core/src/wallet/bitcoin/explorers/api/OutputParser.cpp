@@ -29,6 +29,7 @@
  *
  */
 #include "OutputParser.hpp"
+#include "utils/JSONUtils.h"
 
 namespace ledger {
     namespace core {
@@ -62,12 +63,10 @@ namespace ledger {
         }
 
         bool OutputParser::RawNumber(const rapidjson::Reader::Ch *str, rapidjson::SizeType length, bool copy) {
-            std::string number(str, length);
-            BigInt value = BigInt::fromString(number);
             if (_lastKey == "output_index") {
-                _output->index = value.toUnsignedInt();
+                _output->index = JSONUtils::parseUint64(str, length);
             } else if (_lastKey == "value") {
-                _output->value = value;
+                _output->value = JSONUtils::parseBigInt(str, length);
             }
             return true;
         }
@@ -30,22 +30,36 @@
  */
 #include "TransactionParser.hpp"
 #include "utils/DateUtils.hpp"
+#include "utils/JSONUtils.h"
 
 #define PROXY_PARSE(method, ...)                                    \
- auto& currentObject = _hierarchy.top();                            \
- if (currentObject == "block") {                                    \
+ auto currentObject = _hierarchy.empty() ? Scope::ROOT : _hierarchy.top(); \
+ if (currentObject == Scope::BLOCK) {                               \
     return _blockParser.method(__VA_ARGS__);                        \
- } else if (currentObject == "inputs") {                            \
+ } else if (currentObject == Scope::INPUTS) {                       \
     return _inputParser.method(__VA_ARGS__);                        \
- } else if (currentObject == "outputs") {                           \
-    return _outputParser.method(__VA_ARGS__);                        \
+ } else if (currentObject == Scope::OUTPUTS) {                      \
+    return _outputParser.method(__VA_ARGS__);                       \
  } else                                                             \
 
 namespace ledger {
     namespace core {
 
+        static TransactionParser::Scope scopeFromKey(const std::string& key) {
+            if (key == "block") {
+                return TransactionParser::Scope::BLOCK;
+            } else if (key == "inputs") {
+                return TransactionParser::Scope::INPUTS;
+            } else if (key == "outputs") {
+                return TransactionParser::Scope::OUTPUTS;
+            } else if (key.empty()) {
+                return TransactionParser::Scope::ROOT;
+            }
+            return TransactionParser::Scope::OTHER;
+        }
+
         bool TransactionParser::Key(const rapidjson::Reader::Ch *str, rapidjson::SizeType length, bool copy) {
-            _lastKey = std::string(str, length);
+            _lastKey.assign(str, length);
             PROXY_PARSE(Key, str, length, copy) {
                 return true;
             }
@@ -53,17 +67,17 @@ namespace ledger {
 
         bool TransactionParser::StartObject() {
             if (_arrayDepth == 0) {
-                _hierarchy.push(_lastKey);
+                _hierarchy.push(scopeFromKey(_lastKey));
             }
 
-            auto& currentObject = _hierarchy.top();
+            auto currentObject = _hierarchy.top();
 
-            if (currentObject == "inputs") {
+            if (currentObject == Scope::INPUTS) {
                 BitcoinLikeBlockchainExplorerInput input;
                 input.index = _transaction->inputs.size();
                 _transaction->inputs.push_back(input);
                 _inputParser.init(&_transaction->inputs.back());
-            } else if (currentObject == "outputs") {
+            } else if (currentObject == Scope::OUTPUTS) {
                 BitcoinLikeBlockchainExplorerOutput output;
                 _transaction->outputs.push_back(output);
                 _outputParser.init(&_transaction->outputs.back());
@@ -71,7 +85,7 @@ namespace ledger {
                 if (_transaction->block.hasValue()) {
                     _transaction->outputs.back().blockHeight = _transaction->block.getValue().height;
                 }
-            } else if (currentObject == "block") {
+            } else if (currentObject == Scope::BLOCK) {
                 BitcoinLikeBlockchainExplorer::Block block;
                 _transaction->block = Option<BitcoinLikeBlockchainExplorer::Block>(block);
                 _blockParser.init(&_transaction->block.getValue());
@@ -81,8 +95,6 @@ namespace ledger {
         }
 
         bool TransactionParser::EndObject(rapidjson::SizeType memberCount) {
-            auto& currentObject = _hierarchy.top();
-
             if (_arrayDepth == 0) {
                 _hierarchy.pop();
             }
@@ -91,7 +103,7 @@ namespace ledger {
 
         bool TransactionParser::StartArray() {
             if (_arrayDepth == 0) {
-                _hierarchy.push(_lastKey);
+                _hierarchy.push(scopeFromKey(_lastKey));
             }
             _arrayDepth += 1;
             return true;
@@ -143,14 +155,12 @@ namespace ledger {
 
         bool TransactionParser::RawNumber(const rapidjson::Reader::Ch *str, rapidjson::SizeType length, bool copy) {
             PROXY_PARSE(RawNumber, str, length, copy) {
-                std::string number(str, length);
-                BigInt value = BigInt::fromString(number);
                 if (_lastKey == "lock_time") {
-                    _transaction->lockTime = value.toUint64();
+                    _transaction->lockTime = JSONUtils::parseUint64(str, length);
                 } else if (_lastKey == "fees") {
-                    _transaction->fees = Option<BigInt>(value);
+                    _transaction->fees = Option<BigInt>(JSONUtils::parseBigInt(str, length));
                 } else if (_lastKey == "confirmations") {
-                    _transaction->confirmations = value.toUint64();
+                    _transaction->confirmations = JSONUtils::parseUint64(str, length);
                 }
                 return true;
             }
@@ -48,6 +48,15 @@ namespace ledger {
         public:
             typedef BitcoinLikeBlockchainExplorerTransaction Result;
 
+            // Objects the parser dispatches to, resolved once per key instead of comparing strings on every token
+            enum class Scope {
+                ROOT,
+                BLOCK,
+                INPUTS,
+                OUTPUTS,
+                OTHER
+            };
+
             TransactionParser(std::string& lastKey);
             void init(BitcoinLikeBlockchainExplorerTransaction* transaction);
             bool Null();
@@ -68,7 +77,7 @@ namespace ledger {
         private:
             std::string& _lastKey;
             BitcoinLikeBlockchainExplorerTransaction* _transaction;
-            std::stack<std::string> _hierarchy;
+            std::stack<Scope> _hierarchy;
             uint32_t _arrayDepth;
             BlockParser _blockParser;
             InputParser _inputParser;
@@ -117,7 +117,7 @@ namespace ledger {
             }
 
             // Sets the derivation scheme
-            DerivationScheme scheme(STRING(api::Configuration::KEYCHAIN_DERIVATION_SCHEME, "44'/<coin_type>'/<account>'/<node>/<address>"));
+            const auto& scheme = DerivationScheme::intern(STRING(api::Configuration::KEYCHAIN_DERIVATION_SCHEME, "44'/<coin_type>'/<account>'/<node>/<address>"));
 
             return std::make_shared<BitcoinLikeWallet>(
                     entry.name,
@@ -63,10 +63,10 @@ namespace ledger {
                                                  const api::Currency &params, int account,
                                                  const std::shared_ptr<Preferences>& preferences) :
             _account(account), _preferences(preferences), _configuration(configuration), _currency(params),
-            _fullScheme(DerivationScheme(configuration
+            _fullScheme(DerivationScheme::intern(configuration
                                                  ->getString(api::Configuration::KEYCHAIN_DERIVATION_SCHEME)
                                                  .value_or("44'/<coin_type>'/<account>'/<node>/<address>"))),
-            _scheme(DerivationScheme(configuration
+            _scheme(DerivationScheme::intern(configuration
                     ->getString(api::Configuration::KEYCHAIN_DERIVATION_SCHEME)
                     .value_or("44'/<coin_type>'/<account>'/<node>/<address>")).getSchemeFrom(DerivationSchemeLevel::ACCOUNT_INDEX).shift())
         {
@@ -85,14 +85,20 @@ namespace ledger {
         }
 
         bool BitcoinLikeKeychain::markAsUsed(const std::string &address) {
-            auto path = getAddressDerivationPath(address);
+            auto path = getAddressDerivation(address);
             if (path.nonEmpty()) {
-                return markPathAsUsed(DerivationPath(path.getValue()));
+                return markPathAsUsed(path.getValue());
             } else {
                 return false;
             }
         }
 
+        Option<DerivationPath> BitcoinLikeKeychain::getAddressDerivation(const std::string &address) const {
+            return getAddressDerivationPath(address).map<DerivationPath>([] (const std::string& path) {
+                return DerivationPath(path);
+            });
+        }
+
         const DerivationScheme &BitcoinLikeKeychain::getFullDerivationScheme() const {
             return _fullScheme;
         }
@@ -67,6 +67,14 @@ namespace ledger {
             virtual bool markAsUsed(const std::vector<std::string>& addresses);
             virtual bool markAsUsed(const std::string& address);
             virtual bool markPathAsUsed(const DerivationPath& path) = 0;
+            // Used paths can be staged: after stageUsedPaths() the paths marked as used are only persisted by
+            // commitUsedPaths(), dropUsedPaths(mark) forgets the ones marked since markUsedPaths() returned mark
+            // and discardUsedPaths() all the staged ones. Keychains without used paths state stage nothing.
+            virtual void stageUsedPaths() {}
+            virtual size_t markUsedPaths() { return 0; }
+            virtual void dropUsedPaths(size_t mark) {}
+            virtual void commitUsedPaths() {}
+            virtual void discardUsedPaths() {}
 
             virtual std::vector<Address> getAllObservableAddresses(uint32_t from, uint32_t to)  = 0;
             virtual std::vector<Address> getAllObservableAddresses(KeyPurpose purpose, uint32_t from, uint32_t to) = 0;
@@ -76,6 +84,8 @@ namespace ledger {
 
             virtual Option<KeyPurpose> getAddressPurpose(const std::string& address) const = 0;
             virtual Option<std::string> getAddressDerivationPath(const std::string& address) const = 0;
+            // Parsed counterpart of getAddressDerivationPath
+            virtual Option<DerivationPath> getAddressDerivation(const std::string& address) const;
             virtual bool isEmpty() const = 0;
 
             int getAccountIndex() const;
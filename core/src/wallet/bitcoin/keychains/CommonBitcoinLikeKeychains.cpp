@@ -55,66 +55,114 @@ namespace ledger {
                                                                int account,
                                                                const std::shared_ptr<api::BitcoinLikeExtendedPublicKey> &xpub,
                                                                const std::shared_ptr<Preferences> &preferences)
-                : BitcoinLikeKeychain(configuration, params, account, preferences) {
+                : BitcoinLikeKeychain(configuration, params, account, preferences),
+                  _rootPath(xpub->getRootPath()) {
             _xpub = xpub;
-
-            {
-                auto localPath = getDerivationScheme().getSchemeTo(DerivationSchemeLevel::NODE)
-                        .setAccountIndex(getAccountIndex())
+            _observableRange = (uint32_t) configuration->getInt(api::Configuration::KEYCHAIN_OBSERVABLE_RANGE)
+                    .value_or(api::ConfigurationDefaults::KEYCHAIN_DEFAULT_OBSERVABLE_RANGE);
+            for (auto purpose : {KeyPurpose::RECEIVE, KeyPurpose::CHANGE}) {
+                auto scheme = getDerivationScheme();
+                scheme.setAccountIndex(getAccountIndex())
                         .setCoinType(getCurrency().bip44CoinType)
-                        .setNode(RECEIVE).getPath();
-                _publicNodeXpub = std::static_pointer_cast<BitcoinLikeExtendedPublicKey>(_xpub)->derive(localPath);
+                        .setNode(purpose);
+                _localDerivations.emplace_back(scheme);
+                _nodeDerivations.emplace_back(scheme.getSchemeFrom(DerivationSchemeLevel::NODE).shift(1));
             }
-            {
-                auto localPath = getDerivationScheme().getSchemeTo(DerivationSchemeLevel::NODE)
-                        .setAccountIndex(getAccountIndex())
-                        .setCoinType(getCurrency().bip44CoinType)
-                        .setNode(CHANGE).getPath();
-                _internalNodeXpub = std::static_pointer_cast<BitcoinLikeExtendedPublicKey>(_xpub)->derive(localPath);
+        }
+
+        CommonBitcoinLikeKeychains::AddressDerivation::AddressDerivation(const DerivationScheme &scheme)
+                : prefix(scheme.getPath()), suffix(std::vector<uint32_t>()), hasAddressLevel(false), hardenedBit(0) {
+            auto position = scheme.getPositionForLevel(DerivationSchemeLevel::ADDRESS_INDEX);
+            if (position >= 0) {
+                hasAddressLevel = true;
+                hardenedBit = prefix.isHardened(position) ? 0x80000000 : 0x00;
+                suffix = scheme.shift(position + 1).getPath();
+                prefix = scheme.getSchemeToDepth(position).getPath();
             }
+        }
 
-            // Try to restore the state from preferences
-            auto state = preferences->getData("state", {});
-            if (!state.empty()) {
-                boost::iostreams::array_source my_vec_source(reinterpret_cast<char*>(&state[0]), state.size());
-                boost::iostreams::stream<boost::iostreams::array_source> is(my_vec_source);
-                ::cereal::BinaryInputArchive archive(is);
-                archive(_state);
-            } else {
-                _state.maxConsecutiveReceiveIndex = 0;
-                _state.maxConsecutiveChangeIndex = 0;
-                _state.empty = true;
+        DerivationPath CommonBitcoinLikeKeychains::AddressDerivation::getPath(uint32_t index) const {
+            if (!hasAddressLevel) {
+                return prefix;
             }
-            _observableRange = (uint32_t) configuration->getInt(api::Configuration::KEYCHAIN_OBSERVABLE_RANGE)
-                    .value_or(api::ConfigurationDefaults::KEYCHAIN_DEFAULT_OBSERVABLE_RANGE);
+            auto path = prefix.getChild(hardenedBit | index);
+            return suffix.isRoot() ? path : path + suffix;
+        }
+
+        void CommonBitcoinLikeKeychains::restore() const {
+            restoreNodes();
+            // Lookups by address are served from preferences, they must know the initial range
+            std::call_once(_observed, [this] () {
+                for (uint32_t index = 0; index <= _observableRange; index++) {
+                    derive(KeyPurpose::RECEIVE, index);
+                    derive(KeyPurpose::CHANGE, index);
+                }
+            });
+        }
+
+        void CommonBitcoinLikeKeychains::restoreNodes() const {
+            std::call_once(_restored, [this] () {
+                {
+                    auto localPath = getDerivationScheme().getSchemeTo(DerivationSchemeLevel::NODE)
+                            .setAccountIndex(getAccountIndex())
+                            .setCoinType(getCurrency().bip44CoinType)
+                            .setNode(RECEIVE).getPath();
+                    _publicNodeXpub = std::static_pointer_cast<BitcoinLikeExtendedPublicKey>(_xpub)->derive(localPath);
+                }
+                {
+                    auto localPath = getDerivationScheme().getSchemeTo(DerivationSchemeLevel::NODE)
+                            .setAccountIndex(getAccountIndex())
+                            .setCoinType(getCurrency().bip44CoinType)
+                            .setNode(CHANGE).getPath();
+                    _internalNodeXpub = std::static_pointer_cast<BitcoinLikeExtendedPublicKey>(_xpub)->derive(localPath);
+                }
+
+                // Try to restore the state from preferences
+                auto state = getPreferences()->getData("state", {});
+                if (!state.empty()) {
+                    boost::iostreams::array_source my_vec_source(reinterpret_cast<char*>(&state[0]), state.size());
+                    boost::iostreams::stream<boost::iostreams::array_source> is(my_vec_source);
+                    ::cereal::BinaryInputArchive archive(is);
+                    archive(_state);
+                } else {
+                    _state.maxConsecutiveReceiveIndex = 0;
+                    _state.maxConsecutiveChangeIndex = 0;
+                    _state.empty = true;
+                }
+            });
+        }
+
+        KeychainPersistentState& CommonBitcoinLikeKeychains::getState() const {
+            restore();
+            return _state;
         }
 
-        bool CommonBitcoinLikeKeychains::markPathAsUsed(const DerivationPath &p) {
-            DerivationPath path(p);
-            if (path.getParent().getLastChildNum() == 0) {
-                if (path.getLastChildNum() < _state.maxConsecutiveReceiveIndex ||
-                    _state.nonConsecutiveReceiveIndexes.find(path.getLastChildNum()) != _state.nonConsecutiveReceiveIndexes.end()) {
+        bool CommonBitcoinLikeKeychains::markPathAsUsed(const DerivationPath &path) {
+            auto &state = getState();
+            if (path[path.getDepth() - 2] == 0) {
+                if (path.getLastChildNum() < state.maxConsecutiveReceiveIndex ||
+                    state.nonConsecutiveReceiveIndexes.find(path.getLastChildNum()) != state.nonConsecutiveReceiveIndexes.end()) {
                     return false;
                 } else {
-                    if (path.getLastChildNum() == _state.maxConsecutiveReceiveIndex)
-                        _state.maxConsecutiveReceiveIndex += 1;
+                    if (path.getLastChildNum() == state.maxConsecutiveReceiveIndex)
+                        state.maxConsecutiveReceiveIndex += 1;
                     else
-                        _state.nonConsecutiveReceiveIndexes.insert(path.getLastChildNum());
-                    _state.empty = false;
+                        state.nonConsecutiveReceiveIndexes.insert(path.getLastChildNum());
+                    state.empty = false;
                     saveState();
                     getAllObservableAddresses(path.getLastChildNum(), path.getLastChildNum() + _observableRange);
                     return true;
                 }
             } else {
-                if (path.getLastChildNum() < _state.maxConsecutiveChangeIndex ||
-                    _state.nonConsecutiveChangeIndexes.find(path.getLastChildNum()) != _state.nonConsecutiveChangeIndexes.end()) {
+                if (path.getLastChildNum() < state.maxConsecutiveChangeIndex ||
+                    state.nonConsecutiveChangeIndexes.find(path.getLastChildNum()) != state.nonConsecutiveChangeIndexes.end()) {
                     return false;
                 } else {
-                    if (path.getLastChildNum() == _state.maxConsecutiveChangeIndex)
-                        _state.maxConsecutiveChangeIndex += 1;
+                    if (path.getLastChildNum() == state.maxConsecutiveChangeIndex)
+                        state.maxConsecutiveChangeIndex += 1;
                     else
-                        _state.nonConsecutiveChangeIndexes.insert(path.getLastChildNum());
-                    _state.empty = false;
+                        state.nonConsecutiveChangeIndexes.insert(path.getLastChildNum());
+                    state.empty = false;
                     saveState();
                     getAllObservableAddresses(path.getLastChildNum(), path.getLastChildNum() + _observableRange);
                     return true;
@@ -122,12 +170,57 @@ namespace ledger {
             }
         }
 
+        void CommonBitcoinLikeKeychains::stageUsedPaths() {
+            if (_stagingUsedPaths) {
+                discardUsedPaths();
+            }
+            _stagedStates.assign(1, getState());
+            _stagingUsedPaths = true;
+            _stagedUsedPathsChanged = false;
+        }
+
+        size_t CommonBitcoinLikeKeychains::markUsedPaths() {
+            if (!_stagingUsedPaths) {
+                return 0;
+            }
+            _stagedStates.push_back(getState());
+            return _stagedStates.size() - 1;
+        }
+
+        void CommonBitcoinLikeKeychains::dropUsedPaths(size_t mark) {
+            if (_stagingUsedPaths && mark > 0 && mark < _stagedStates.size()) {
+                _state = _stagedStates[mark];
+                _stagedStates.resize(mark);
+            }
+        }
+
+        void CommonBitcoinLikeKeychains::commitUsedPaths() {
+            if (!_stagingUsedPaths) {
+                return;
+            }
+            _stagingUsedPaths = false;
+            _stagedStates.clear();
+            if (_stagedUsedPathsChanged) {
+                saveState();
+            }
+        }
+
+        void CommonBitcoinLikeKeychains::discardUsedPaths() {
+            if (!_stagingUsedPaths) {
+                return;
+            }
+            _state = _stagedStates.front();
+            _stagingUsedPaths = false;
+            _stagedStates.clear();
+        }
+
         BitcoinLikeKeychain::Address CommonBitcoinLikeKeychains::getFreshAddress(BitcoinLikeKeychain::KeyPurpose purpose) {
-            return derive(purpose, (purpose == KeyPurpose::RECEIVE ? _state.maxConsecutiveReceiveIndex : _state.maxConsecutiveChangeIndex));
+            auto &state = getState();
+            return derive(purpose, (purpose == KeyPurpose::RECEIVE ? state.maxConsecutiveReceiveIndex : state.maxConsecutiveChangeIndex));
         }
 
         bool CommonBitcoinLikeKeychains::isEmpty() const {
-            return _state.empty;
+            return getState().empty;
         }
 
         std::vector<BitcoinLikeKeychain::Address> CommonBitcoinLikeKeychains::getAllObservableAddresses(uint32_t from, uint32_t to) {
@@ -143,7 +236,8 @@ namespace ledger {
 
         std::vector<BitcoinLikeKeychain::Address>
         CommonBitcoinLikeKeychains::getFreshAddresses(BitcoinLikeKeychain::KeyPurpose purpose, size_t n) {
-            auto startOffset = (purpose == KeyPurpose::RECEIVE) ? _state.maxConsecutiveReceiveIndex : _state.maxConsecutiveChangeIndex;
+            auto &state = getState();
+            auto startOffset = (purpose == KeyPurpose::RECEIVE) ? state.maxConsecutiveReceiveIndex : state.maxConsecutiveChangeIndex;
             std::vector<BitcoinLikeKeychain::Address> result(n);
             for (auto i = 0; i < n; i++) {
                 result[i] = derive(purpose, startOffset + i);
@@ -153,10 +247,9 @@ namespace ledger {
 
         Option<BitcoinLikeKeychain::KeyPurpose>
         CommonBitcoinLikeKeychains::getAddressPurpose(const std::string &address) const {
-            return getAddressDerivationPath(address).flatMap<KeyPurpose>([] (const std::string& p) {
-                DerivationPath derivation(p);
+            return getAddressDerivation(address).flatMap<KeyPurpose>([] (const DerivationPath& derivation) {
                 if (derivation.getDepth() > 1) {
-                    return Option<KeyPurpose>(derivation.getParent().getLastChildNum() == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE);
+                    return Option<KeyPurpose>(derivation[derivation.getDepth() - 2] == 0 ? KeyPurpose::RECEIVE : KeyPurpose::CHANGE);
                 } else {
                     return Option<KeyPurpose>();
                 }
@@ -164,19 +257,25 @@ namespace ledger {
         }
 
         Option<std::string> CommonBitcoinLikeKeychains::getAddressDerivationPath(const std::string &address) const {
-            auto path = getPreferences()->getString(fmt::format("address:{}", address), "");
+            return getAddressDerivation(address).map<std::string>([] (const DerivationPath& derivation) {
+                return derivation.toString();
+            });
+        }
+
+        Option<DerivationPath> CommonBitcoinLikeKeychains::getAddressDerivation(const std::string &address) const {
+            restore();
+            auto path = getPreferences()->getString("address:" + address, "");
             if (path.empty()) {
-                return Option<std::string>();
-            } else {
-                auto derivation = DerivationPath(getExtendedPublicKey()->getRootPath()) + DerivationPath(path);
-                return Option<std::string>(derivation.toString());
+                return Option<DerivationPath>();
             }
+            return Option<DerivationPath>(_rootPath + DerivationPath(path));
         }
 
         std::vector<BitcoinLikeKeychain::Address>
         CommonBitcoinLikeKeychains::getAllObservableAddresses(BitcoinLikeKeychain::KeyPurpose purpose, uint32_t from,
                                                             uint32_t to) {
-            auto maxObservableIndex = (purpose == KeyPurpose::CHANGE ? _state.maxConsecutiveChangeIndex + _state.nonConsecutiveChangeIndexes.size() : _state.maxConsecutiveReceiveIndex + _state.nonConsecutiveReceiveIndexes.size()) + _observableRange;
+            auto &state = getState();
+            auto maxObservableIndex = (purpose == KeyPurpose::CHANGE ? state.maxConsecutiveChangeIndex + state.nonConsecutiveChangeIndexes.size() : state.maxConsecutiveReceiveIndex + state.nonConsecutiveReceiveIndexes.size()) + _observableRange;
             auto length = std::min<size_t >(to - from, maxObservableIndex - from);
             std::vector<BitcoinLikeKeychain::Address> result;
             result.reserve(length + 1);
@@ -191,17 +290,23 @@ namespace ledger {
         }
 
         void CommonBitcoinLikeKeychains::saveState() {
-            while (_state.nonConsecutiveReceiveIndexes.find(_state.maxConsecutiveReceiveIndex) != _state.nonConsecutiveReceiveIndexes.end()) {
-                _state.nonConsecutiveReceiveIndexes.erase(_state.maxConsecutiveReceiveIndex);
-                _state.maxConsecutiveReceiveIndex += 1;
+            auto &state = getState();
+            while (state.nonConsecutiveReceiveIndexes.find(state.maxConsecutiveReceiveIndex) != state.nonConsecutiveReceiveIndexes.end()) {
+                state.nonConsecutiveReceiveIndexes.erase(state.maxConsecutiveReceiveIndex);
+                state.maxConsecutiveReceiveIndex += 1;
+            }
+            while (state.nonConsecutiveChangeIndexes.find(state.maxConsecutiveChangeIndex) != state.nonConsecutiveChangeIndexes.end()) {
+                state.nonConsecutiveChangeIndexes.erase(state.maxConsecutiveChangeIndex);
+                state.maxConsecutiveChangeIndex += 1;
             }
-            while (_state.nonConsecutiveChangeIndexes.find(_state.maxConsecutiveChangeIndex) != _state.nonConsecutiveChangeIndexes.end()) {
-                _state.nonConsecutiveChangeIndexes.erase(_state.maxConsecutiveChangeIndex);
-                _state.maxConsecutiveChangeIndex += 1;
+            if (_stagingUsedPaths) {
+                // Persisted once the staged used paths are committed
+                _stagedUsedPathsChanged = true;
+                return;
             }
             std::stringstream is;
             ::cereal::BinaryOutputArchive archive(is);
-            archive(_state);
+            archive(state);
             auto savedState = is.str();
             getPreferences()->edit()->putData("state", std::vector<uint8_t>((const uint8_t *)savedState.data(),(const uint8_t *)savedState.data() + savedState.size()))->commit();
         }
@@ -219,12 +324,14 @@ namespace ledger {
         }
 
         bool CommonBitcoinLikeKeychains::contains(const std::string &address) const {
-            return getAddressDerivationPath(address).nonEmpty();
+            restore();
+            return !getPreferences()->getString("address:" + address, "").empty();
         }
 
         std::vector<BitcoinLikeKeychain::Address> CommonBitcoinLikeKeychains::getAllAddresses() {
+            auto &state = getState();
             std::vector<BitcoinLikeKeychain::Address> addresses;
-            addresses.reserve(_state.maxConsecutiveChangeIndex + 1 + _state.maxConsecutiveReceiveIndex + 1);
+            addresses.reserve(state.maxConsecutiveChangeIndex + 1 + state.maxConsecutiveReceiveIndex + 1);
 
             auto fetchAddressesFrom = [&](auto const keyPurpose, auto const maxIndex) {
                   for (auto i = 0; i <= maxIndex; ++i) {
@@ -232,13 +339,14 @@ namespace ledger {
                   }
             };
 
-            fetchAddressesFrom(KeyPurpose::CHANGE, _state.maxConsecutiveChangeIndex);
-            fetchAddressesFrom(KeyPurpose::RECEIVE, _state.maxConsecutiveReceiveIndex);
+            fetchAddressesFrom(KeyPurpose::CHANGE, state.maxConsecutiveChangeIndex);
+            fetchAddressesFrom(KeyPurpose::RECEIVE, state.maxConsecutiveReceiveIndex);
 
             return addresses;
         }
 
         Option<std::vector<uint8_t>> CommonBitcoinLikeKeychains::getPublicKey(const std::string &address) const {
+            restore();
             auto path = getPreferences()->getString(fmt::format("address:{}", address), "");
             if (path.empty()) {
                 Option<std::vector<uint8_t>>();
@@ -246,25 +354,18 @@ namespace ledger {
             return Option<std::vector<uint8_t>>(_xpub->derivePublicKey(path));
         }
 
-        BitcoinLikeKeychain::Address CommonBitcoinLikeKeychains::derive(KeyPurpose purpose, off_t index) {
-            auto currency = getCurrency();
+        BitcoinLikeKeychain::Address CommonBitcoinLikeKeychains::derive(KeyPurpose purpose, off_t index) const {
+            const auto& currency = getCurrency();
             auto iPurpose = (purpose == KeyPurpose::RECEIVE) ? 0 : 1;
-            auto localPath = getDerivationScheme()
-                    .setAccountIndex(getAccountIndex())
-                    .setCoinType(currency.bip44CoinType)
-                    .setNode(iPurpose)
-                    .setAddressIndex((int) index).getPath().toString();
+            auto localPath = _localDerivations[iPurpose].getPath((uint32_t) index).toString();
 
-            auto cacheKey = fmt::format("path:{}", localPath);
+            auto cacheKey = "path:" + localPath;
             auto address = getPreferences()->getString(cacheKey, "");
 
             if (address.empty()) {
 
-                auto p = getDerivationScheme().getSchemeFrom(DerivationSchemeLevel::NODE).shift(1)
-                        .setAccountIndex(getAccountIndex())
-                        .setCoinType(currency.bip44CoinType)
-                        .setNode(iPurpose)
-                        .setAddressIndex((int) index).getPath().toString();
+                auto p = _nodeDerivations[iPurpose].getPath((uint32_t) index).toString();
+                restoreNodes();
                 auto xpub = iPurpose == KeyPurpose::RECEIVE ? _publicNodeXpub : _internalNodeXpub;
                 address = BitcoinLikeAddress::fromPublicKey(xpub, currency, p, _keychainEngine);
                 // Feed path -> address cache
@@ -272,7 +373,7 @@ namespace ledger {
                 getPreferences()
                         ->edit()
                         ->putString(cacheKey, address)
-                        ->putString(fmt::format("address:{}", address), localPath)
+                        ->putString("address:" + address, localPath)
                         ->commit();
             }
             return std::dynamic_pointer_cast<BitcoinLikeAddress>(BitcoinLikeAddress::parse(address, getCurrency(), Option<std::string>(localPath)));
@@ -33,6 +33,7 @@
 
 #include "BitcoinLikeKeychain.hpp"
 #include <set>
+#include <mutex>
 #include "../../../collections/DynamicObject.hpp"
 #include <bitcoin/BitcoinLikeAddress.hpp>
 
@@ -68,12 +69,18 @@ namespace ledger {
                                      const std::shared_ptr<Preferences> &preferences);
 
             bool markPathAsUsed(const DerivationPath &path) override;
+            void stageUsedPaths() override;
+            size_t markUsedPaths() override;
+            void dropUsedPaths(size_t mark) override;
+            void commitUsedPaths() override;
+            void discardUsedPaths() override;
 
             BitcoinLikeKeychain::Address getFreshAddress(KeyPurpose purpose) override;
             std::vector<BitcoinLikeKeychain::Address> getAllObservableAddresses(uint32_t from, uint32_t to) override;
             std::vector<BitcoinLikeKeychain::Address> getFreshAddresses(KeyPurpose purpose, size_t n) override;
             Option<KeyPurpose> getAddressPurpose(const std::string &address) const override;
             Option<std::string> getAddressDerivationPath(const std::string &address) const override;
+            Option<DerivationPath> getAddressDerivation(const std::string &address) const override;
             std::vector<BitcoinLikeKeychain::Address> getAllObservableAddresses(KeyPurpose purpose, uint32_t from, uint32_t to) override;
             bool isEmpty() const override;
             std::shared_ptr<api::BitcoinLikeExtendedPublicKey> getExtendedPublicKey() const;
@@ -87,16 +94,45 @@ namespace ledger {
             Option<std::vector<uint8_t>> getPublicKey(const std::string &address) const override;
 
         protected:
-            std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _internalNodeXpub;
-            std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _publicNodeXpub;
+            // Derives the node keys, restores the state from preferences and caches the addresses of the
+            // initial observable range on first use: restoring an account only parses its extended public key
+            void restore() const;
+
+            mutable std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _internalNodeXpub;
+            mutable std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _publicNodeXpub;
             uint32_t _observableRange;
             std::string _keychainEngine;
 
         private:
-            BitcoinLikeKeychain::Address derive(KeyPurpose purpose, off_t index);
+            // Paths of the addresses of a node resolved once from the derivation scheme: the path of
+            // an address only appends its index instead of resolving the scheme again
+            struct AddressDerivation {
+                explicit AddressDerivation(const DerivationScheme& scheme);
+                DerivationPath getPath(uint32_t index) const;
+
+                DerivationPath prefix;
+                DerivationPath suffix;
+                bool hasAddressLevel;
+                uint32_t hardenedBit;
+            };
+
+            // First part of restore(), all derive() needs
+            void restoreNodes() const;
+            BitcoinLikeKeychain::Address derive(KeyPurpose purpose, off_t index) const;
             void saveState();
-            KeychainPersistentState _state;
+            KeychainPersistentState& getState() const;
+            mutable std::once_flag _restored;
+            mutable std::once_flag _observed;
+            mutable KeychainPersistentState _state;
+            // While used paths are staged, the state before them then at each mark
+            bool _stagingUsedPaths = false;
+            bool _stagedUsedPathsChanged = false;
+            std::vector<KeychainPersistentState> _stagedStates;
             std::shared_ptr<api::BitcoinLikeExtendedPublicKey> _xpub;
+            DerivationPath _rootPath;
+            // Indexed by purpose, relative to the account key and to the node key
+            std::vector<AddressDerivation> _localDerivations;
+            std::vector<AddressDerivation> _nodeDerivations;
         };
     }
 }
@@ -41,7 +41,6 @@ namespace ledger {
                 : CommonBitcoinLikeKeychains(configuration, params, account, xpub, preferences)
         {
             _keychainEngine = api::KeychainEngines::BIP49_P2SH;
-            getAllObservableAddresses(0, _observableRange);
         }
 
         int32_t P2SHBitcoinLikeKeychain::getOutputSizeAsSignedTxInput() const {
@@ -39,7 +39,6 @@ namespace ledger {
                 : CommonBitcoinLikeKeychains(configuration, params, account, xpub, preferences)
         {
             _keychainEngine = api::KeychainEngines::BIP173_P2WPKH;
-            getAllObservableAddresses(0, _observableRange);
         }
 
         int32_t P2WPKHBitcoinLikeKeychain::getOutputSizeAsSignedTxInput() const {
@@ -42,7 +42,6 @@ namespace ledger {
                 : CommonBitcoinLikeKeychains(configuration, params, account, xpub, preferences)
         {
             _keychainEngine = api::KeychainEngines::BIP173_P2WSH;
-            getAllObservableAddresses(0, _observableRange);
         }
 
         int32_t P2WSHBitcoinLikeKeychain::getOutputSizeAsSignedTxInput() const {
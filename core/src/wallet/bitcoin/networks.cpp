@@ -30,6 +30,9 @@
  */
 #include "networks.hpp"
 #include <utils/Exception.hpp>
+#include <algorithm>
+#include <map>
+#include <mutex>
 namespace ledger {
     namespace core {
 
@@ -408,6 +411,22 @@ namespace ledger {
                 throw make_exception(api::ErrorCode::INVALID_ARGUMENT, "No network parameters set for {}", networkName);
             }
 
+            const api::BitcoinLikeNetworkParameters& getCachedNetworkParameters(const std::string &networkName, int version) {
+                // Versions below 2 apply no migration and versions above the highest one apply all of them,
+                // so there are at most two entries per network
+                auto const effectiveVersion = version < 2 ? 1 : std::min(version, HIGHTEST_PARAMETERS_VERSION);
+                static std::mutex lock;
+                static std::map<std::pair<std::string, int>, api::BitcoinLikeNetworkParameters> cache;
+
+                std::lock_guard<std::mutex> guard(lock);
+                auto key = std::make_pair(networkName, effectiveVersion);
+                auto it = cache.find(key);
+                if (it == cache.end()) {
+                    it = cache.emplace(key, getNetworkParameters(networkName, effectiveVersion)).first;
+                }
+                return it->second;
+            }
+
             template <> void migrateParameters<1>(api::BitcoinLikeNetworkParameters &params) {}
 
             template <> void migrateParameters<2>(api::BitcoinLikeNetworkParameters &params) {
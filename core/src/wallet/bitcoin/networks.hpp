@@ -58,6 +58,9 @@ namespace ledger {
             static const int HIGHTEST_PARAMETERS_VERSION = 2;
 
             extern LIBCORE_EXPORT const api::BitcoinLikeNetworkParameters getNetworkParameters(const std::string &networkName, int version = HIGHTEST_PARAMETERS_VERSION);
+            // Same as getNetworkParameters but built once per network and parameters version, the returned
+            // reference stays valid for the lifetime of the program
+            extern LIBCORE_EXPORT const api::BitcoinLikeNetworkParameters& getCachedNetworkParameters(const std::string &networkName, int version = HIGHTEST_PARAMETERS_VERSION);
 
             // Since we are not (supposed) to have too many versions, we migrate from the beginning ...
             // TODO: could be optimized by saving last HIGHTEST_PARAMETERS_VERSION and start from it
@@ -36,12 +36,73 @@
 #include <wallet/bitcoin/api_impl/BitcoinLikeTransactionApi.h>
 #include <wallet/bitcoin/explorers/BitcoinLikeBlockchainExplorer.hpp>
 
-#include <random>
+#include <chrono>
+#include <limits>
 #include <numeric>
 
 namespace ledger {
     namespace core {
 
+        namespace {
+            // xorshift64* generator, seeded once per coin selection. Coin flips consume the
+            // generated words bit by bit.
+            class FastRandom {
+            public:
+                using result_type = uint64_t;
+
+                FastRandom() : _bits(0), _remainingBits(0) {
+                    // splitmix64 finalizer, spreads the clock entropy over the whole state
+                    uint64_t seed = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+                    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+                    _state = (seed ^ (seed >> 31)) | 1;
+                }
+
+                static constexpr result_type min() { return 0; }
+                static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+                result_type operator()() {
+                    _state ^= _state >> 12;
+                    _state ^= _state << 25;
+                    _state ^= _state >> 27;
+                    return _state * 0x2545F4914F6CDD1DULL;
+                }
+
+                bool nextBool() {
+                    if (_remainingBits == 0) {
+                        _bits = (*this)();
+                        _remainingBits = 64;
+                    }
+                    bool bit = (_bits & 1) != 0;
+                    _bits >>= 1;
+                    _remainingBits--;
+                    return bit;
+                }
+
+            private:
+                uint64_t _state;
+                uint64_t _bits;
+                int _remainingBits;
+            };
+
+            // Optional time budget of a selection
+            class SelectionDeadline {
+            public:
+                explicit SelectionDeadline(const Option<std::chrono::milliseconds>& budget) {
+                    if (budget.nonEmpty()) {
+                        _deadline = std::chrono::steady_clock::now() + budget.getValue();
+                    }
+                }
+
+                bool isExpired() const {
+                    return _deadline.nonEmpty() && std::chrono::steady_clock::now() >= _deadline.getValue();
+                }
+
+            private:
+                Option<std::chrono::steady_clock::time_point> _deadline;
+            };
+        }
+
         BitcoinLikeStrategyUtxoPicker::BitcoinLikeStrategyUtxoPicker(const std::shared_ptr<api::ExecutionContext> &context,
                                                                      const api::Currency &currency) : BitcoinLikeUtxoPicker(context, currency) {
 
@@ -50,6 +111,10 @@ namespace ledger {
         Future<std::vector<BitcoinLikeUtxo>>
         BitcoinLikeStrategyUtxoPicker::filterInputs(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy) {
             return computeAggregatedAmount(buddy).flatMap<std::vector<BitcoinLikeUtxo>>(getContext(), [=] (BigInt const &amount) {
+                if (buddy->utxoSource) {
+                    return Future<std::vector<BitcoinLikeUtxo>>::successful(filterWithSource(buddy, amount, getCurrency()));
+                }
+
                 buddy->logger->info("GET UTXO");
 
                 return buddy->getUtxo().map<std::vector<BitcoinLikeUtxo>>(
@@ -107,10 +172,20 @@ namespace ledger {
 
             buddy->logger->debug("Start filterWithDeepFirst");
 
-            return filterWithSort(buddy, utxos, aggregatedAmount, currency, [] (auto &lhs, auto &rhs) {
-                constexpr auto maxBlockHeight = std::numeric_limits<uint64_t>::max();
-                return lhs.blockHeight.getValueOr(maxBlockHeight) < rhs.blockHeight.getValueOr(maxBlockHeight);
+            return pick(utxos, selectWithDeepFirst(buddy, toUtxoValues(utxos), aggregatedAmount, currency));
+        }
+
+        std::vector<size_t>
+        BitcoinLikeStrategyUtxoPicker::selectWithDeepFirst(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                                                            const UtxoValues &utxoValues,
+                                                            const BigInt &aggregatedAmount,
+                                                            const api::Currency& currency) {
+            std::vector<size_t> order(utxoValues.amounts.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return utxoValues.blockHeights[lhs] < utxoValues.blockHeights[rhs];
             });
+            return selectInOrder(buddy, utxoValues, order, aggregatedAmount, currency);
         }
 
         bool BitcoinLikeStrategyUtxoPicker::hasEnough(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
@@ -161,12 +236,20 @@ namespace ledger {
                                                               const std::vector<BitcoinLikeUtxo> &utxos,
                                                               const BigInt &aggregatedAmount,
                                                               const api::Currency& currency) {
+            return pick(utxos, selectWithOptimizeSize(buddy, toUtxoValues(utxos), aggregatedAmount, currency));
+        }
+
+        std::vector<size_t>
+        BitcoinLikeStrategyUtxoPicker::selectWithOptimizeSize(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                                                              const UtxoValues &utxoValues,
+                                                              const BigInt &aggregatedAmount,
+                                                              const api::Currency& currency) {
 
             // NOTE: why are we using buddy->outputAmount here instead of aggregatedAmount ?
             //Don't use this strategy for wipe mode (we have more performent strategies for this use case)
             if (buddy->request.wipe) {
                 buddy->logger->debug("Strategy filterWithOptimizeSize with wipe to address mode, using filterWithDeepFirst");
-                return filterWithDeepFirst(buddy, utxos, buddy->outputAmount, currency);
+                return selectWithDeepFirst(buddy, utxoValues, buddy->outputAmount, currency);
             }
             /*
              * This coin selection is inspired from the one used in Bitcoin Core
@@ -210,74 +293,81 @@ namespace ledger {
 
             buddy->logger->debug("Cost of change {}, signedChangeSize {}, changeSize {}", costOfChange, signedChangeSize, changeSize);
 
-            //Calculate effective value of outputs
-            int64_t currentAvailableValue = 0;
-
-            struct EffectiveUtxo {
-                const BitcoinLikeUtxo *utxo;
-                int64_t effectiveValue;
-                int64_t effectiveFees;
-                int64_t longTermFees;
-            };
-
-            std::vector<EffectiveUtxo> effectiveUtxos;
-            //Get size of utxos as a signed input in a transaction
-            for (auto& utxo : utxos) {
-                int64_t outEffectiveValue = utxo.value.toLong() - effectiveFees * signedUTXOSize;
+            //Every input has the same size, hence the same fees and waste
+            const int64_t inputEffectiveFees = effectiveFees * signedUTXOSize;
+            const int64_t inputWaste = inputEffectiveFees - longTermFees * signedUTXOSize;
+
+            //Effective values of the spendable utxos, stored apart from the utxos so that the search
+            //only walks a compact array of integers
+            std::vector<size_t> order;
+            std::vector<int64_t> allValues;
+            order.reserve(utxoValues.amounts.size());
+            allValues.reserve(utxoValues.amounts.size());
+            for (size_t i = 0; i < utxoValues.amounts.size(); i++) {
+                int64_t outEffectiveValue = utxoValues.amounts[i] - inputEffectiveFees;
                 if (outEffectiveValue > 0) {
-                    int64_t outEffectiveFees = effectiveFees * signedUTXOSize;
-                    int64_t outLongTermFees = longTermFees * signedUTXOSize;
-                    effectiveUtxos.push_back(EffectiveUtxo{&utxo, outEffectiveValue, outEffectiveFees, outLongTermFees});
-                    currentAvailableValue += outEffectiveValue;
+                    order.push_back(allValues.size());
+                    allValues.push_back(outEffectiveValue);
+                } else {
+                    allValues.push_back(0);
                 }
             }
 
+            //Sort utxos by descending effectiveValue
+            std::sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return allValues[lhs] > allValues[rhs];
+            });
+            std::vector<int64_t> values(order.size());
+            for (size_t i = 0; i < order.size(); i++) {
+                values[i] = allValues[order[i]];
+            }
+
+            int64_t currentAvailableValue = std::accumulate(values.begin(), values.end(), int64_t(0));
+
             //Get no inputs fees
             // At beginning, there are no outputs in tx, so noInputFees are fixed fees
             int64_t notInputFees = effectiveFees * (fixedSize.Max + (int64_t)(oneOutputSize * buddy->request.outputs.size()));//at least fixed size and outputs(version...)
 
             //Start coin selection algorithm (according to SelectCoinBnb from Bitcoin Core)
             int64_t currentValue = 0;
-            std::vector<bool> currentSelection;
-            currentSelection.reserve(utxos.size());
+            std::vector<char> currentSelection;
+            currentSelection.reserve(values.size());
 
             //Actual amount we are targetting
             int64_t actualTarget = notInputFees + buddy->outputAmount.toInt64();
+            const int64_t upperBound = actualTarget + costOfChange;
 
             //Insufficient funds
             if (currentAvailableValue < actualTarget) {
                 throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "Cannot gather enough funds.");
             }
 
-            auto descendingEffectiveValue = [] (const EffectiveUtxo &lhs, const EffectiveUtxo &rhs) -> bool {
-                return  lhs.effectiveValue > rhs.effectiveValue ;
-            };
-
-            //Sort utxos by effectiveValue
-            std::sort(effectiveUtxos.begin(), effectiveUtxos.end(), descendingEffectiveValue);
-
             int64_t currentWaste = 0;
             int64_t bestWaste = MAX_MONEY;
-            std::vector<bool> bestSelection;
-            buddy->logger->debug("Start filterWithLowestFees, target range is {} to {}, available funds {}", actualTarget, actualTarget + costOfChange, currentAvailableValue);
+            std::vector<char> bestSelection;
+            SelectionDeadline deadline(buddy->request.selectionTimeBudget);
+            buddy->logger->debug("Start filterWithLowestFees, target range is {} to {}, available funds {}", actualTarget, upperBound, currentAvailableValue);
             //Deep first search loop to choose UTXOs
-            for (size_t i = 0; i < TOTAL_TRIES; i++) {
+            for (uint32_t i = 0; i < TOTAL_TRIES; i++) {
+                //Only read the clock every 1024 tries
+                if ((i & 1023) == 1023 && deadline.isExpired()) {
+                    buddy->logger->debug("Selection time budget exhausted after {} tries", i);
+                    break;
+                }
 
                 //Condition for starting a backtrack
                 bool backtrack = false;
                 if(currentValue + currentAvailableValue < actualTarget || //Cannot reach target with the amount remaining in currentAvailableValue
-                   currentValue > actualTarget + costOfChange || // Selected value is out of range, go back and try other branch
-                   (currentWaste > bestWaste && effectiveUtxos.at(0).effectiveFees - effectiveUtxos.at(0).longTermFees > 0) ) { //avoid selecting utxos producing more waste
+                   currentValue > upperBound || // Selected value is out of range, go back and try other branch
+                   (currentWaste > bestWaste && inputWaste > 0) ) { //avoid selecting utxos producing more waste
                     backtrack = true;
                 } else if (currentValue >= actualTarget) { //Selected valued is within range
-                    currentWaste += (currentValue - actualTarget);
-                    if (currentWaste <= bestWaste) {
+                    const int64_t waste = currentWaste + (currentValue - actualTarget);
+                    if (waste <= bestWaste) {
                         bestSelection = currentSelection;
-                        bestSelection.resize(effectiveUtxos.size());
-                        bestWaste = currentWaste;
+                        bestSelection.resize(values.size());
+                        bestWaste = waste;
                     }
-                    // remove the excess value as we will be selecting different coins now
-                    currentWaste -= (currentValue - actualTarget);
                     backtrack = true;
                 }
 
@@ -286,7 +376,7 @@ namespace ledger {
                     // Walk backwards to find the last included UTXO that still needs to have its omission branch traversed.
                     while (!currentSelection.empty() && !currentSelection.back()) {
                         currentSelection.pop_back();
-                        currentAvailableValue += effectiveUtxos.at(currentSelection.size()).effectiveValue;
+                        currentAvailableValue += values[currentSelection.size()];
                     }
 
                     //Case we walked back to the first utxos and all solutions searched.
@@ -297,26 +387,26 @@ namespace ledger {
 
                     //Output was included on previous iterations, try excluding now
                     currentSelection.back() = false;
-                    auto& eu = effectiveUtxos.at(currentSelection.size() - 1);
-                    currentValue -= eu.effectiveValue;
-                    currentWaste -= (eu.effectiveFees - eu.longTermFees);
+                    currentValue -= values[currentSelection.size() - 1];
+                    currentWaste -= inputWaste;
                 } else { //Moving forwards, continuing down this branch
-                    auto& eu = effectiveUtxos.at(currentSelection.size());
+                    const auto depth = currentSelection.size();
+                    const int64_t value = values[depth];
 
                     //Remove this utxos from currentAvailableValue
-                    currentAvailableValue -= eu.effectiveValue;
+                    currentAvailableValue -= value;
 
-                    // Avoid searching a branch if the previous UTXO has the same value and same waste and was excluded. Since the ratio of fee to
-                    // long term fee is the same, we only need to check if one of those values match in order to know that the waste is the same.
-                    if (!currentSelection.empty() && !currentSelection.back() &&
-                        eu.effectiveValue == effectiveUtxos.at(currentSelection.size() - 1).effectiveValue &&
-                        eu.effectiveFees == effectiveUtxos.at(currentSelection.size() - 1).effectiveFees) {
+                    // Avoid searching a branch if the previous UTXO has the same value and was excluded, every input
+                    // having the same waste. Also skip the inclusion branch when it already overshoots the target range,
+                    // values are positive so nothing below it can come back in range.
+                    if ((depth > 0 && !currentSelection.back() && value == values[depth - 1]) ||
+                        currentValue + value > upperBound) {
                         currentSelection.push_back(false);
                     } else {
                         //Inclusion branch first
                         currentSelection.push_back(true);
-                        currentValue += eu.effectiveValue;
-                        currentWaste += (eu.effectiveFees - eu.longTermFees);
+                        currentValue += value;
+                        currentWaste += inputWaste;
                     }
                 }
             }
@@ -325,46 +415,39 @@ namespace ledger {
             //If no selection found fallback on filterWithDeepFirst
             if (bestSelection.empty()) {
                 buddy->logger->debug("No best selection found, fallback on filterWithKnapsackSolver coin selection");
-                return filterWithKnapsackSolver(buddy, utxos, aggregatedAmount, currency);
+                return selectWithKnapsackSolver(buddy, utxoValues, aggregatedAmount, currency);
             }
 
             //Prepare result
             buddy->logger->debug("Found best selection of size: {}", bestSelection.size());
 
-            std::vector<BitcoinLikeUtxo> out;
-            BigInt bestValue = BigInt::ZERO;
+            std::vector<size_t> out;
             for (size_t i = 0; i < bestSelection.size(); i++) {
-                if (bestSelection.at(i)) {
-                    auto const &eu = effectiveUtxos.at(i);
-
-                    buddy->logger->debug("Choose utxos with value: {}", eu.utxo->value.toLong());
-                    bestValue = bestValue + BigInt(eu.effectiveValue);
-                    out.push_back(std::move(*eu.utxo));
+                if (bestSelection[i]) {
+                    buddy->logger->debug("Choose utxos with value: {}", values[i] + inputEffectiveFees);
+                    out.push_back(order[i]);
                 }
             }
             return out;
         }
 
-        static void approximateBestSubset(const std::vector<BitcoinLikeUtxo> &vUTXOs, const int64_t totalLower, const BigInt &targetValue,
-                                          std::vector<bool>& bestValues, int64_t &bestValue, int64_t inputFees, int iterations = 1000) {
-            std::vector<bool> includedUTXOs;
+        // Values are effective values (input fees deducted), sorted in descending order
+        static void approximateBestSubset(const std::vector<int64_t> &values, const int64_t totalLower, const int64_t targetValue,
+                                          std::vector<char>& bestValues, int64_t &bestValue, FastRandom& random,
+                                          const SelectionDeadline& deadline, int iterations = 1000) {
+            std::vector<char> includedUTXOs;
 
-            bestValues.assign(vUTXOs.size(), true);
+            bestValues.assign(values.size(), true);
             bestValue = totalLower;
 
-            auto insecureRand = [] () -> bool {
-                auto seed = std::chrono::system_clock::now().time_since_epoch().count();
-                return std::default_random_engine(seed)() % 2 == 0;
-            };
-
-            for (int nRep = 0; nRep < iterations && bestValue != targetValue.toInt64(); nRep++)
+            for (int nRep = 0; nRep < iterations && bestValue != targetValue && !deadline.isExpired(); nRep++)
             {
-                includedUTXOs.assign(vUTXOs.size(), false);
+                includedUTXOs.assign(values.size(), false);
                 int64_t total = 0;
                 bool fReachedTarget = false;
                 for (int nPass = 0; nPass < 2 && !fReachedTarget; nPass++)
                 {
-                    for (unsigned int i = 0; i < vUTXOs.size(); i++)
+                    for (size_t i = 0; i < values.size(); i++)
                     {
                         //The solver here uses a randomized algorithm,
                         //the randomness serves no real security purpose but is just
@@ -372,13 +455,11 @@ namespace ledger {
                         //that the rng is fast. We do not use a constant random sequence,
                         //because there may be some privacy improvement by making
                         //the selection random.
-                        if (nPass == 0 ? insecureRand() : !includedUTXOs[i])
+                        if (nPass == 0 ? random.nextBool() : !includedUTXOs[i])
                         {
-                            auto currentAmount = vUTXOs[i].value.toLong() - inputFees;
-
-                            total += currentAmount;
+                            total += values[i];
                             includedUTXOs[i] = true;
-                            if (total >= targetValue.toInt64())
+                            if (total >= targetValue)
                             {
                                 fReachedTarget = true;
                                 if (total < bestValue)
@@ -386,7 +467,7 @@ namespace ledger {
                                     bestValue = total;
                                     bestValues = includedUTXOs;
                                 }
-                                total -= currentAmount;
+                                total -= values[i];
                                 includedUTXOs[i] = false;
                             }
                         }
@@ -401,6 +482,14 @@ namespace ledger {
                 const std::vector<BitcoinLikeUtxo> &utxos,
                 const BigInt &aggregatedAmount,
                 const api::Currency& currency) {
+            return pick(utxos, selectWithKnapsackSolver(buddy, toUtxoValues(utxos), aggregatedAmount, currency));
+        }
+
+        std::vector<size_t> BitcoinLikeStrategyUtxoPicker::selectWithKnapsackSolver(
+                const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                const UtxoValues &utxoValues,
+                const BigInt &aggregatedAmount,
+                const api::Currency& currency) {
 
             //Tx fixed size
             auto const fixedSize = BitcoinLikeTransactionApi::estimateSize(0,
@@ -418,10 +507,11 @@ namespace ledger {
                                                                           currency,
                                                                           buddy->keychain->getKeychainEngine()).Max - fixedSize.Max;
 
-            const int64_t signedUTXOCost = signedUTXOSize * buddy->request.feePerByte->toInt64();
+            const int64_t feePerByte = buddy->request.feePerByte->toInt64();
+            const int64_t signedUTXOCost = signedUTXOSize * feePerByte;
 
             //Amount + fixed size fees + outputs fees
-            const int64_t amountWithFixedFees = buddy->request.feePerByte->toInt64() * (fixedSize.Max + (buddy->request.outputs.size() * oneOutputSize)) + buddy->outputAmount.toInt64();
+            const int64_t amountWithFixedFees = feePerByte * (fixedSize.Max + (buddy->request.outputs.size() * oneOutputSize)) + buddy->outputAmount.toInt64();
 
             // Minimum amount from which we are willing to create a change for it
             // We take the dust as a reference plus the cost of spending this change
@@ -429,70 +519,74 @@ namespace ledger {
 
             buddy->logger->debug("Start filterWithKnapsackSolver, target range is {} to {}", amountWithFixedFees, amountWithFixedFees + minimumChange);
 
+            //One random generator for the whole selection
+            FastRandom random;
+            SelectionDeadline deadline(buddy->request.selectionTimeBudget);
+
             //List of values less than target
             int64_t totalLower = 0;
-            Option<BitcoinLikeUtxo> coinLowestLarger;
-            std::vector<BitcoinLikeUtxo> vUTXOs;
-            std::vector<BitcoinLikeUtxo> out;
+            Option<size_t> coinLowestLarger;
+            int64_t coinLowestLargerValue = 0;
+            std::vector<size_t> lowerIndexes;
+            std::vector<size_t> out;
 
             //Random shuffle utxos
-            std::vector<size_t> indexes(utxos.size());
+            std::vector<size_t> indexes(utxoValues.amounts.size());
             std::iota(indexes.begin(), indexes.end(), 0);
-
-            auto const seed = std::chrono::system_clock::now().time_since_epoch().count();
-            std::shuffle(indexes.begin(), indexes.end(), std::default_random_engine(seed));
+            std::shuffle(indexes.begin(), indexes.end(), random);
 
             //Add fees for a signed input to amount
+            const auto &amounts = utxoValues.amounts;
             for (auto index : indexes) {
-                auto& utxo = utxos[index];
-
-                const int64_t currentAmount = utxo.value.toLong();
+                const int64_t currentAmount = amounts[index];
                 const int64_t currentAmountWithDeductedCost = currentAmount - signedUTXOCost;
                 if (currentAmountWithDeductedCost == amountWithFixedFees) {
                     buddy->logger->debug("Found UTXO with right amount: {}", currentAmount);
-                    out.push_back(utxo);
+                    out.push_back(index);
                     return out;
                 } else if (currentAmountWithDeductedCost < amountWithFixedFees + minimumChange) { //If utxo in range keep it
-                    vUTXOs.push_back(utxo);
+                    lowerIndexes.push_back(index);
                     totalLower += currentAmountWithDeductedCost;
-                } else if (!coinLowestLarger.nonEmpty() || currentAmount < coinLowestLarger.getValue().value.toLong()) { //Keep track of lowest utxos out of range
+                } else if (coinLowestLarger.isEmpty() || currentAmount < coinLowestLargerValue) { //Keep track of lowest utxos out of range
                     buddy->logger->debug("Set lowest out of range UTXO : {} ", currentAmount);
-                    coinLowestLarger = utxo;
+                    coinLowestLarger = index;
+                    coinLowestLargerValue = currentAmount;
                 }
             }
 
             //If exact amount, return vUTXOs
             if (totalLower == amountWithFixedFees) {
                 buddy->logger->debug("Total of lower utxos and amount equal");
-                for (auto& selectedUtxo : vUTXOs) {
-                    out.push_back(selectedUtxo);
-                }
-                return out;
+                return lowerIndexes;
             } else if (totalLower < amountWithFixedFees) {
                 buddy->logger->debug("Total of lower utxos lower than amount equal");
                 //If total lower then and no coinLowestLarger then use filterWithDeepFirst
-                if (!coinLowestLarger.nonEmpty()) {
+                if (coinLowestLarger.isEmpty()) {
                     buddy->logger->debug("No best selection found, fallback on filterWithDeepFirst coin selection");
                     // NOTE: same question here why we use buddy->outputAmount instead of aggregatedAmount
-                    return filterWithDeepFirst(buddy, utxos, buddy->outputAmount, currency);
+                    return selectWithDeepFirst(buddy, utxoValues, buddy->outputAmount, currency);
                 }
             }
 
             //Sort vUTXOs descending
-            std::sort(vUTXOs.begin(), vUTXOs.end(), [](auto const &lhs, auto const &rhs) {
-                return lhs.value.toLong() > rhs.value.toLong();
+            std::sort(lowerIndexes.begin(), lowerIndexes.end(), [&] (size_t lhs, size_t rhs) {
+                return amounts[lhs] > amounts[rhs];
             });
+            std::vector<int64_t> lowerValues(lowerIndexes.size());
+            for (size_t i = 0; i < lowerIndexes.size(); i++) {
+                lowerValues[i] = amounts[lowerIndexes[i]] - signedUTXOCost;
+            }
 
             //Approximate best tries
-            std::vector<bool> bestValues;
+            std::vector<char> bestValues;
             int64_t bestValue = 0;
             buddy->logger->debug("Approximate Best Subset 1st try");
             // Here we target the value amountWithFixedFees which is the amount of tx + fixed fees (fees of transaction without signed UTXOs)
-            approximateBestSubset(vUTXOs, totalLower, BigInt(static_cast<int64_t>(amountWithFixedFees)), bestValues, bestValue, signedUTXOCost);
+            approximateBestSubset(lowerValues, totalLower, amountWithFixedFees, bestValues, bestValue, random, deadline);
             if (bestValue != amountWithFixedFees && totalLower >= amountWithFixedFees + minimumChange) {
                 buddy->logger->debug("First approximation, bestValue {} with {} bestValues", bestValue, bestValues.size());
                 buddy->logger->debug("Approximate Best Subset 2nd try");
-                approximateBestSubset(vUTXOs, totalLower, BigInt((int64_t)amountWithFixedFees + minimumChange), bestValues, bestValue, signedUTXOCost);
+                approximateBestSubset(lowerValues, totalLower, amountWithFixedFees + minimumChange, bestValues, bestValue, random, deadline);
                 buddy->logger->debug("Second approximation, bestValue {} with {} bestValues", bestValue, bestValues.size());
             }
 
@@ -500,14 +594,12 @@ namespace ledger {
             // to be able to update amountWithFixedFees (because after signing all UTXOs we might need to pick additional UTXOs to cover
             // fees generated by adding this UTXOs and their signature)
             int64_t totalBest = 0;
-            std::vector<BitcoinLikeUtxo> tmpOut;
-            for (unsigned int i = 0; i < vUTXOs.size(); i++) {
+            std::vector<size_t> tmpOut;
+            for (size_t i = 0; i < lowerIndexes.size(); i++) {
                 if (bestValues[i])
                 {
-                    auto const& utxo = vUTXOs[i];
-
-                    tmpOut.push_back(utxo);
-                    totalBest += utxo.value.toLong();
+                    tmpOut.push_back(lowerIndexes[i]);
+                    totalBest += amounts[lowerIndexes[i]];
                 }
             }
 
@@ -516,19 +608,19 @@ namespace ledger {
             //If bestValue is different from amountWithFixedFees and coinLowestLarger is lower than bestVaule, then choose coinLowestLarger
             if (coinLowestLarger.nonEmpty() &&
                 ((bestValue != amountWithFixedFees && bestValue < amountWithFixedFees + minimumChange) ||
-                 coinLowestLarger.getValue().value.toLong() - signedUTXOCost <= bestValue))
+                 coinLowestLargerValue - signedUTXOCost <= bestValue))
             {
                 buddy->logger->debug("Add coinLowestLarger to coin selection");
                 out.push_back(coinLowestLarger.getValue());
 
-                buddy->changeAmount =  BigInt(coinLowestLarger.getValue().value.toLong() - signedUTXOCost - (int64_t)(amountWithFixedFees + oneOutputSize * buddy->request.feePerByte->toInt64()));
+                buddy->changeAmount =  BigInt(coinLowestLargerValue - signedUTXOCost - (int64_t)(amountWithFixedFees + oneOutputSize * feePerByte));
             }
             else { //Pick bestValues
                 buddy->logger->debug("Push all vUTXOs");
                 out = tmpOut;
                 // Set amount of change
                 // Change amount = amountWithFixedFees + fees for 1 additional output (change)
-                buddy->changeAmount =  BigInt(bestValue - (int64_t)(amountWithFixedFees + oneOutputSize * buddy->request.feePerByte->toInt64()));
+                buddy->changeAmount =  BigInt(bestValue - (int64_t)(amountWithFixedFees + oneOutputSize * feePerByte));
             }
 
             if (buddy->changeAmount.toInt64() < minimumChange) {
@@ -546,33 +638,36 @@ namespace ledger {
 
             buddy->logger->debug("Start filterWithMergeOutputs");
 
-            return filterWithSort(buddy, utxos, aggregatedAmount, currency, [](auto &lhs, auto &rhs) {
-                return lhs.value.toLong() < rhs.value.toLong();
+            auto utxoValues = toUtxoValues(utxos);
+            std::vector<size_t> order(utxos.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&] (size_t lhs, size_t rhs) {
+                return utxoValues.amounts[lhs] < utxoValues.amounts[rhs];
             });
+            return pick(utxos, selectInOrder(buddy, utxoValues, order, aggregatedAmount, currency));
         }
 
-        std::vector<BitcoinLikeUtxo> BitcoinLikeStrategyUtxoPicker::filterWithSort(
+        std::vector<size_t> BitcoinLikeStrategyUtxoPicker::selectInOrder(
                 const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
-                std::vector<BitcoinLikeUtxo> utxos,
+                const UtxoValues &utxoValues,
+                const std::vector<size_t> &order,
                 BigInt amount,
-                const api::Currency& currency,
-                std::function<bool(BitcoinLikeUtxo&, BitcoinLikeUtxo&)> const& functor)
+                const api::Currency& currency)
         {
-            auto pickedUtxos = std::vector<BitcoinLikeUtxo>{};
+            auto pickedUtxos = std::vector<size_t>{};
             auto pickedInputs = 0;
 
-            pickedUtxos.reserve(utxos.size());
-            std::sort(utxos.begin(), utxos.end(), functor);
+            pickedUtxos.reserve(order.size());
 
             bool enough = false;
-            for (auto const &u : utxos) {
-                amount = amount + *u.value.value();
+            for (auto index : order) {
+                amount = amount + BigInt(static_cast<int64_t>(utxoValues.amounts[index]));
                 pickedInputs += 1;
-                pickedUtxos.push_back(u);
+                pickedUtxos.push_back(index);
 
                 buddy->logger->debug("Collected: {} Needed: {}", amount.toString(), buddy->outputAmount.toString());
 
-                auto const computeOutputAmount = pickedInputs == utxos.size();
+                auto const computeOutputAmount = pickedInputs == order.size();
                 if (hasEnough(buddy, amount, pickedInputs, currency, computeOutputAmount)) {
                     enough = true;
                     break;
@@ -585,10 +680,88 @@ namespace ledger {
 
             buddy->logger->debug("Require {} inputs to complete the transaction with {} for {}", pickedInputs, amount.toString(), buddy->outputAmount.toString());
 
-            pickedUtxos.shrink_to_fit();
-
             return pickedUtxos;
         }
+
+        std::vector<BitcoinLikeUtxo> BitcoinLikeStrategyUtxoPicker::filterWithSource(
+                const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
+                const BigInt &aggregatedAmount,
+                const api::Currency& currency)
+        {
+            auto const minAmount = currency.bitcoinLikeNetworkParameters.value().DustAmount;
+            auto const &excludedUtxos = buddy->request.excludedUtxos;
+            auto const isSpendable = [&] (const BitcoinLikeUtxoRow &row) {
+                return row.value >= minAmount &&
+                       (excludedUtxos.empty() ||
+                        excludedUtxos.count(BitcoinLikeTransactionUtxoDescriptor{row.getTransactionHash(), row.outputIndex}) == 0);
+            };
+
+            //If wipe mode no matter which strategy we use, let's use filterWithDeepFirst (for the moment)
+            auto strategy = api::BitcoinLikePickingStrategy::DEEP_OUTPUTS_FIRST;
+            if (!buddy->request.wipe) {
+                strategy = std::get<0>(buddy->request.utxoPicker.getValue());
+            }
+
+            std::vector<BitcoinLikeUtxoRow> rows;
+            if (strategy == api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE) {
+                // The whole set is needed, only the compact rows are kept in memory
+                buddy->utxoSource->stream(BitcoinLikeUtxoOrder::LARGEST_FIRST, [&] (const BitcoinLikeUtxoRow &row) {
+                    if (isSpendable(row)) {
+                        rows.push_back(row);
+                    }
+                    return true;
+                });
+                if (rows.empty()) {
+                    throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "There is no UTXO on this account.");
+                }
+                UtxoValues utxoValues;
+                utxoValues.amounts.reserve(rows.size());
+                utxoValues.blockHeights.reserve(rows.size());
+                for (const auto &row : rows) {
+                    utxoValues.amounts.push_back(row.value);
+                    utxoValues.blockHeights.push_back(row.blockHeight);
+                }
+                rows = pick(rows, selectWithOptimizeSize(buddy, utxoValues, aggregatedAmount, currency));
+            } else {
+                // Outputs are picked in the streaming order, the iteration stops as soon as there is enough
+                auto const order = strategy == api::BitcoinLikePickingStrategy::MERGE_OUTPUTS ?
+                                   BitcoinLikeUtxoOrder::SMALLEST_FIRST : BitcoinLikeUtxoOrder::DEEP_FIRST;
+                auto amount = aggregatedAmount;
+                bool enough = false;
+                buddy->utxoSource->stream(order, [&] (const BitcoinLikeUtxoRow &row) {
+                    if (!isSpendable(row)) {
+                        return true;
+                    }
+                    rows.push_back(row);
+                    amount = amount + BigInt(static_cast<int64_t>(row.value));
+                    enough = !buddy->request.wipe && hasEnough(buddy, amount, static_cast<int>(rows.size()), currency, false);
+                    return !enough;
+                });
+                if (rows.empty()) {
+                    throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "There is no UTXO on this account.");
+                }
+                if (buddy->request.wipe) {
+                    // Every output is spent, the output amount is what remains once the fees are paid
+                    hasEnough(buddy, amount, static_cast<int>(rows.size()), currency, true);
+                } else if (!enough) {
+                    throw make_exception(api::ErrorCode::NOT_ENOUGH_FUNDS, "Cannot gather enough funds.");
+                }
+                buddy->logger->debug("Require {} inputs to complete the transaction with {} for {}", rows.size(), amount.toString(), buddy->outputAmount.toString());
+            }
+
+            return buddy->utxoSource->resolve(rows);
+        }
+
+        BitcoinLikeStrategyUtxoPicker::UtxoValues BitcoinLikeStrategyUtxoPicker::toUtxoValues(const std::vector<BitcoinLikeUtxo> &utxos) {
+            UtxoValues utxoValues;
+            utxoValues.amounts.reserve(utxos.size());
+            utxoValues.blockHeights.reserve(utxos.size());
+            for (auto const &utxo : utxos) {
+                utxoValues.amounts.push_back(utxo.value.toLong());
+                utxoValues.blockHeights.push_back(utxo.blockHeight.getValueOr(std::numeric_limits<uint64_t>::max()));
+            }
+            return utxoValues;
+        }
     }
 }
 
@@ -70,6 +70,10 @@ namespace ledger {
                 int inputCount,
                 const api::Currency& currrency,
                 bool computeOutputAmount);
+            // Selection over buddy->utxoSource, only the selected outputs are fully loaded
+            static std::vector<BitcoinLikeUtxo> filterWithSource(const std::shared_ptr<Buddy>& buddy,
+                const BigInt& aggregatedAmount,
+                const api::Currency& currency);
         protected:
             Future<std::vector<BitcoinLikeUtxo>> filterInputs(const std::shared_ptr<Buddy> &buddy) override;
 
@@ -83,14 +87,46 @@ namespace ledger {
             static const uint32_t TOTAL_TRIES = 10000;
             static const int64_t CENT = 1000000;
         private:
+            // Amounts and block heights (max when unconfirmed) of the candidate outputs. The selection
+            // algorithms work on these arrays and return the indexes of the selected outputs.
+            struct UtxoValues {
+                std::vector<int64_t> amounts;
+                std::vector<uint64_t> blockHeights;
+            };
+
+            static UtxoValues toUtxoValues(const std::vector<BitcoinLikeUtxo>& utxos);
+
+            template <typename T>
+            static std::vector<T> pick(const std::vector<T>& items, const std::vector<size_t>& indexes) {
+                std::vector<T> picked;
+                picked.reserve(indexes.size());
+                for (auto index : indexes) {
+                    picked.push_back(items[index]);
+                }
+                return picked;
+            }
+
+            static std::vector<size_t> selectWithDeepFirst(const std::shared_ptr<Buddy>& buddy,
+                const UtxoValues& utxoValues,
+                const BigInt& aggregatedAmount,
+                const api::Currency& currency);
+
+            static std::vector<size_t> selectWithOptimizeSize(const std::shared_ptr<Buddy>& buddy,
+                const UtxoValues& utxoValues,
+                const BigInt& aggregatedAmount,
+                const api::Currency& currency);
+
+            static std::vector<size_t> selectWithKnapsackSolver(const std::shared_ptr<Buddy>& buddy,
+                const UtxoValues& utxoValues,
+                const BigInt& aggregatedAmount,
+                const api::Currency& currency);
 
-            static std::vector<BitcoinLikeUtxo> filterWithSort(
-                const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> &buddy,
-                std::vector<BitcoinLikeUtxo> utxos,
+            // Pick outputs in the given order until there is enough
+            static std::vector<size_t> selectInOrder(const std::shared_ptr<Buddy>& buddy,
+                const UtxoValues& utxoValues,
+                const std::vector<size_t>& order,
                 BigInt amount,
-                const api::Currency &currency,
-                std::function<bool(BitcoinLikeUtxo&, BitcoinLikeUtxo&)> const& functor
-            );
+                const api::Currency& currency);
         };
     }
 }
@@ -59,13 +59,15 @@ namespace ledger {
         BitcoinLikeTransactionBuilder::BitcoinLikeTransactionBuilder(
                 const std::shared_ptr<api::ExecutionContext> &context, const api::Currency &currency,
                 const std::shared_ptr<spdlog::logger> &logger,
-                const BitcoinLikeTransactionBuildFunction &buildFunction) :
+                const BitcoinLikeTransactionBuildFunction &buildFunction,
+                const Option<std::chrono::milliseconds> &selectionTimeBudget) :
                 _request(std::make_shared<BigInt>(currency.bitcoinLikeNetworkParameters.value().DustAmount)) {
             _currency = currency;
             _build = buildFunction;
             _context = context;
             _logger = logger;
             _request.wipe = false;
+            _request.selectionTimeBudget = selectionTimeBudget;
         }
 
         std::shared_ptr<api::BitcoinLikeTransactionBuilder>
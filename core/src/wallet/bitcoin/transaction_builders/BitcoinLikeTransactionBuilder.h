@@ -32,6 +32,7 @@
 #ifndef LEDGER_CORE_BITCOINLIKETRANSACTIONBUILDER_H
 #define LEDGER_CORE_BITCOINLIKETRANSACTIONBUILDER_H
 
+#include <chrono>
 #include <unordered_set>
 
 #include <api/BitcoinLikeTransactionBuilder.hpp>
@@ -81,6 +82,8 @@ namespace ledger {
             std::shared_ptr<BigInt> maxChange;
             std::shared_ptr<BigInt> minChange;
             bool wipe;
+            // Maximum time spent searching for the best coin selection, unbounded when empty
+            Option<std::chrono::milliseconds> selectionTimeBudget;
         };
 
         using BitcoinLikeTransactionBuildFunction = std::function<Future<std::shared_ptr<api::BitcoinLikeTransaction>> (const BitcoinLikeTransactionBuildRequest&)>;
@@ -91,7 +94,8 @@ namespace ledger {
                     const std::shared_ptr<api::ExecutionContext>& context,
                     const api::Currency& params,
                     const std::shared_ptr<spdlog::logger>& logger,
-                    const BitcoinLikeTransactionBuildFunction& buildFunction);
+                    const BitcoinLikeTransactionBuildFunction& buildFunction,
+                    const Option<std::chrono::milliseconds>& selectionTimeBudget = Option<std::chrono::milliseconds>());
             BitcoinLikeTransactionBuilder(const BitcoinLikeTransactionBuilder& cpy);
             std::shared_ptr<api::BitcoinLikeTransactionBuilder>
             addInput(const std::string &transactionHash, int32_t index, int32_t sequence) override;
@@ -51,7 +51,8 @@ namespace ledger {
                                                 const std::shared_ptr<BitcoinLikeKeychain> &keychain,
                                                 const uint64_t currentBlockHeight,
                                                 const std::shared_ptr<spdlog::logger>& logger,
-                                                bool partial)
+                                                bool partial,
+                                                const std::shared_ptr<BitcoinLikeUtxoSource>& utxoSource)
         {
             auto self = shared_from_this();
             logger->info("Get build function");
@@ -60,7 +61,7 @@ namespace ledger {
                     logger->info("Constructing BitcoinLikeTransactionBuildFunction with blockHeight: {}", currentBlockHeight);
                     auto tx = std::make_shared<BitcoinLikeTransactionApi>(self->_currency, keychain->getKeychainEngine(), currentBlockHeight);
                     auto filteredGetUtxo = createFilteredUtxoFunction(r, keychain, getUtxo);
-                    return std::make_shared<Buddy>(r, filteredGetUtxo, getTransaction, explorer, keychain, logger, tx, partial);
+                    return std::make_shared<Buddy>(r, filteredGetUtxo, getTransaction, explorer, keychain, logger, tx, partial, utxoSource);
                 }).flatMap<std::shared_ptr<api::BitcoinLikeTransaction>>(self->getContext(), [=] (const std::shared_ptr<Buddy>& buddy) -> Future<std::shared_ptr<api::BitcoinLikeTransaction>> {
                     buddy->logger->info("Buddy created");
                     return self->fillInputs(buddy).flatMap<Unit>(self->getContext(), [=] (const Unit&) -> Future<Unit> {
@@ -41,6 +41,7 @@
 #include <async/Future.hpp>
 #include <api/BitcoinLikeOutput.hpp>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxo.hpp>
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxoSource.hpp>
 
 namespace ledger {
     namespace core {
@@ -62,7 +63,8 @@ namespace ledger {
                     const std::shared_ptr<BitcoinLikeKeychain>& keychain,
                     const uint64_t currentBlockHeight,
                     const std::shared_ptr<spdlog::logger>& logger,
-                    bool partial);
+                    bool partial,
+                    const std::shared_ptr<BitcoinLikeUtxoSource>& utxoSource = nullptr);
             const api::Currency& getCurrency() const;
 
             struct Buddy {
@@ -74,8 +76,9 @@ namespace ledger {
                         const std::shared_ptr<BitcoinLikeKeychain>& k,
                         const std::shared_ptr<spdlog::logger>& l,
                         std::shared_ptr<BitcoinLikeTransactionApi> t,
-                        bool partial) : request(r), explorer(e), keychain(k), transaction(t), getUtxo(g),
-                          getTransaction(tx), logger(l), isPartial(partial)
+                        bool partial,
+                        const std::shared_ptr<BitcoinLikeUtxoSource>& s = nullptr) : request(r), explorer(e), keychain(k), transaction(t), getUtxo(g),
+                          getTransaction(tx), logger(l), isPartial(partial), utxoSource(s)
                 {
                     if(request.wipe) {
                         outputAmount = ledger::core::BigInt::ZERO;
@@ -94,6 +97,8 @@ namespace ledger {
                 std::shared_ptr<spdlog::logger> logger;
                 BigInt changeAmount;
                 bool isPartial;
+                // When set, strategies stream the outputs from it instead of loading them all with getUtxo
+                std::shared_ptr<BitcoinLikeUtxoSource> utxoSource;
             };
         protected:
             virtual Future<Unit> fillInputs(const std::shared_ptr<Buddy>& buddy);
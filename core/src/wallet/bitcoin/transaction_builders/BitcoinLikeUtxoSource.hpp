@@ -0,0 +1,86 @@
+/*
+ *
+ * BitcoinLikeUtxoSource
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <wallet/bitcoin/transaction_builders/BitcoinLikeUtxo.hpp>
+
+namespace ledger {
+    namespace core {
+
+        // Compact representation of a spendable output, only what the coin selection needs.
+        // The full BitcoinLikeUtxo is loaded for the selected outputs only.
+        struct BitcoinLikeUtxoRow {
+            static constexpr size_t HASH_LENGTH = 64;
+
+            // Hex encoded transaction hash (not null terminated)
+            std::array<char, HASH_LENGTH> transactionHash;
+            uint32_t outputIndex;
+            int64_t value;
+            // std::numeric_limits<uint64_t>::max() when the output is not confirmed yet
+            uint64_t blockHeight;
+
+            std::string getTransactionHash() const {
+                return std::string(transactionHash.data(), transactionHash.size());
+            }
+        };
+
+        enum class BitcoinLikeUtxoOrder {
+            // Ascending block height, unconfirmed outputs last
+            DEEP_FIRST,
+            // Descending amount
+            LARGEST_FIRST,
+            // Ascending amount
+            SMALLEST_FIRST
+        };
+
+        // Spendable outputs of an account, streamed in a given order
+        class BitcoinLikeUtxoSource {
+        public:
+            virtual ~BitcoinLikeUtxoSource() = default;
+
+            // Call visitor on every spendable output in the given order, stops as soon as the visitor returns false
+            virtual void stream(BitcoinLikeUtxoOrder order,
+                                const std::function<bool (const BitcoinLikeUtxoRow&)>& visitor) = 0;
+
+            // Load the full outputs of the given rows, in the same order
+            virtual std::vector<BitcoinLikeUtxo> resolve(const std::vector<BitcoinLikeUtxoRow>& rows) = 0;
+        };
+
+    }
+}
@@ -57,6 +57,7 @@ namespace ledger {
             _logger = wallet->logger();
             _type = wallet->getWalletType();
             _publisher = std::make_shared<EventPublisher>(getContext());
+            _publisher->setLogger(_logger);
         }
 
         int32_t AbstractAccount::getIndex() {
@@ -224,6 +225,13 @@ namespace ledger {
         }
 
         void AbstractAccount::pushEvent(const std::shared_ptr<api::Event> &event) {
+            {
+                std::lock_guard<std::mutex> lock(_eventsLock);
+                if (_stagingThread == std::this_thread::get_id()) {
+                    _stagedEvents.push_back(event);
+                    return;
+                }
+            }
             auto self = shared_from_this();
             run([event, self] () {
                 std::lock_guard<std::mutex> lock(self->_eventsLock);
@@ -231,6 +239,55 @@ namespace ledger {
             });
         }
 
+        bool AbstractAccount::isStagingChanges() {
+            std::lock_guard<std::mutex> lock(_eventsLock);
+            return _stagingThread == std::this_thread::get_id();
+        }
+
+        void AbstractAccount::stageChanges() {
+            {
+                std::lock_guard<std::mutex> lock(_eventsLock);
+                _stagingThread = std::this_thread::get_id();
+                _stagedEvents.clear();
+            }
+            stageLocalChanges();
+        }
+
+        AbstractAccount::StagingMark AbstractAccount::markStagedChanges() {
+            StagingMark mark;
+            {
+                std::lock_guard<std::mutex> lock(_eventsLock);
+                mark.events = _stagedEvents.size();
+            }
+            mark.local = markLocalChanges();
+            return mark;
+        }
+
+        void AbstractAccount::dropStagedChanges(const StagingMark& mark) {
+            {
+                std::lock_guard<std::mutex> lock(_eventsLock);
+                if (mark.events < _stagedEvents.size()) {
+                    _stagedEvents.resize(mark.events);
+                }
+            }
+            dropLocalChanges(mark.local);
+        }
+
+        void AbstractAccount::commitStagedChanges() {
+            commitLocalChanges();
+            std::lock_guard<std::mutex> lock(_eventsLock);
+            _events.insert(_events.end(), _stagedEvents.begin(), _stagedEvents.end());
+            _stagedEvents.clear();
+            _stagingThread = std::thread::id();
+        }
+
+        void AbstractAccount::discardStagedChanges() {
+            discardLocalChanges();
+            std::lock_guard<std::mutex> lock(_eventsLock);
+            _stagedEvents.clear();
+            _stagingThread = std::thread::id();
+        }
+
         Future<api::Block> AbstractAccount::getLastBlock() {
             return getWallet()->getLastBlock();
         }
@@ -51,6 +51,7 @@
 #include <api/ErrorCodeCallback.hpp>
 #include <api/TimePeriod.hpp>
 #include <mutex>
+#include <thread>
 
 namespace ledger {
     namespace core {
@@ -109,6 +110,20 @@ namespace ledger {
 
             void emitEventsNow();
 
+            // What the calling thread changes outside of the database while writing operations, the events
+            // it pushes and the account specific state of the *LocalChanges hooks, is staged until it is
+            // committed, so that a synchronizer can drop the changes of writes it rolls back or replays.
+            struct StagingMark {
+                size_t events;
+                size_t local;
+            };
+            void stageChanges();
+            StagingMark markStagedChanges();
+            // Drop the changes staged since mark was taken
+            void dropStagedChanges(const StagingMark& mark);
+            void commitStagedChanges();
+            void discardStagedChanges();
+
             void eraseDataSince(const std::chrono::system_clock::time_point & date, const std::shared_ptr<api::ErrorCodeCallback> & callback) override ;
             virtual Future<api::ErrorCode> eraseDataSince(const std::chrono::system_clock::time_point & date) = 0;
             void eraseSynchronizerDataSince(soci::session &sql, const std::chrono::system_clock::time_point & date);
@@ -117,6 +132,16 @@ namespace ledger {
             void emitNewOperationEvent(const Operation& operation);
             void emitNewBlockEvent(const Block& block);
             void pushEvent(const std::shared_ptr<api::Event>& event);
+            // Whether the calling thread stages its changes
+            bool isStagingChanges();
+
+            // Account specific staging, called on the staging thread. stageLocalChanges also undoes what a
+            // previous staging left uncommitted. Accounts without such state stage nothing.
+            virtual void stageLocalChanges() {}
+            virtual size_t markLocalChanges() { return 0; }
+            virtual void dropLocalChanges(size_t mark) {}
+            virtual void commitLocalChanges() {}
+            virtual void discardLocalChanges() {}
 
         private:
             api::WalletType  _type;
@@ -132,6 +157,8 @@ namespace ledger {
             std::shared_ptr<EventPublisher> _publisher;
             std::mutex _eventsLock;
             std::list<std::shared_ptr<api::Event>> _events;
+            std::thread::id _stagingThread;
+            std::vector<std::shared_ptr<api::Event>> _stagedEvents;
         };
     }
 }
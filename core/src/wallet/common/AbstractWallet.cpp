@@ -69,6 +69,7 @@ namespace ledger {
             _internalPreferences = pool->getInternalPreferences()->getSubPreferences(
                     fmt::format("wallet_{}", walletName));
             _publisher = std::make_shared<EventPublisher>(getContext());
+            _publisher->setLogger(pool->logger());
             _logger = pool->logger();
             _loggerApi = std::make_shared<LoggerApi>(pool->logger());
             _database = pool->getDatabaseSessionPool();
@@ -262,11 +263,9 @@ namespace ledger {
         }
 
         FuturePtr<api::Account> AbstractWallet::getAccount(int32_t index) {
-            auto it = _accounts.find(index);
-            if (it != _accounts.end()) {
-                auto ptr = it->second;
-                if (ptr != nullptr)
-                    return FuturePtr<api::Account>::successful(ptr);
+            auto cached = getAccountInstanceFromCache(index);
+            if (cached != nullptr) {
+                return FuturePtr<api::Account>::successful(cached);
             }
             auto self = shared_from_this();
             return FuturePtr<api::Account>::async(getPool()->getThreadPoolExecutionContext(), [self, index] () -> std::shared_ptr<api::Account> {
@@ -274,9 +273,7 @@ namespace ledger {
                 if (!AccountDatabaseHelper::accountExists(sql, self->getWalletUid(), index)) {
                     throw make_exception(api::ErrorCode::ACCOUNT_NOT_FOUND, "Account {}, for wallet '{}', doesn't exist", index,  self->getName());
                 }
-                auto account = self->createAccountInstance(sql, AccountDatabaseHelper::createAccountUid(self->getWalletUid(), index));
-                self->addAccountInstanceToInstanceCache(account);
-                return account;
+                return self->restoreAccountInstance(sql, index);
             });
         }
 
@@ -290,20 +287,52 @@ namespace ledger {
             return Future<std::vector<std::shared_ptr<api::Account>>>::async(getPool()->getThreadPoolExecutionContext(), [=] () {
                 std::vector<Future<std::shared_ptr<api::Account>> > accounts;
                 std::list<int32_t> indexes;
-                soci::session sql(getDatabase()->getPool());
-                AccountDatabaseHelper::getAccountsIndexes(sql, getWalletUid(), offset, count, indexes);
+                {
+                    soci::session sql(getDatabase()->getPool());
+                    AccountDatabaseHelper::getAccountsIndexes(sql, getWalletUid(), offset, count, indexes);
+                }
+                // Indexes come from the database, missing instances are restored in parallel on the thread pool
+                auto threadPool = getPool()->getThreadPoolExecutionContext();
                 for (auto& index : indexes) {
-                    accounts.push_back(getAccount(index));
+                    auto cached = getAccountInstanceFromCache(index);
+                    if (cached != nullptr) {
+                        accounts.push_back(FuturePtr<api::Account>::successful(cached));
+                        continue;
+                    }
+                    accounts.push_back(FuturePtr<api::Account>::async(threadPool, [self, index] () -> std::shared_ptr<api::Account> {
+                        soci::session sql(self->getDatabase()->getPool());
+                        return self->restoreAccountInstance(sql, index);
+                    }));
                 }
                 return core::async::sequence(getMainExecutionContext(), accounts);
             });
         }
 
         void AbstractWallet::addAccountInstanceToInstanceCache(const std::shared_ptr<AbstractAccount> &account) {
+            std::lock_guard<std::mutex> lock(_accountsLock);
             _accounts[account->getIndex()] = account;
             _publisher->relay(account->getEventBus());
         }
 
+        std::shared_ptr<AbstractAccount> AbstractWallet::getAccountInstanceFromCache(int32_t index) {
+            std::lock_guard<std::mutex> lock(_accountsLock);
+            auto it = _accounts.find(index);
+            return it != _accounts.end() ? it->second : nullptr;
+        }
+
+        std::shared_ptr<AbstractAccount> AbstractWallet::restoreAccountInstance(soci::session &sql, int32_t index) {
+            auto account = createAccountInstance(sql, AccountDatabaseHelper::createAccountUid(getWalletUid(), index));
+            std::lock_guard<std::mutex> lock(_accountsLock);
+            // The account may have been restored concurrently, keep a single instance
+            auto it = _accounts.find(index);
+            if (it != _accounts.end() && it->second != nullptr) {
+                return it->second;
+            }
+            _accounts[index] = account;
+            _publisher->relay(account->getEventBus());
+            return account;
+        }
+
         std::shared_ptr<WalletPool> AbstractWallet::getPool() const {
             auto pool = _pool.lock();
             if (!pool)
@@ -326,7 +355,6 @@ namespace ledger {
         Future<api::ErrorCode> AbstractWallet::eraseDataSince(const std::chrono::system_clock::time_point &date) {
             auto self = shared_from_this();
             auto uid = getWalletUid();
-            //auto accounts = _accounts;
             _logger->debug("Start erasing data of wallet : {} since : {}", uid, DateUtils::toJSON(date));
             static std::function<Future<api::ErrorCode> (int , const std::unordered_map<int32_t, std::shared_ptr<AbstractAccount>> &)> eraseAccount = [date] (int index, const std::unordered_map<int32_t, std::shared_ptr<AbstractAccount>> &accountsToErase) -> Future<api::ErrorCode> {
 
@@ -343,7 +371,12 @@ namespace ledger {
                     return eraseAccount(index + 1, accountsToErase);
                 });
             };
-            return eraseAccount(0, _accounts).flatMap<api::ErrorCode>(ImmediateExecutionContext::INSTANCE, [self, date, uid] (const api::ErrorCode &err) {
+            std::unordered_map<int32_t, std::shared_ptr<AbstractAccount>> accounts;
+            {
+                std::lock_guard<std::mutex> lock(_accountsLock);
+                accounts = _accounts;
+            }
+            return eraseAccount(0, accounts).flatMap<api::ErrorCode>(ImmediateExecutionContext::INSTANCE, [self, date, uid] (const api::ErrorCode &err) {
 
                 if (err != api::ErrorCode::FUTURE_WAS_SUCCESSFULL) {
                     return Future<api::ErrorCode>::failure(make_exception(api::ErrorCode::RUNTIME_ERROR, "Failed to erase accounts of wallet {}", uid));
@@ -355,9 +388,12 @@ namespace ledger {
                                                                     "WHERE wallet_uid = :wallet_uid AND created_at >= :date",
                                                                     soci::use(uid), soci::use(date));
 
-                for (auto& account : accounts) {
-                    if (account.get_indicator(0) != soci::i_null) {
-                        self->_accounts.erase(account.get<int32_t>(0));
+                {
+                    std::lock_guard<std::mutex> lock(self->_accountsLock);
+                    for (auto& account : accounts) {
+                        if (account.get_indicator(0) != soci::i_null) {
+                            self->_accounts.erase(account.get<int32_t>(0));
+                        }
                     }
                 }
                 sql << "DELETE FROM accounts WHERE wallet_uid = :wallet_uid AND created_at >= :date", soci::use(uid), soci::use(date);
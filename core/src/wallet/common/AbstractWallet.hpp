@@ -52,6 +52,7 @@
 #include <api/DynamicObject.hpp>
 #include <utils/TTLCache.h>
 #include <wallet/common/Amount.h>
+#include <mutex>
 
 namespace ledger {
     namespace core {
@@ -163,6 +164,9 @@ namespace ledger {
             void addAccountInstanceToInstanceCache(const std::shared_ptr<AbstractAccount>& account);
 
         private:
+            std::shared_ptr<AbstractAccount> getAccountInstanceFromCache(int32_t index);
+            std::shared_ptr<AbstractAccount> restoreAccountInstance(soci::session& sql, int32_t index);
+
             std::string _name;
             std::string _uid;
             std::shared_ptr<spdlog::logger> _logger;
@@ -176,6 +180,7 @@ namespace ledger {
             std::shared_ptr<DynamicObject> _configuration;
             DerivationScheme _scheme;
             std::weak_ptr<WalletPool> _pool;
+            std::mutex _accountsLock;
             std::unordered_map<int32_t, std::shared_ptr<AbstractAccount>> _accounts;
             TTLCache<std::string, Amount> _balanceCache;
         };
@@ -35,6 +35,8 @@
 #include <database/soci-date.h>
 #include <database/soci-number.h>
 #include <utils/DateUtils.hpp>
+#include <database/BulkDatabaseHelper.hpp>
+#include <algorithm>
 
 using namespace soci;
 
@@ -122,32 +124,51 @@ namespace ledger {
             return Option<api::Block>();
         }
 
-        void AccountDatabaseHelper::removeBlockOperation(soci::session& sql, const std::string& accountUid,  const std::vector<std::string> blocks)
-        {
-            if (!blocks.empty())
-            {
-                sql << "DELETE FROM blocks where uid IN (:uids)",
-                    soci::use(blocks);
-
-                soci::rowset<std::string> rows_tx = (sql.prepare << "SELECT transaction_uid FROM bitcoin_operations AS bop "
-                                                                    "JOIN operations AS op ON bop.uid = op.uid "
-                                                                    "WHERE op.account_uid = :uid AND op.block_uid IN (:b_uids)",
-                                                     soci::use(accountUid), soci::use(blocks));
+        void AccountDatabaseHelper::eraseBlocksFromHeight(soci::session& sql, const std::string& currencyName, int64_t height) {
+            long long fromHeight = height;
+            // Bitcoin inputs are only referenced by their transactions, the other rows go with the blocks
+            // through ON DELETE CASCADE
+            sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
+                   "SELECT ti.input_uid FROM bitcoin_transaction_inputs AS ti "
+                   "JOIN bitcoin_transactions AS tx ON tx.transaction_uid = ti.transaction_uid "
+                   "JOIN blocks AS b ON b.uid = tx.block_uid "
+                   "WHERE b.currency_name = :currency_name AND b.height >= :height"
+                   ")", use(currencyName), use(fromHeight);
+            // Local ERC20 balances include the transfers about to be erased, drop them so that they are
+            // reconciled with the explorer on next read
+            sql << "DELETE FROM erc20_account_balances WHERE account_uid IN ("
+                   "SELECT e.account_uid FROM erc20_operations AS e "
+                   "JOIN operations AS o ON o.uid = e.ethereum_operation_uid "
+                   "JOIN blocks AS b ON b.uid = o.block_uid "
+                   "WHERE b.currency_name = :currency_name AND b.height >= :height"
+                   ")", use(currencyName), use(fromHeight);
+            sql << "DELETE FROM blocks WHERE currency_name = :currency_name AND height >= :height",
+                    use(currencyName), use(fromHeight);
+        }
 
-                std::vector<std::string> txToDelete(rows_tx.begin(), rows_tx.end());
-                if (!txToDelete.empty())
+        void AccountDatabaseHelper::eraseOperations(soci::session& sql, const std::string& accountUid, const std::vector<std::string>& uids) {
+            auto uidsPerQuery = BulkDatabaseHelper::MAX_BOUND_PARAMETERS - 1;
+            for (size_t offset = 0; offset < uids.size(); offset += uidsPerQuery) {
+                auto count = std::min(uidsPerQuery, uids.size() - offset);
                 {
-                    sql << "DELETE FROM bitcoin_inputs WHERE uid IN ("
-                           "SELECT input_uid FROM bitcoin_transaction_inputs "
-                           "WHERE transaction_uid IN(:uids)"
-                           ")",
-                        soci::use(txToDelete);
-                    sql << "DELETE FROM operations WHERE account_uid = :uid AND block_uid is IN (:b_uids)",
-                        soci::use(accountUid), soci::use(blocks);
-                    sql << "DELETE FROM bitcoin_transactions "
-                           "WHERE transaction_uid IN (:uids)",
-                        soci::use(txToDelete);
+                    // Local ERC20 balances include the transfers of dropped operations, they are reconciled on next read
+                    BulkDatabaseHelper::Statement statement = (sql.prepare << "DELETE FROM erc20_account_balances WHERE account_uid IN ("
+                            "SELECT account_uid FROM erc20_operations "
+                            "WHERE ethereum_operation_uid IN (" << BulkDatabaseHelper::placeholders(count) << "))");
+                    for (size_t index = offset; index < offset + count; index++) {
+                        statement, use(uids[index]);
+                    }
+                    soci::statement st(statement);
+                    st.execute(true);
+                }
+                BulkDatabaseHelper::Statement statement = (sql.prepare << "DELETE FROM operations "
+                        "WHERE account_uid = :uid AND uid IN (" << BulkDatabaseHelper::placeholders(count) << ")");
+                statement, use(accountUid);
+                for (size_t index = offset; index < offset + count; index++) {
+                    statement, use(uids[index]);
                 }
+                soci::statement st(statement);
+                st.execute(true);
             }
         }
 
@@ -34,6 +34,7 @@
 #include <string>
 #include <soci.h>
 #include <list>
+#include <vector>
 #include <api/Block.hpp>
 #include <utils/Option.hpp>
 namespace ledger {
@@ -45,7 +46,11 @@ namespace ledger {
             static int32_t getAccountsCount(soci::session& sql, const std::string& walletUid);
             static void createAccount(soci::session& sql, const std::string& walletUid, int32_t index);
             static void removeAccount(soci::session& sql, const std::string& walletUid, int32_t index);
-            static void removeBlockOperation(soci::session& sql, const std::string& accountUid,  const std::vector<std::string> blocks);
+            // Remove the blocks of a currency from height (included), along with their operations and
+            // transactions, in a fixed number of statements whatever the depth.
+            static void eraseBlocksFromHeight(soci::session& sql, const std::string& currencyName, int64_t height);
+            // Remove operations of an account by uid, with as few statements as the bound parameters limit allows
+            static void eraseOperations(soci::session& sql, const std::string& accountUid, const std::vector<std::string>& uids);
             static std::string createAccountUid(const std::string& walletUid, int32_t accountIndex);
             static std::string createERC20AccountUid(const std::string &ethAccountUid, const std::string &contractAddress);
             static int32_t computeNextAccountIndex(soci::session& sql, const std::string& walletUid);
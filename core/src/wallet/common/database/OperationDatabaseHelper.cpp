@@ -148,6 +148,41 @@ namespace ledger {
                                                  const std::string &accountUid,
                                                  std::vector<Operation> &operations,
                                                  std::function<bool(const std::string &address)> filter) {
+            return queryAccountOperations(sql, accountUid, filter, [&] (const soci::row& row, api::OperationType type) {
+                Operation operation;
+
+                operation.amount = BigInt::fromHex(row.get<std::string>(0));
+                operation.fees = BigInt::fromHex(row.get<std::string>(1));
+                operation.type = type;
+                operation.date = DateUtils::fromJSON(row.get<std::string>(3));
+
+                operations.push_back(operation);
+            });
+        }
+
+        std::size_t
+        OperationDatabaseHelper::queryOperationAmounts(soci::session &sql,
+                                                       const std::string &accountUid,
+                                                       std::vector<OperationAmount> &operations,
+                                                       std::function<bool(const std::string &address)> filter) {
+            auto fromHex = [] (const std::string& hex) {
+                return hex.empty() ? UInt256() : UInt256::fromHex(hex);
+            };
+            return queryAccountOperations(sql, accountUid, filter, [&] (const soci::row& row, api::OperationType type) {
+                OperationAmount operation;
+                operation.amount = fromHex(row.get<std::string>(0));
+                operation.fees = fromHex(row.get<std::string>(1));
+                operation.type = type;
+                operation.date = DateUtils::fromJSON(row.get<std::string>(3));
+                operations.push_back(operation);
+            });
+        }
+
+        std::size_t
+        OperationDatabaseHelper::queryAccountOperations(soci::session &sql,
+                                                        const std::string &accountUid,
+                                                        const std::function<bool(const std::string &address)> &filter,
+                                                        const std::function<void(const soci::row &row, api::OperationType type)> &visitor) {
             rowset<row> rows = (sql.prepare <<
                                             "SELECT op.amount, op.fees, op.type, op.date, op.senders, op.recipients"
                                                     " FROM operations AS op "
@@ -170,15 +205,7 @@ namespace ledger {
                 auto recipients = strings::split(row.get<std::string>(5), ",");
                 if ((type == api::OperationType::SEND && row.get_indicator(4) != i_null && filterList(senders)) ||
                     (type == api::OperationType::RECEIVE && row.get_indicator(5) != i_null && filterList(recipients))) {
-                    Operation operation;
-
-                    operation.amount = BigInt::fromHex(row.get<std::string>(0));
-                    operation.fees = BigInt::fromHex(row.get<std::string>(1));
-                    operation.type = type;
-                    operation.date = DateUtils::fromJSON(row.get<std::string>(3));
-
-                    operations.push_back(operation);
-
+                    visitor(row, type);
                     c += 1;
                 }
             }
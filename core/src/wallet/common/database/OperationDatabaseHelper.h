@@ -33,11 +33,21 @@
 
 #include <api/OperationType.hpp>
 #include <wallet/common/Operation.h>
+#include <math/FixedWidthInt.hpp>
 #include <soci.h>
+#include <chrono>
 #include <string>
 
 namespace ledger {
     namespace core {
+        // Amount columns of an operation, decoded straight into fixed width integers
+        struct OperationAmount {
+            api::OperationType type;
+            std::chrono::system_clock::time_point date;
+            UInt256 amount;
+            UInt256 fees;
+        };
+
         class OperationDatabaseHelper {
         public:
             static bool putOperation(soci::session& sql,
@@ -52,7 +62,17 @@ namespace ledger {
                                                const std::string &accountUid,
                                                std::vector<Operation>& out,
                                                std::function<bool (const std::string& address)> filter);
+
+            // Same selection as queryOperations, but only decodes the amounts, fees, type and date
+            static std::size_t queryOperationAmounts(soci::session &sql,
+                                                     const std::string &accountUid,
+                                                     std::vector<OperationAmount>& out,
+                                                     std::function<bool (const std::string& address)> filter);
         private:
+            static std::size_t queryAccountOperations(soci::session &sql,
+                                                      const std::string &accountUid,
+                                                      const std::function<bool (const std::string& address)>& filter,
+                                                      const std::function<void (const soci::row& row, api::OperationType type)>& visitor);
             static void updateCurrencyOperation(soci::session& sql,
                                                 const Operation& operation,
                                                 bool insert);
@@ -51,6 +51,9 @@ namespace ledger {
                 std::vector<Transaction> transactions;
                 bool hasNext;
                 std::string paginationMarker; //Needed for pagination for XRP: https://developers.ripple.com/markers-and-pagination.html
+                // Block the next page starts from when it is not the block of the last transaction,
+                // set when the bulks of several requests are merged
+                Option<Block> resumeBlock;
             };
 
             virtual Future<void *> startSession() = 0;
@@ -39,6 +39,7 @@
 #include <utils/hex.h>
 #include <net/HttpClient.hpp>
 #include <wallet/common/explorers/LedgerApiParser.hpp>
+#include <wallet/common/explorers/ExplorerRequestBatcher.hpp>
 #include <wallet/common/Block.h>
 #include <utils/JSONUtils.h>
 #include <sstream>
@@ -55,6 +56,21 @@ namespace ledger {
                             Option<std::string> fromBlockHash,
                             Option<void *> session,
                             bool isSnakeCase = false) {
+                // Addresses that don't fit in one URL are split into concurrent requests
+                auto self = getSharedFromThis();
+                std::function<FuturePtr<TransactionsBulk> (const std::vector<std::string> &)> fetch =
+                        [self, fromBlockHash, session, isSnakeCase] (const std::vector<std::string> &chunk) {
+                            return self->getLedgerApiTransactionsChunk(chunk, fromBlockHash, session, isSnakeCase);
+                        };
+                return explorers::getBatchedTransactions<TransactionsBulk>(getExplorerContext(), getConnectionBudget(),
+                                                                           addresses, fetch);
+            };
+
+            FuturePtr<TransactionsBulk>
+            getLedgerApiTransactionsChunk(const std::vector<std::string> &addresses,
+                                          Option<std::string> fromBlockHash,
+                                          Option<void *> session,
+                                          bool isSnakeCase) {
                 auto joinedAddresses = Array<std::string>(addresses).join(strings::mkString(",")).getValueOr("");
                 std::string params;
                 std::unordered_map<std::string, std::string> headers;
@@ -92,6 +108,7 @@ namespace ledger {
             FuturePtr<Block>
             getLedgerApiCurrentBlock() const {
                 return _http->GET(fmt::format("/blockchain/{}/{}/blocks/current", getExplorerVersion(), getNetworkParameters().Identifier))
+                        .cacheable()
                         .template json<Block, Exception>(LedgerApiParser<Block, BlockParser>())
                         .template mapPtr<Block>(getExplorerContext(), [] (const Either<Exception, std::shared_ptr<Block>>& result) {
                             if (result.isLeft()) {
@@ -163,6 +180,12 @@ namespace ledger {
             virtual std::shared_ptr<api::ExecutionContext> getExplorerContext() const = 0;
             virtual NetworkParameters getNetworkParameters() const = 0;
             virtual std::string getExplorerVersion() const = 0;
+            virtual std::shared_ptr<AbstractLedgerApiBlockchainExplorer> getSharedFromThis() = 0;
+
+            std::shared_ptr<HostConnectionBudget> getConnectionBudget() const {
+                return HostConnectionBudget::forUrl(_http->getBaseUrl());
+            }
+
             std::shared_ptr<HttpClient> _http;
         };
     }
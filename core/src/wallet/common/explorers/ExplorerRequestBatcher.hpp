@@ -0,0 +1,175 @@
+/*
+ *
+ * ExplorerRequestBatcher
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+#ifndef LEDGER_CORE_EXPLORERREQUESTBATCHER_HPP
+#define LEDGER_CORE_EXPLORERREQUESTBATCHER_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <api/ExecutionContext.hpp>
+#include <async/Future.hpp>
+#include <async/FutureUtils.hpp>
+#include <net/HostConnectionBudget.hpp>
+
+namespace ledger {
+    namespace core {
+        namespace explorers {
+
+            // Room left for the joined addresses in a request path, keeps URLs under the usual 2KB limit
+            static const size_t DEFAULT_MAX_JOINED_ADDRESSES_LENGTH = 1500;
+            // Maximum number of chunks of one batch in flight, the host budget bounds the requests
+            // of all the batches sent to the same explorer
+            static const size_t DEFAULT_MAX_PARALLEL_REQUESTS = 4;
+
+            /*
+             * Split addresses into chunks whose joined representation (with a separator
+             * of the given length) fits into maxLength. An address longer than maxLength
+             * gets a chunk on its own.
+             */
+            inline std::vector<std::vector<std::string>> packAddresses(const std::vector<std::string> &addresses,
+                                                                       size_t maxLength = DEFAULT_MAX_JOINED_ADDRESSES_LENGTH,
+                                                                       size_t separatorLength = 1) {
+                std::vector<std::vector<std::string>> chunks;
+                size_t length = 0;
+                for (const auto &address : addresses) {
+                    auto required = chunks.empty() || chunks.back().empty() ? address.size() : address.size() + separatorLength;
+                    if (chunks.empty() || length + required > maxLength) {
+                        chunks.emplace_back();
+                        length = 0;
+                        required = address.size();
+                    }
+                    chunks.back().push_back(address);
+                    length += required;
+                }
+                return chunks;
+            }
+
+            /*
+             * Merge transactions bulks fetched for disjoint sets of addresses from the same block.
+             * Every fetched transaction is kept: requests of a page share the sync session, which
+             * counts them as delivered and would not send them again. When a chunk is truncated the
+             * next page resumes from the lowest last block among truncated chunks (resumeBlock), the
+             * other chunks only answer it with what the session did not deliver yet. Transactions
+             * are ordered by block height, unconfirmed ones last.
+             */
+            template <typename TransactionsBulk>
+            std::shared_ptr<TransactionsBulk> mergeTransactionsBulks(const std::vector<std::shared_ptr<TransactionsBulk>> &bulks) {
+                if (bulks.size() == 1) {
+                    return bulks.front();
+                }
+                auto result = std::make_shared<TransactionsBulk>();
+                result->hasNext = false;
+                for (const auto &bulk : bulks) {
+                    if (!bulk->hasNext) {
+                        continue;
+                    }
+                    result->hasNext = true;
+                    auto lastConfirmed = std::find_if(bulk->transactions.rbegin(), bulk->transactions.rend(), [] (const auto &tx) {
+                        return tx.block.nonEmpty();
+                    });
+                    if (lastConfirmed != bulk->transactions.rend() &&
+                        (result->resumeBlock.isEmpty() || lastConfirmed->block.getValue().height < result->resumeBlock.getValue().height)) {
+                        result->resumeBlock = lastConfirmed->block;
+                    }
+                }
+                auto heightOf = [] (const auto &tx) -> uint64_t {
+                    return tx.block.nonEmpty() ? tx.block.getValue().height : std::numeric_limits<uint64_t>::max();
+                };
+                for (const auto &bulk : bulks) {
+                    result->transactions.insert(result->transactions.end(), bulk->transactions.begin(), bulk->transactions.end());
+                }
+                std::stable_sort(result->transactions.begin(), result->transactions.end(), [&heightOf] (const auto &lhs, const auto &rhs) {
+                    return heightOf(lhs) < heightOf(rhs);
+                });
+                return result;
+            }
+
+            /*
+             * Keep only the first occurrence of each transaction hash, for bulks merged from
+             * requests whose results overlap (e.g. sender and recipient filters).
+             */
+            template <typename TransactionsBulk>
+            void removeDuplicateTransactions(TransactionsBulk &bulk) {
+                std::unordered_set<std::string> hashes;
+                auto out = bulk.transactions.begin();
+                for (auto it = bulk.transactions.begin(); it != bulk.transactions.end(); ++it) {
+                    if (hashes.insert(it->hash).second) {
+                        if (out != it) {
+                            *out = std::move(*it);
+                        }
+                        ++out;
+                    }
+                }
+                bulk.transactions.erase(out, bulk.transactions.end());
+            }
+
+            /*
+             * Fetch transactions of many addresses by packing them into as few requests as the
+             * path length allows and running these requests with a bounded fan-out. Every request
+             * takes a slot of the host budget, shared with the other accounts using the same host.
+             */
+            template <typename TransactionsBulk>
+            FuturePtr<TransactionsBulk> getBatchedTransactions(const std::shared_ptr<api::ExecutionContext> &context,
+                                                               const std::shared_ptr<HostConnectionBudget> &budget,
+                                                               const std::vector<std::string> &addresses,
+                                                               const std::function<FuturePtr<TransactionsBulk> (const std::vector<std::string> &)> &fetch,
+                                                               size_t maxJoinedLength = DEFAULT_MAX_JOINED_ADDRESSES_LENGTH,
+                                                               size_t maxParallelRequests = DEFAULT_MAX_PARALLEL_REQUESTS) {
+                auto chunks = packAddresses(addresses, maxJoinedLength);
+                if (chunks.size() <= 1) {
+                    return budget->run<std::shared_ptr<TransactionsBulk>>(context, [fetch, addresses] () {
+                        return fetch(addresses);
+                    });
+                }
+                std::vector<std::function<FuturePtr<TransactionsBulk> ()>> tasks;
+                tasks.reserve(chunks.size());
+                for (const auto &chunk : chunks) {
+                    tasks.push_back([context, budget, fetch, chunk] () {
+                        return budget->run<std::shared_ptr<TransactionsBulk>>(context, [fetch, chunk] () {
+                            return fetch(chunk);
+                        });
+                    });
+                }
+                return executeAll(context, tasks, maxParallelRequests)
+                        .template map<std::shared_ptr<TransactionsBulk>>(context, [] (const std::vector<std::shared_ptr<TransactionsBulk>> &bulks) {
+                            return mergeTransactionsBulks(bulks);
+                        });
+            }
+        }
+    }
+}
+
+#endif //LEDGER_CORE_EXPLORERREQUESTBATCHER_HPP
@@ -123,7 +123,8 @@ namespace ledger {
             }
 
             bool Key(const rapidjson::Reader::Ch* str, rapidjson::SizeType length, bool copy) {
-                _lastKey = std::string(str, length);
+                // Reuse the key buffer, keys are short and almost always fit in its capacity
+                _lastKey.assign(str, length);
                 delegate([&] () {
                     _parser.Key(str, length, copy);
                 });
@@ -183,12 +184,21 @@ namespace ledger {
             }
 
         private:
-            bool delegate(std::function<void ()>&& fn) {
+            // Called for every token: avoid wrapping the handler into a std::function and a Try
+            template <typename Fn>
+            bool delegate(Fn&& fn) {
                 if (!isFailure()) {
-                    _exception = Try<Unit>::from([&] () {
+                    try {
                         fn();
-                        return unit;
-                    }).exception();
+                    } catch (const Exception& ex) {
+                        _exception = Option<Exception>(ex);
+#ifdef TARGET_JNI
+                    } catch (const djinni::jni_exception& ex) {
+                        _exception = Option<Exception>(Exception(api::ErrorCode::RUNTIME_ERROR, ex.get_backtrace()));
+#endif
+                    } catch (...) {
+                        _exception = Option<Exception>(Exception(api::ErrorCode::RUNTIME_ERROR, boost::current_exception_diagnostic_information(true)));
+                    }
                 }
                 return continueParsing();
             }
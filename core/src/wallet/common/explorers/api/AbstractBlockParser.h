@@ -38,6 +38,7 @@
 #include <math/BigInt.h>
 #include <net/HttpClient.hpp>
 #include <utils/DateUtils.hpp>
+#include <utils/JSONUtils.h>
 
 namespace ledger {
     namespace core {
@@ -75,9 +76,7 @@ namespace ledger {
 
             bool RawNumber(const rapidjson::Reader::Ch *str, rapidjson::SizeType length, bool copy) {
                 if (getLastKey() == "height") {
-                    std::string number(str, length);
-                    BigInt value = BigInt::fromString(number);
-                    _block->height = value.toUint64();
+                    _block->height = JSONUtils::parseUint64(str, length);
                 }
                 return true;
             }
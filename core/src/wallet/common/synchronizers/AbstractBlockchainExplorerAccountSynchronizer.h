@@ -41,6 +41,7 @@
 #include <async/Future.hpp>
 #include <async/wait.h>
 #include <collections/DynamicObject.hpp>
+#include <database/BulkDatabaseHelper.hpp>
 #include <debug/Benchmarker.h>
 #include <events/ProgressNotifier.h>
 #include <utils/Unit.hpp>
@@ -123,6 +124,7 @@ namespace ledger {
                 Option<BlockchainExplorerAccountSynchronizationSavedState> savedState;
                 Option<void *> token;
                 std::shared_ptr<Account> account;
+                std::string accountUid;
                 std::map<std::string, std::string> transactionsToDrop;
 
                 virtual ~SynchronizationBuddy() {
@@ -178,6 +180,7 @@ namespace ledger {
             Future<Unit> performSynchronization(const std::shared_ptr<Account> &account) {
                 auto buddy = makeSynchronizationBuddy();
                 buddy->account = account;
+                buddy->accountUid = account->getAccountUid();
                 buddy->preferences = std::static_pointer_cast<AbstractAccount>(account)->getInternalPreferences()
                         ->getSubPreferences(
                                 "AbstractBlockchainExplorerAccountSynchronizer");
@@ -248,22 +251,8 @@ namespace ledger {
                     return unit;
                 }).template flatMap<Unit>(account->getContext(), [buddy, self] (const Unit&) {
                     return self->synchronizeBatches(0, buddy);
-                }).template flatMap<Unit>(account->getContext(), [self, buddy, deactivateToken] (const Unit&) {
-                    if (deactivateToken) {
-                        return Future<Unit>::successful(unit);
-                    }
-                    auto tryKillSession = Try<Future<Unit>>::from([=](){
-                        return self->_explorer->killSession(buddy->token.getValue());
-                    });
-                    if (tryKillSession.isFailure()) {
-                        buddy->logger->warn("Failed to delete synchronization token {} for account#{} of wallet {}",
-                                            static_cast<char *>(buddy->token.getValue()), buddy->account->getIndex(),
-                                            buddy->account->getWallet()->getName());
-                        // We return a successful Unit because deleting the sync token should not be a "failure"
-                        // Note: in a near future we'll try to get rid of sync token mechanism
-                        return Future<Unit>::successful(unit);
-                    }
-                    return tryKillSession.getValue();
+                }).template flatMap<Unit>(account->getContext(), [self, buddy] (const Unit&) {
+                    return self->killSyncToken(buddy);
                 }).template flatMap<Unit>(account->getContext(), [self, buddy] (auto) {
                     return self->synchronizeMempool(buddy);
                 }).template map<Unit>(ImmediateExecutionContext::INSTANCE, [self, buddy] (const Unit&) {
@@ -280,10 +269,36 @@ namespace ledger {
                     buddy->logger->error("Error during during synchronization for account#{} of wallet {} in {} ms", buddy->account->getIndex(),
                                          buddy->account->getWallet()->getName(), duration.count());
                     buddy->logger->error("Due to {}, {}", api::to_string(ex.getErrorCode()), ex.getMessage());
-                    return self->recoverFromFailedSynchronization(buddy);
+                    return self->killSyncToken(buddy).template flatMap<Unit>(ImmediateExecutionContext::INSTANCE, [self, buddy] (const Unit&) {
+                        return self->recoverFromFailedSynchronization(buddy);
+                    });
                 });
             };
 
+            // Frees the explorer session held by the buddy, if any. Failing to do so is logged but does not fail
+            // the synchronization. Note: in a near future we'll try to get rid of sync token mechanism
+            Future<Unit> killSyncToken(const std::shared_ptr<SynchronizationBuddy>& buddy) {
+                if (buddy->token.isEmpty()) {
+                    return Future<Unit>::successful(unit);
+                }
+                auto self = getSharedFromThis();
+                auto token = buddy->token.getValue();
+                buddy->token = Option<void *>();
+                auto onFailure = [buddy] (const Exception& ex) {
+                    buddy->logger->warn("Failed to delete synchronization token for account#{} of wallet {}: {}",
+                                        buddy->account->getIndex(), buddy->account->getWallet()->getName(), ex.getMessage());
+                    return unit;
+                };
+                auto tryKillSession = Try<Future<Unit>>::from([=](){
+                    return self->_explorer->killSession(token);
+                });
+                if (tryKillSession.isFailure()) {
+                    return Future<Unit>::successful(onFailure(tryKillSession.getFailure()));
+                }
+                auto killSession = tryKillSession.getValue();
+                return killSession.recover(ImmediateExecutionContext::INSTANCE, onFailure);
+            }
+
             // Synchronize batches.
             //
             // This function will synchronize all batches by iterating over batches and transactions
@@ -329,7 +344,8 @@ namespace ledger {
                         // Try to get a new sync token
                         const auto deactivateToken =
                                 buddy->configuration->getBoolean(api::Configuration::DEACTIVATE_SYNC_TOKEN).value_or(false);
-                        auto startSession = Future<void *>::async(ImmediateExecutionContext::INSTANCE, [=](){
+                        // The session of the failed attempt is released before it is replaced
+                        auto startSession = self->killSyncToken(buddy).template flatMap<void *>(ImmediateExecutionContext::INSTANCE, [=] (const Unit&) {
                             if (deactivateToken) {
                                 return Future<void *>::successful(nullptr);
                             }
@@ -362,14 +378,8 @@ namespace ledger {
                                 {
                                     soci::transaction tr(sql);
                                     try {
-
-                                        soci::rowset<std::string> rows_block =  (sql.prepare << "SELECT uid FROM blocks where height >= :failedBlockHeight",
-                                                                                    soci::use(failedBlockHeight));
-
-                                        std::vector<std::string> blockToDelete(rows_block.begin(), rows_block.end());
-
                                         // Remove failed blocks and associated operations/transactions
-                                        AccountDatabaseHelper::removeBlockOperation(sql, buddy->account->getAccountUid(), blockToDelete);
+                                        AccountDatabaseHelper::eraseBlocksFromHeight(sql, buddy->wallet->getCurrency().name, failedBlockHeight);
 
                                         //Get last block not part from reorg
                                         auto lastBlock = BlockDatabaseHelper::getLastBlock(sql,
@@ -391,7 +401,8 @@ namespace ledger {
                                             }
                                         }
                                         tr.commit();
-                                    } catch(...) {
+                                    } catch(const std::exception& ex) {
+                                        buddy->logger->error("Failed to erase blocks above {}: {}", failedBlockHeight, ex.what());
                                         tr.rollback();
                                     }
                                 }
@@ -466,42 +477,70 @@ namespace ledger {
                         auto& batchState = buddy->savedState.getValue().batches[currentBatchIndex];
                         soci::session sql(buddy->wallet->getDatabase()->getPool());
                         buddy->logger->info("Got {} txs for account {}", bulk->transactions.size(), buddy->account->getAccountUid());
-                        auto count = 0;
-                        for (const auto& tx : bulk->transactions) {
-                            soci::transaction tr(sql);
-                            // A lot of things could happen here, better to wrap it
-                            auto tryPutTx = Try<int>::from([&buddy, &tx, &sql, &self] () {
-                                auto flag = self->putTransaction(sql, tx, buddy);
-                                //Update first pendingTxHash in savedState
-                                auto it = buddy->transactionsToDrop.find(tx.hash);
-                                if (it != buddy->transactionsToDrop.end()) {
-                                    //If block non empty, tx is no longer pending
-                                    if (tx.block.nonEmpty()) {
-                                        buddy->savedState.getValue().pendingTxsHash.erase(it->first);
-                                    } else { //Otherwise tx is in mempool but pending
-                                        buddy->savedState.getValue().pendingTxsHash.insert(std::pair<std::string, std::string>(it->first, it->second));
+                        // The page and what was buffered while inserting it are written in a single
+                        // ingestion transaction, each transaction behind a savepoint so that a faulty one
+                        // is skipped without aborting the page. A retried attempt replays the whole page, what
+                        // writing changes outside of the database (events, sub-accounts, used addresses) is staged
+                        // and only applied once the page is committed.
+                        std::vector<const Transaction*> stored;
+                        try {
+                            BulkDatabaseHelper::ingest(sql, [&] () {
+                                stored.clear();
+                                self->resetTransactionsBulk(buddy);
+                                buddy->account->stageChanges();
+                                for (const auto& tx : bulk->transactions) {
+                                    auto staged = buddy->account->markStagedChanges();
+                                    sql << "SAVEPOINT put_transaction";
+                                    try {
+                                        self->putTransaction(sql, tx, buddy);
+                                        sql << "RELEASE SAVEPOINT put_transaction";
+                                        stored.push_back(&tx);
+                                    } catch (const soci::soci_error& ex) {
+                                        if (BulkDatabaseHelper::isRetryable(ex)) {
+                                            throw;
+                                        }
+                                        sql << "ROLLBACK TO SAVEPOINT put_transaction";
+                                        sql << "RELEASE SAVEPOINT put_transaction";
+                                        buddy->account->dropStagedChanges(staged);
+                                        logPutTransactionFailure(buddy, tx, ex.what());
+                                    } catch (const std::exception& ex) {
+                                        sql << "ROLLBACK TO SAVEPOINT put_transaction";
+                                        sql << "RELEASE SAVEPOINT put_transaction";
+                                        buddy->account->dropStagedChanges(staged);
+                                        logPutTransactionFailure(buddy, tx, ex.what());
                                     }
                                 }
-                                //Remove from tx to drop
-                                buddy->transactionsToDrop.erase(tx.hash);
-                                return flag;
+                                // Write what was buffered while inserting the page
+                                self->flushTransactionsBulk(sql, buddy);
                             });
+                            buddy->account->commitStagedChanges();
+                        } catch (const std::exception& ex) {
+                            buddy->account->discardStagedChanges();
+                            buddy->logger->error("Failed to insert page of {} txs for account {}, reason: {}, rollback ...", bulk->transactions.size(), buddy->accountUid, ex.what());
+                            throw;
+                        }
 
-                            if (tryPutTx.isFailure()) {
-                                tr.rollback();
-                                auto blockHash = tx.block.hasValue() ? tx.block.getValue().hash : "None";
-                                buddy->logger->error("Failed to put transaction {}, on block {}, for account {}, reason: {}, rollback ...", tx.hash, blockHash, buddy->account->getAccountUid(), tryPutTx.getFailure().getMessage());
-                            } else {
-                                count++;
-                                tr.commit();
+                        for (auto tx : stored) {
+                            //Update first pendingTxHash in savedState
+                            auto it = buddy->transactionsToDrop.find(tx->hash);
+                            if (it != buddy->transactionsToDrop.end()) {
+                                //If block non empty, tx is no longer pending
+                                if (tx->block.nonEmpty()) {
+                                    buddy->savedState.getValue().pendingTxsHash.erase(it->first);
+                                } else { //Otherwise tx is in mempool but pending
+                                    buddy->savedState.getValue().pendingTxsHash.insert(std::pair<std::string, std::string>(it->first, it->second));
+                                }
                             }
+                            //Remove from tx to drop
+                            buddy->transactionsToDrop.erase(tx->hash);
                         }
+                        auto count = stored.size();
                         buddy->logger->info("Succeeded to insert {} txs on {} for account {}", count, bulk->transactions.size(), buddy->account->getAccountUid());
                         buddy->account->emitEventsNow();
 
                         // Get the last block
                         if (bulk->transactions.size() > 0) {
-                            auto &lastBlock = bulk->transactions.back().block;
+                            auto &lastBlock = bulk->resumeBlock.nonEmpty() ? bulk->resumeBlock : bulk->transactions.back().block;
 
                             if (lastBlock.nonEmpty()) {
                                 batchState.blockHeight = (uint32_t) lastBlock.getValue().height;
@@ -522,21 +561,24 @@ namespace ledger {
 
             virtual Future<Unit> synchronizeMempool(const std::shared_ptr<SynchronizationBuddy>& buddy) {
                 //Delete dropped txs from DB
-                soci::session sql(buddy->wallet->getDatabase()->getPool());
+                std::vector<std::string> operationsToDrop;
                 for (auto& tx : buddy->transactionsToDrop) {
                     //Check if tx is pending
                     auto it = buddy->savedState.getValue().pendingTxsHash.find(tx.first);
                     if (it == buddy->savedState.getValue().pendingTxsHash.end()) {
-                        soci::transaction tr(sql);
                         buddy->logger->info("Drop transaction {}", tx.first);
                         buddy->logger->info("Deleting operation from DB {}", tx.second);
-                        try {
-                            sql << "DELETE FROM operations WHERE uid = :uid", soci::use(tx.second);
-                            tr.commit();
-                        } catch(std::exception& ex) {
-                            buddy->logger->info("Failed to delete operation from DB {} reason: {}, rollback ...", tx.second, ex.what());
-                            tr.rollback();
-                        }
+                        operationsToDrop.push_back(tx.second);
+                    }
+                }
+                if (!operationsToDrop.empty()) {
+                    soci::session sql(buddy->wallet->getDatabase()->getPool());
+                    try {
+                        BulkDatabaseHelper::ingest(sql, [&] () {
+                            AccountDatabaseHelper::eraseOperations(sql, buddy->accountUid, operationsToDrop);
+                        });
+                    } catch(std::exception& ex) {
+                        buddy->logger->info("Failed to delete {} operations from DB reason: {}, rollback ...", operationsToDrop.size(), ex.what());
                     }
                 }
                 return Future<Unit>::successful(unit);
@@ -548,6 +590,21 @@ namespace ledger {
 
             virtual int putTransaction(soci::session& sql, const Transaction& transaction, const std::shared_ptr<SynchronizationBuddy>& buddy) = 0;
 
+            // Called once all the transactions of an explorer page went through putTransaction, lets a
+            // synchronizer buffer writes across the page.
+            virtual void flushTransactionsBulk(soci::session& sql, const std::shared_ptr<SynchronizationBuddy>& buddy) {}
+
+            // Called at the start of every attempt to write an explorer page, drops what a rolled back
+            // attempt buffered.
+            virtual void resetTransactionsBulk(const std::shared_ptr<SynchronizationBuddy>& buddy) {}
+
+            static void logPutTransactionFailure(const std::shared_ptr<SynchronizationBuddy>& buddy,
+                                                 const Transaction& tx,
+                                                 const std::string& reason) {
+                auto blockHash = tx.block.hasValue() ? tx.block.getValue().hash : "None";
+                buddy->logger->error("Failed to put transaction {}, on block {}, for account {}, reason: {}, rollback ...", tx.hash, blockHash, buddy->accountUid, reason);
+            }
+
             virtual void updateCurrentBlock(std::shared_ptr<SynchronizationBuddy> &buddy,
                                             const std::shared_ptr<api::ExecutionContext> &context) = 0;
             virtual void updateTransactionsToDrop(soci::session &sql,
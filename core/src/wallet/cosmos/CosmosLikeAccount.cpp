@@ -70,11 +70,13 @@ CosmosLikeAccount::CosmosLikeAccount(
     const std::shared_ptr<AbstractWallet> &wallet,
     int32_t index,
     const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+    const std::shared_ptr<CosmosLikeValidatorCache> &validators,
     const std::shared_ptr<CosmosLikeBlockchainObserver> &observer,
     const std::shared_ptr<CosmosLikeAccountSynchronizer> &synchronizer,
     const std::shared_ptr<CosmosLikeKeychain> &keychain) :
     AbstractAccount(wallet, index),
     _explorer(explorer),
+    _validators(validators),
     _observer(observer),
     _synchronizer(synchronizer),
     _keychain(keychain),
@@ -415,6 +417,7 @@ int CosmosLikeAccount::putTransaction(soci::session &sql, const cosmos::Transact
 bool CosmosLikeAccount::putBlock(soci::session &sql, const api::Block &block)
 {
     if (BlockDatabaseHelper::putBlock(sql, block)) {
+        _validators->onNewBlock();
         emitNewBlockEvent(block);
         return true;
     }
@@ -868,7 +871,7 @@ void CosmosLikeAccount::getSpendableBalance(const std::shared_ptr<api::AmountCal
 
 Future<cosmos::ValidatorList> CosmosLikeAccount::getActiveValidatorSet() const
 {
-    return _explorer->getActiveValidatorSet();
+    return _validators->getActiveValidatorSet();
 }
 void CosmosLikeAccount::getLatestValidatorSet(
     const std::shared_ptr<api::CosmosLikeValidatorListCallback> &callback)
@@ -879,7 +882,7 @@ void CosmosLikeAccount::getLatestValidatorSet(
 Future<cosmos::Validator> CosmosLikeAccount::getValidatorInfo(
     const std::string &validatorAddress) const
 {
-    return _explorer->getValidatorInfo(validatorAddress);
+    return _validators->getValidatorInfo(validatorAddress);
 }
 
 void CosmosLikeAccount::getValidatorInfo(
@@ -55,6 +55,7 @@
 #include <wallet/cosmos/api_impl/CosmosLikeRedelegation.hpp>
 #include <wallet/cosmos/api_impl/CosmosLikeReward.hpp>
 #include <wallet/cosmos/api_impl/CosmosLikeUnbonding.hpp>
+#include <wallet/cosmos/CosmosLikeValidatorCache.hpp>
 #include <wallet/cosmos/explorers/CosmosLikeBlockchainExplorer.hpp>
 #include <wallet/cosmos/keychains/CosmosLikeKeychain.hpp>
 #include <wallet/cosmos/observers/CosmosLikeBlockchainObserver.hpp>
@@ -71,6 +72,7 @@ class CosmosLikeAccount : public api::CosmosLikeAccount, public AbstractAccount
         const std::shared_ptr<AbstractWallet> &wallet,
         int32_t index,
         const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+        const std::shared_ptr<CosmosLikeValidatorCache> &validators,
         const std::shared_ptr<CosmosLikeBlockchainObserver> &observer,
         const std::shared_ptr<CosmosLikeAccountSynchronizer> &synchronizer,
         const std::shared_ptr<CosmosLikeKeychain> &keychain);
@@ -186,12 +188,12 @@ class CosmosLikeAccount : public api::CosmosLikeAccount, public AbstractAccount
     FuturePtr<Amount> getSpendableBalance() const;
     void getSpendableBalance(const std::shared_ptr<api::AmountCallback> &callback) override;
 
-    /// Ask the explorer for the currently active validator set on the chain.
+    /// Get the currently active validator set on the chain, from the pool-wide validator cache.
     /// \return A Future with the list of validators
     Future<cosmos::ValidatorList> getActiveValidatorSet() const;
     void getLatestValidatorSet(
         const std::shared_ptr<api::CosmosLikeValidatorListCallback> &callback) override;
-    /// Ask the explorer for specific informations about a validator. SigningInfo and
+    /// Get specific informations about a validator from the pool-wide validator cache. SigningInfo and
     /// DistributionInfo are included there. \param [in] validatorAddress The 'cosmosvaloper'
     /// address of the queried validator. \return A Future with the complete information about a
     /// validator
@@ -306,6 +308,7 @@ class CosmosLikeAccount : public api::CosmosLikeAccount, public AbstractAccount
     std::shared_ptr<cosmos::Account> _accountData;
     std::shared_ptr<CosmosLikeKeychain> _keychain;
     std::shared_ptr<CosmosLikeBlockchainExplorer> _explorer;
+    std::shared_ptr<CosmosLikeValidatorCache> _validators;
     std::shared_ptr<CosmosLikeAccountSynchronizer> _synchronizer;
     std::shared_ptr<CosmosLikeBlockchainObserver> _observer;
     uint64_t _currentBlockHeight;
@@ -29,6 +29,8 @@
  */
 
 #pragma once
+#include <chrono>
+
 #include <api/CosmosLikeVoteOption.hpp>
 #include <wallet/cosmos/cosmos.hpp>
 
@@ -54,6 +56,17 @@ constexpr char kGaiaUnbondingsEndpoint[] = "/staking/delegators/{}/unbonding_del
 constexpr char kGaiaValidatorInfoEndpoint[] = "/staking/validators/{}";
 constexpr char kGaiaWithdrawAddressEndpoint[] = "/distribution/delegators/{}/withdraw_address";
 
+// Gaia caps the transactions search at 100 transactions per page
+constexpr int kGaiaMaxTransactionsPerPage = 100;
+// Pages of a search fetched for one synchronization batch, the synchronizer resumes from the
+// height of the last transaction when there are more
+constexpr int kGaiaMaxTransactionsPagesPerBulk = 10;
+// Lifetime of a cached balance snapshot, long enough to serve every figure of a
+// staking screen with one set of requests
+constexpr std::chrono::seconds kGaiaBalanceSnapshotTTL{10};
+// Age after which the cached validators are refreshed in the background
+constexpr std::chrono::seconds kValidatorsRefreshInterval{60};
+
 // use raw char array here to be compliant with rapidjson
 constexpr char kMsgBeginRedelegate[] = "cosmos-sdk/MsgBeginRedelegate";
 constexpr char kMsgDelegate[] = "cosmos-sdk/MsgDelegate";
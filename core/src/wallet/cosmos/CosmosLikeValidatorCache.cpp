@@ -0,0 +1,143 @@
+/*
+ *
+ * CosmosLikeValidatorCache
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <wallet/cosmos/CosmosLikeValidatorCache.hpp>
+
+namespace ledger {
+namespace core {
+
+CosmosLikeValidatorCache::CosmosLikeValidatorCache(
+    const std::shared_ptr<api::ExecutionContext> &context,
+    const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+    std::chrono::milliseconds refreshInterval) :
+    DedicatedContext(context),
+    _explorer(explorer),
+    _refreshInterval(refreshInterval)
+{
+}
+
+Future<cosmos::ValidatorList> CosmosLikeValidatorCache::getActiveValidatorSet()
+{
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+    if (_validatorSet.isEmpty()) {
+        return refreshValidatorSet();
+    }
+    if (isStale(_validatorSetLoadedAt)) {
+        refreshValidatorSet();
+    }
+    return Future<cosmos::ValidatorList>::successful(_validatorSet.getValue());
+}
+
+Future<cosmos::Validator> CosmosLikeValidatorCache::getValidatorInfo(
+    const std::string &operatorAddress)
+{
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+    auto entry = _validatorInfos.find(operatorAddress);
+    if (entry == _validatorInfos.end()) {
+        return refreshValidatorInfo(operatorAddress);
+    }
+    if (isStale(entry->second.loadedAt)) {
+        refreshValidatorInfo(operatorAddress);
+    }
+    return Future<cosmos::Validator>::successful(entry->second.validator);
+}
+
+void CosmosLikeValidatorCache::onNewBlock()
+{
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+    if (!_validatorSet.isEmpty() && isStale(_validatorSetLoadedAt)) {
+        refreshValidatorSet();
+    }
+    std::vector<std::string> staleValidators;
+    for (const auto &entry : _validatorInfos) {
+        if (isStale(entry.second.loadedAt)) {
+            staleValidators.push_back(entry.first);
+        }
+    }
+    for (const auto &operatorAddress : staleValidators) {
+        refreshValidatorInfo(operatorAddress);
+    }
+}
+
+std::shared_ptr<CosmosLikeBlockchainExplorer> CosmosLikeValidatorCache::getExplorer() const
+{
+    return _explorer;
+}
+
+bool CosmosLikeValidatorCache::isStale(const std::chrono::steady_clock::time_point &loadedAt) const
+{
+    return std::chrono::steady_clock::now() - loadedAt >= _refreshInterval;
+}
+
+Future<cosmos::ValidatorList> CosmosLikeValidatorCache::refreshValidatorSet()
+{
+    if (_pendingValidatorSet.nonEmpty()) {
+        return _pendingValidatorSet.getValue();
+    }
+    auto self = shared_from_this();
+    auto request = _explorer->getActiveValidatorSet();
+    _pendingValidatorSet = request;
+    request.onComplete(getContext(), [self](const Try<cosmos::ValidatorList> &result) {
+        std::lock_guard<std::recursive_mutex> lock(self->_lock);
+        self->_pendingValidatorSet = Option<Future<cosmos::ValidatorList>>();
+        if (result.isSuccess()) {
+            self->_validatorSet = result.getValue();
+            self->_validatorSetLoadedAt = std::chrono::steady_clock::now();
+        }
+    });
+    return request;
+}
+
+Future<cosmos::Validator> CosmosLikeValidatorCache::refreshValidatorInfo(
+    const std::string &operatorAddress)
+{
+    auto pending = _pendingValidatorInfos.find(operatorAddress);
+    if (pending != _pendingValidatorInfos.end()) {
+        return pending->second;
+    }
+    auto self = shared_from_this();
+    auto request = _explorer->getValidatorInfo(operatorAddress);
+    _pendingValidatorInfos.emplace(operatorAddress, request);
+    request.onComplete(
+        getContext(), [self, operatorAddress](const Try<cosmos::Validator> &result) {
+            std::lock_guard<std::recursive_mutex> lock(self->_lock);
+            self->_pendingValidatorInfos.erase(operatorAddress);
+            if (result.isSuccess()) {
+                auto &entry = self->_validatorInfos[operatorAddress];
+                entry.validator = result.getValue();
+                entry.loadedAt = std::chrono::steady_clock::now();
+            }
+        });
+    return request;
+}
+
+}  // namespace core
+}  // namespace ledger
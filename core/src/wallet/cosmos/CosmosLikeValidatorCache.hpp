@@ -0,0 +1,101 @@
+/*
+ *
+ * CosmosLikeValidatorCache
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <async/DedicatedContext.hpp>
+#include <async/Future.hpp>
+#include <utils/Option.hpp>
+#include <wallet/cosmos/cosmos.hpp>
+#include <wallet/cosmos/explorers/CosmosLikeBlockchainExplorer.hpp>
+
+namespace ledger {
+namespace core {
+
+/// Validators of a Cosmos chain, shared by every account of a currency in a pool whose
+/// wallets use the same explorer (a cache is bound to the explorer it is built with).
+/// Data is loaded once, then served from memory. Entries older than the refresh
+/// interval are still served while a single background request refreshes them.
+class CosmosLikeValidatorCache :
+    public DedicatedContext,
+    public std::enable_shared_from_this<CosmosLikeValidatorCache> {
+   public:
+    CosmosLikeValidatorCache(
+        const std::shared_ptr<api::ExecutionContext> &context,
+        const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+        std::chrono::milliseconds refreshInterval);
+
+    /// Get the active validator set.
+    Future<cosmos::ValidatorList> getActiveValidatorSet();
+
+    /// Get the full information (distribution and signing info included) of a validator,
+    /// indexed by operator address.
+    Future<cosmos::Validator> getValidatorInfo(const std::string &operatorAddress);
+
+    /// Notify a new block, stale data is refreshed in the background.
+    void onNewBlock();
+
+    /// The explorer validators are loaded from.
+    std::shared_ptr<CosmosLikeBlockchainExplorer> getExplorer() const;
+
+   private:
+    struct ValidatorInfoEntry {
+        cosmos::Validator validator;
+        std::chrono::steady_clock::time_point loadedAt;
+    };
+
+    bool isStale(const std::chrono::steady_clock::time_point &loadedAt) const;
+
+    // Both must be called with _lock held
+    Future<cosmos::ValidatorList> refreshValidatorSet();
+    Future<cosmos::Validator> refreshValidatorInfo(const std::string &operatorAddress);
+
+    std::shared_ptr<CosmosLikeBlockchainExplorer> _explorer;
+    std::chrono::milliseconds _refreshInterval;
+
+    // Recursive as completion callbacks may run synchronously on immediate contexts
+    std::recursive_mutex _lock;
+    Option<cosmos::ValidatorList> _validatorSet;
+    std::chrono::steady_clock::time_point _validatorSetLoadedAt;
+    Option<Future<cosmos::ValidatorList>> _pendingValidatorSet;
+    std::unordered_map<std::string, ValidatorInfoEntry> _validatorInfos;
+    std::unordered_map<std::string, Future<cosmos::Validator>> _pendingValidatorInfos;
+};
+
+}  // namespace core
+}  // namespace ledger
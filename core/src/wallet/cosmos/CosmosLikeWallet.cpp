@@ -49,6 +49,7 @@ const api::WalletType CosmosLikeWallet::type = api::WalletType::COSMOS;
 CosmosLikeWallet::CosmosLikeWallet(
     const std::string &name,
     const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+    const std::shared_ptr<CosmosLikeValidatorCache> &validators,
     const std::shared_ptr<CosmosLikeBlockchainObserver> &observer,
     const std::shared_ptr<CosmosLikeKeychainFactory> &keychainFactory,
     const CosmosLikeAccountSynchronizerFactory &synchronizer,
@@ -58,6 +59,7 @@ CosmosLikeWallet::CosmosLikeWallet(
     const DerivationScheme &scheme) :
     AbstractWallet(name, network, pool, configuration, scheme),
     _explorer(explorer),
+    _validators(validators),
     _observer(observer),
     _keychainFactory(keychainFactory),
     _synchronizerFactory(synchronizer)
@@ -162,7 +164,13 @@ std::shared_ptr<AbstractAccount> CosmosLikeWallet::createAccountInstance(
     auto keychain = _keychainFactory->restore(
         path, getConfig(), entry.pubkey, getAccountInternalPreferences(entry.index), getCurrency());
     auto account = std::make_shared<CosmosLikeAccount>(
-        shared_from_this(), entry.index, _explorer, _observer, _synchronizerFactory(), keychain);
+        shared_from_this(),
+        entry.index,
+        _explorer,
+        _validators,
+        _observer,
+        _synchronizerFactory(),
+        keychain);
     return account;
 }
 
@@ -32,6 +32,7 @@
 #define LEDGER_CORE_COSMOSLIKEWALLET_H
 #include <api/CosmosLikeWallet.hpp>
 #include <wallet/common/AbstractWallet.hpp>
+#include <wallet/cosmos/CosmosLikeValidatorCache.hpp>
 #include <wallet/cosmos/explorers/CosmosLikeBlockchainExplorer.hpp>
 #include <wallet/cosmos/factories/CosmosLikeKeychainFactory.hpp>
 #include <wallet/cosmos/factories/CosmosLikeWalletFactory.hpp>
@@ -46,6 +47,7 @@ class CosmosLikeWallet : public virtual api::CosmosLikeWallet, public virtual Ab
     CosmosLikeWallet(
         const std::string &name,
         const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer,
+        const std::shared_ptr<CosmosLikeValidatorCache> &validators,
         const std::shared_ptr<CosmosLikeBlockchainObserver> &observer,
         const std::shared_ptr<CosmosLikeKeychainFactory> &keychainFactory,
         const CosmosLikeAccountSynchronizerFactory &synchronizerFactory,
@@ -82,6 +84,7 @@ class CosmosLikeWallet : public virtual api::CosmosLikeWallet, public virtual Ab
     std::shared_ptr<CosmosLikeWallet> getSelf();
 
     std::shared_ptr<CosmosLikeBlockchainExplorer> _explorer;
+    std::shared_ptr<CosmosLikeValidatorCache> _validators;
     std::shared_ptr<CosmosLikeBlockchainObserver> _observer;
     std::shared_ptr<CosmosLikeKeychainFactory> _keychainFactory;
     CosmosLikeAccountSynchronizerFactory _synchronizerFactory;
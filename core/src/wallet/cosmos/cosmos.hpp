@@ -230,6 +230,21 @@ using MsgType = ::ledger::core::api::CosmosLikeMsgType;
 struct TransactionsBulk {
     std::vector<cosmos::Transaction> transactions;
     bool hasNext;
+    // Block the next page starts from when it is not the block of the last transaction,
+    // set when the bulks of several requests are merged
+    Option<Block> resumeBlock;
+};
+
+// Every balance figure of an account, derived from a single fetch of each
+// underlying explorer resource
+struct BalanceSnapshot {
+    BigInt spendable;
+    BigInt delegated;
+    BigInt unbonding;
+    BigInt pendingRewards;
+
+    BigInt totalWithoutPendingRewards() const { return spendable + delegated + unbonding; }
+    BigInt total() const { return totalWithoutPendingRewards() + pendingRewards; }
 };
 }  // namespace cosmos
 }  // namespace core
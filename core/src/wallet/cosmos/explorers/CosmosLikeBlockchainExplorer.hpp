@@ -85,6 +85,9 @@ class CosmosLikeBlockchainExplorer : public ConfigurationMatchable {
         const std::string &delegatorAddress) const = 0;
 
     // Balances
+    /// Get every balance figure of the account at once, each explorer resource is fetched once
+    virtual FuturePtr<cosmos::BalanceSnapshot> getBalanceSnapshot(
+        const std::string &account) const = 0;
     /// Get Total Balance
     virtual FuturePtr<BigInt> getTotalBalance(const std::string &account) const = 0;
     /// Get Total Balance except pending rewards
@@ -34,6 +34,7 @@
 
 #include <api/Configuration.hpp>
 #include <async/algorithm.h>
+#include <async/FutureUtils.hpp>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -44,6 +45,7 @@
 #include <wallet/cosmos/api_impl/CosmosLikeTransactionApi.hpp>
 #include <wallet/cosmos/explorers/GaiaCosmosLikeBlockchainExplorer.hpp>
 #include <wallet/cosmos/explorers/RpcsParsers.hpp>
+#include <wallet/common/explorers/ExplorerRequestBatcher.hpp>
 
 namespace ledger {
 namespace core {
@@ -88,7 +90,9 @@ GaiaCosmosLikeBlockchainExplorer::GaiaCosmosLikeBlockchainExplorer(
     CosmosLikeBlockchainExplorer(
         configuration, {api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT}),
     _http(http),
-    _parameters(parameters)
+    _parameters(parameters),
+    _balanceSnapshotTTL(configuration->getInt(api::Configuration::TTL_CACHE)
+                            .value_or(cosmos::constants::kGaiaBalanceSnapshotTTL.count()))
 {
 }
 
@@ -156,6 +160,7 @@ FuturePtr<ledger::core::cosmos::Account> GaiaCosmosLikeBlockchainExplorer::getAc
 FuturePtr<cosmos::Block> GaiaCosmosLikeBlockchainExplorer::getCurrentBlock()
 {
     return _http->GET(fmt::format(kGaiaLatestBlockEndpoint), ACCEPT_HEADER)
+        .cacheable()
         .json(true)
         .map<std::shared_ptr<cosmos::Block>>(
             getContext(), [](const HttpRequest::JsonResult &response) {
@@ -225,15 +230,24 @@ void GaiaCosmosLikeBlockchainExplorer::parseTransactionWithPosttreatment(
 
 FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getTransactions(
     const CosmosLikeBlockchainExplorer::TransactionFilter &filter, int page, int limit) const
+{
+    return getTransactionsPage(filter, page, limit)
+        .map<std::shared_ptr<cosmos::TransactionsBulk>>(
+            getContext(), [](const TransactionsPage &result) { return result.bulk; });
+}
+
+Future<GaiaCosmosLikeBlockchainExplorer::TransactionsPage>
+GaiaCosmosLikeBlockchainExplorer::getTransactionsPage(
+    const CosmosLikeBlockchainExplorer::TransactionFilter &filter, int page, int limit) const
 {
     // NOTE : the amount of memory involved here asks for a second pass to make
     // sure that the least amount of copies is done.
     return _http->GET(fmt::format(kGaiaTransactionsWithPageLimitEnpoint, filter, page, limit), ACCEPT_HEADER)
         .json(true)
-        .flatMap<cosmos::TransactionsBulk>(
+        .flatMap<TransactionsPage>(
             getContext(), [this](const HttpRequest::JsonResult &response)
-            -> Future<cosmos::TransactionsBulk> {
-                cosmos::TransactionsBulk result;
+            -> Future<TransactionsPage> {
+                TransactionsPage result{std::make_shared<cosmos::TransactionsBulk>(), 0};
                 const auto &document = std::get<1>(response)->GetObject();
                 if (!document.HasMember("txs") || !document[kTxArray].IsArray()) {
                     throw make_exception(
@@ -245,28 +259,28 @@ FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getTransac
                 for (const auto &node : transactions) {
                     auto tx = cosmos::Transaction();
                     parseTransactionWithPosttreatment(node, tx);
-                    result.transactions.emplace_back(tx);
+                    result.bulk->transactions.emplace_back(tx);
                 }
 
                 if (!document.HasMember(kCount) ||
                     !document[kCount].IsString() ||
                     !document.HasMember(kTotalCount) ||
                     !document[kTotalCount].IsString()) {
-                    result.hasNext = false;
+                    result.bulk->hasNext = false;
+                    result.totalCount = static_cast<int>(result.bulk->transactions.size());
                 }
                 else {
                     const auto count = std::stoi(document[cosmos::constants::kCount].GetString());
-                    const auto total_count =
-                        std::stoi(document[kTotalCount].GetString());
-                    result.hasNext = (count < total_count);
+                    result.totalCount = std::stoi(document[kTotalCount].GetString());
+                    result.bulk->hasNext = (count < result.totalCount);
                 }
-                return Future<cosmos::TransactionsBulk>::successful(result);
+                return Future<TransactionsPage>::successful(result);
             })
-        .flatMapPtr<cosmos::TransactionsBulk>(
+        .flatMap<TransactionsPage>(
             getContext(),
-            [this](const cosmos::TransactionsBulk &inputBulk) mutable
-            -> FuturePtr<cosmos::TransactionsBulk> {
-                auto const &inputTxs = inputBulk.transactions;
+            [this](const TransactionsPage &inputPage) mutable
+            -> Future<TransactionsPage> {
+                auto const &inputTxs = inputPage.bulk->transactions;
                 std::vector<FuturePtr<cosmos::Transaction>> filledTxsFutures;
                 filledTxsFutures.reserve(inputTxs.size());
                 std::transform(
@@ -277,20 +291,65 @@ FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getTransac
                         return this->inflateTransactionWithBlockData(inputTx);
                     });
                 return async::sequence(getContext(), filledTxsFutures)
-                    .flatMapPtr<cosmos::TransactionsBulk>(
+                    .map<TransactionsPage>(
                         getContext(),
-                        [inputBulk = std::move(inputBulk)](
+                        [inputPage](
                             const std::vector<std::shared_ptr<cosmos::Transaction>>
-                                &filledTxsList) mutable {
+                                &filledTxsList) {
                             std::transform(
                                 filledTxsList.cbegin(),
                                 filledTxsList.cend(),
-                                inputBulk.transactions.begin(),
+                                inputPage.bulk->transactions.begin(),
                                 [](const std::shared_ptr<cosmos::Transaction> filledTx) {
                                     return *filledTx;
                                 });
-                            return FuturePtr<cosmos::TransactionsBulk>::successful(
-                                std::make_shared<cosmos::TransactionsBulk>(inputBulk));
+                            return inputPage;
+                        });
+            });
+}
+
+FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getAllTransactions(
+    const CosmosLikeBlockchainExplorer::TransactionFilter &filter) const
+{
+    const auto limit = cosmos::constants::kGaiaMaxTransactionsPerPage;
+    return getTransactionsPage(filter, 1, limit)
+        .flatMapPtr<cosmos::TransactionsBulk>(
+            getContext(),
+            [this, filter, limit](const TransactionsPage &firstPage)
+            -> FuturePtr<cosmos::TransactionsBulk> {
+                const auto pageCount = (firstPage.totalCount + limit - 1) / limit;
+                const auto lastPage =
+                    std::min(pageCount, cosmos::constants::kGaiaMaxTransactionsPagesPerBulk);
+                if (lastPage <= 1) {
+                    return FuturePtr<cosmos::TransactionsBulk>::successful(firstPage.bulk);
+                }
+                // Pages are the leaf requests: they share the host budget with the other accounts
+                auto budget = HostConnectionBudget::forUrl(_http->getBaseUrl());
+                std::vector<std::function<FuturePtr<cosmos::TransactionsBulk>()>> pages;
+                for (auto page = 2; page <= lastPage; page++) {
+                    pages.push_back([this, budget, filter, page, limit]() {
+                        return budget->run<std::shared_ptr<cosmos::TransactionsBulk>>(
+                            getContext(), [this, filter, page, limit]() {
+                                return this->getTransactions(filter, page, limit);
+                            });
+                    });
+                }
+                const auto hasNext = pageCount > lastPage;
+                return executeAll(getContext(), pages, explorers::DEFAULT_MAX_PARALLEL_REQUESTS)
+                    .map<std::shared_ptr<cosmos::TransactionsBulk>>(
+                        getContext(),
+                        [firstPage, hasNext](
+                            const std::vector<std::shared_ptr<cosmos::TransactionsBulk>> &bulks) {
+                            // Pages come back in request order, which is the height order
+                            auto result = firstPage.bulk;
+                            for (const auto &bulk : bulks) {
+                                result->transactions.insert(
+                                    result->transactions.end(),
+                                    bulk->transactions.begin(),
+                                    bulk->transactions.end());
+                            }
+                            result->hasNext = hasNext;
+                            return result;
                         });
             });
 }
@@ -334,36 +393,17 @@ FuturePtr<cosmos::Transaction> GaiaCosmosLikeBlockchainExplorer::getTransactionB
 
 namespace {
 
-std::shared_ptr<cosmos::TransactionsBulk> concatenateBulks(
+std::shared_ptr<cosmos::TransactionsBulk> mergeBulks(
     const std::vector<std::shared_ptr<cosmos::TransactionsBulk>> &bulks)
 {
-    /// This has to be done because of the way the synchronizer synchronizes batches.
-    /// After receiving a batch, if hasNext is set to true in the fetched bulk, it
-    /// recursively asks for another batch, starting from the height of the last
-    /// element contained in the bulk.
-    /// This swap makes sure that, by putting at the end of the vector the bulk
-    /// with hasNext set to true whose last element has the lowest block height,
-    /// using the last transaction's block height in the concatenated bulk to
-    /// synchronize the next batch will not skip any blocks.
-    auto &cp = const_cast<std::vector<std::shared_ptr<cosmos::TransactionsBulk>> &>(bulks);
-    auto last = std::begin(cp);
-    for (auto it = std::begin(cp); it != std::end(cp); ++it) {
-        if ((*it)->hasNext) {
-            if (!(*last)->hasNext || ((*it)->transactions.back().block->height <
-                                      (*last)->transactions.back().block->height)) {
-                last = it;
-            }
-        }
-    }
-    std::iter_swap(--std::end(cp), last);
-
-    auto result = std::make_shared<cosmos::TransactionsBulk>();
-    for (const auto &bulk : bulks) {
-        // Forced to copy because of flatMap API
-        result->transactions.insert(
-            result->transactions.end(), bulk->transactions.begin(), bulk->transactions.end());
-        result->hasNext |= bulk->hasNext;
+    /// The synchronizer resumes from the resume block of a merged bulk when hasNext is set:
+    /// the lowest last height of the truncated bulks, so that no block is skipped.
+    /// Transactions matching several filters (e.g. sent to self) are only kept once.
+    if (bulks.size() == 1) {
+        return bulks.front();
     }
+    auto result = explorers::mergeTransactionsBulks(bulks);
+    explorers::removeDuplicateTransactions(*result);
     return result;
 }
 
@@ -372,46 +412,41 @@ std::shared_ptr<cosmos::TransactionsBulk> concatenateBulks(
 FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getTransactionsForAddress(
     const std::string &address, uint32_t fromBlockHeight) const
 {
-    // Gaia explorer currently caps at 100 on tx per page.
-    const auto explorerTxBatchSize = 100;
     auto blockHeightFilter = filterWithAttribute(kTx, kMinHeight, std::to_string(fromBlockHeight));
 
     // NOTE: MsgUn/Re/Delegate + MsgWithdrawDelegatorReward are all covered by 'message.sender'
-    auto sent_transactions = getTransactions(
+    auto sent_transactions = getAllTransactions(
         fuseFilters({blockHeightFilter,
-                     filterWithAttribute(kEventTypeMessage, kAttributeKeySender, address)}),
-        1,
-        explorerTxBatchSize);
-    auto received_transactions = getTransactions(
+                     filterWithAttribute(kEventTypeMessage, kAttributeKeySender, address)}));
+    auto received_transactions = getAllTransactions(
         fuseFilters({blockHeightFilter,
-                     filterWithAttribute(kEventTypeTransfer, kAttributeKeyRecipient, address)}),
-        1,
-        explorerTxBatchSize);
+                     filterWithAttribute(kEventTypeTransfer, kAttributeKeyRecipient, address)}));
     std::vector<FuturePtr<cosmos::TransactionsBulk>> transaction_promises(
         {sent_transactions, received_transactions});
 
     return async::sequence(getContext(), transaction_promises)
         .flatMapPtr<cosmos::TransactionsBulk>(getContext(), [](const auto &vector_of_bulks) {
-            return FuturePtr<cosmos::TransactionsBulk>::successful(
-                concatenateBulks(vector_of_bulks));
+            return FuturePtr<cosmos::TransactionsBulk>::successful(mergeBulks(vector_of_bulks));
         });
 }
 
 FuturePtr<cosmos::TransactionsBulk> GaiaCosmosLikeBlockchainExplorer::getTransactionsForAddresses(
     const std::vector<std::string> &addresses, uint32_t fromBlockHeight) const
 {
-    std::vector<FuturePtr<cosmos::TransactionsBulk>> address_transactions;
+    // The Gaia search endpoint only filters on one address: bound the fan-out instead
+    std::vector<std::function<FuturePtr<cosmos::TransactionsBulk>()>> address_transactions;
     std::transform(
         addresses.begin(),
         addresses.end(),
         std::back_inserter(address_transactions),
-        [&](const auto &address) {
-            return this->getTransactionsForAddress(address, fromBlockHeight);
+        [this, fromBlockHeight](const auto &address) {
+            return [this, address, fromBlockHeight]() {
+                return this->getTransactionsForAddress(address, fromBlockHeight);
+            };
         });
-    return async::sequence(getContext(), address_transactions)
+    return executeAll(getContext(), address_transactions, explorers::DEFAULT_MAX_PARALLEL_REQUESTS)
         .flatMapPtr<cosmos::TransactionsBulk>(getContext(), [](const auto &vector_of_bulks) {
-            return FuturePtr<cosmos::TransactionsBulk>::successful(
-                concatenateBulks(vector_of_bulks));
+            return FuturePtr<cosmos::TransactionsBulk>::successful(mergeBulks(vector_of_bulks));
         });
 }
 
@@ -434,6 +469,7 @@ Future<Unit> GaiaCosmosLikeBlockchainExplorer::killSession(void *session)
 FuturePtr<ledger::core::Block> GaiaCosmosLikeBlockchainExplorer::getCurrentBlock() const
 {
     return _http->GET("/blocks/latest", ACCEPT_HEADER)
+        .cacheable()
         .json(true)
         .mapPtr<ledger::core::Block>(getContext(), [](const HttpRequest::JsonResult &response) {
             const auto &document = std::get<1>(response)->GetObject();
@@ -463,7 +499,12 @@ Future<String> GaiaCosmosLikeBlockchainExplorer::pushTransaction(
     return _http->POST("/txs", transaction, headers)
         .json()
         .template map<String>(
-            _executionContext, [](const HttpRequest::JsonResult &result) -> String {
+            _executionContext, [this](const HttpRequest::JsonResult &result) -> String {
+                // The broadcast moves funds, cached balances are outdated
+                {
+                    std::lock_guard<std::mutex> lock(_balanceSnapshotsLock);
+                    _balanceSnapshots.clear();
+                }
                 // The content of this payload actually depends on the mode of the transaction
                 // block has both check_tx and deliver_tx
                 // sync has check_tx
@@ -542,43 +583,115 @@ Future<cosmos::RedelegationList> GaiaCosmosLikeBlockchainExplorer::getRedelegati
 }
 
 // Balances
+FuturePtr<cosmos::BalanceSnapshot> GaiaCosmosLikeBlockchainExplorer::getBalanceSnapshot(
+    const std::string &account) const
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_balanceSnapshotsLock);
+    auto cached = _balanceSnapshots.find(account);
+    if (cached != _balanceSnapshots.end() && now - cached->second.requestedAt < _balanceSnapshotTTL) {
+        return cached->second.snapshot;
+    }
+    // Drop the expired snapshots of every account, the cache would otherwise grow with each
+    // account ever queried
+    for (auto it = _balanceSnapshots.begin(); it != _balanceSnapshots.end();) {
+        if (now - it->second.requestedAt >= _balanceSnapshotTTL) {
+            it = _balanceSnapshots.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    std::vector<FuturePtr<BigInt>> balances({fetchSpendableBalance(account),
+                                             fetchDelegatedBalance(account),
+                                             fetchUnbondingBalance(account),
+                                             fetchPendingRewardsBalance(account)});
+    auto snapshot = async::sequence(getContext(), balances)
+        .mapPtr<cosmos::BalanceSnapshot>(getContext(), [](const auto &figures) {
+            auto result = std::make_shared<cosmos::BalanceSnapshot>();
+            result->spendable = *figures[0];
+            result->delegated = *figures[1];
+            result->unbonding = *figures[2];
+            result->pendingRewards = *figures[3];
+            return result;
+        });
+    _balanceSnapshots.emplace(account, CachedBalanceSnapshot{now, snapshot});
+
+    // A failed snapshot must not be served until the TTL expires
+    std::weak_ptr<const GaiaCosmosLikeBlockchainExplorer> weakSelf = shared_from_this();
+    snapshot.onComplete(
+        getContext(),
+        [weakSelf, account, now](const Try<std::shared_ptr<cosmos::BalanceSnapshot>> &result) {
+            auto self = weakSelf.lock();
+            if (result.isSuccess() || !self) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(self->_balanceSnapshotsLock);
+            auto entry = self->_balanceSnapshots.find(account);
+            if (entry != self->_balanceSnapshots.end() && entry->second.requestedAt == now) {
+                self->_balanceSnapshots.erase(entry);
+            }
+        });
+    return snapshot;
+}
+
 /// Get Total Balance
 FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getTotalBalance(
     const std::string &account) const
 {
-    std::vector<FuturePtr<BigInt>> balance_promises({getSpendableBalance(account),
-                                                     getDelegatedBalance(account),
-                                                     getUnbondingBalance(account),
-                                                     getPendingRewardsBalance(account)});
-
-    return async::sequence(getContext(), balance_promises)
-        .flatMap<std::shared_ptr<BigInt>>(getContext(), [](auto &vector_of_balances) {
-            BigInt result;
-            for (const auto &balance : vector_of_balances) {
-                result = result + *balance;
-            }
-            return FuturePtr<BigInt>::successful(std::make_shared<BigInt>(result));
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->total());
         });
 }
 /// Get Total Balance
 FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getTotalBalanceWithoutPendingRewards(
     const std::string &account) const
 {
-    std::vector<FuturePtr<BigInt>> balance_promises(
-        {getSpendableBalance(account), getDelegatedBalance(account), getUnbondingBalance(account)});
-
-    return async::sequence(getContext(), balance_promises)
-        .flatMap<std::shared_ptr<BigInt>>(getContext(), [](auto &vector_of_balances) {
-            BigInt result;
-            for (const auto &balance : vector_of_balances) {
-                result = result + *balance;
-            }
-            return FuturePtr<BigInt>::successful(std::make_shared<BigInt>(result));
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->totalWithoutPendingRewards());
         });
 }
 /// Get total balance in delegation
 FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getDelegatedBalance(
     const std::string &account) const
+{
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->delegated);
+        });
+}
+/// Get total pending rewards
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getPendingRewardsBalance(
+    const std::string &account) const
+{
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->pendingRewards);
+        });
+}
+/// Get total unbonding balance
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getUnbondingBalance(
+    const std::string &account) const
+{
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->unbonding);
+        });
+}
+/// Get total available (spendable) balance
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getSpendableBalance(
+    const std::string &account) const
+{
+    return getBalanceSnapshot(account).mapPtr<BigInt>(
+        getContext(), [](const std::shared_ptr<cosmos::BalanceSnapshot> &snapshot) {
+            return std::make_shared<BigInt>(snapshot->spendable);
+        });
+}
+
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::fetchDelegatedBalance(
+    const std::string &account) const
 {
     const auto endpoint = fmt::format(cosmos::constants::kGaiaDelegationsEndpoint, account);
 
@@ -612,8 +725,7 @@ FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getDelegatedBalance(
                 return std::make_shared<BigInt>(total_amt);
             });
 }
-/// Get total pending rewards
-FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getPendingRewardsBalance(
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::fetchPendingRewardsBalance(
     const std::string &account) const
 {
     const auto endpoint = fmt::format(cosmos::constants::kGaiaRewardsEndpoint, account);
@@ -652,8 +764,7 @@ FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getPendingRewardsBalance(
             });
 }
 
-/// Get total unbonding balance
-FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getUnbondingBalance(
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::fetchUnbondingBalance(
     const std::string &account) const
 {
     const auto endpoint = fmt::format(cosmos::constants::kGaiaUnbondingsEndpoint, account);
@@ -692,8 +803,7 @@ FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getUnbondingBalance(
                 return std::make_shared<BigInt>(total_amt);
             });
 }
-/// Get total available (spendable) balance
-FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::getSpendableBalance(
+FuturePtr<BigInt> GaiaCosmosLikeBlockchainExplorer::fetchSpendableBalance(
     const std::string &account) const
 {
     const auto endpoint = fmt::format(cosmos::constants::kGaiaBalancesEndpoint, account);
@@ -31,6 +31,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <boost/utility/string_view.hpp>
 
 #include <async/DedicatedContext.hpp>
@@ -46,7 +51,8 @@ static const std::unordered_map<std::string, std::string> ACCEPT_HEADER{
 
 class GaiaCosmosLikeBlockchainExplorer :
     public CosmosLikeBlockchainExplorer,
-    public DedicatedContext {
+    public DedicatedContext,
+    public std::enable_shared_from_this<GaiaCosmosLikeBlockchainExplorer> {
    public:
     GaiaCosmosLikeBlockchainExplorer(
         const std::shared_ptr<api::ExecutionContext> &context,
@@ -78,6 +84,10 @@ class GaiaCosmosLikeBlockchainExplorer :
     FuturePtr<cosmos::TransactionsBulk> getTransactions(
         const TransactionFilter &filter, int page, int limit) const;
 
+    // Get the transactions following a given filter, up to kGaiaMaxTransactionsPagesPerBulk pages.
+    // The first page gives the total count, the following pages are then fetched concurrently.
+    FuturePtr<cosmos::TransactionsBulk> getAllTransactions(const TransactionFilter &filter) const;
+
     // Single transaction querier (found by hash)
     FuturePtr<cosmos::Transaction> getTransactionByHash(const std::string &hash) override;
 
@@ -101,6 +111,11 @@ class GaiaCosmosLikeBlockchainExplorer :
         const std::string &delegatorAddress) const override;
 
     // Balances
+    /// Get every balance figure of the account, the four balance resources are fetched
+    /// concurrently and the result is cached for TTL_CACHE seconds when configured, for
+    /// kGaiaBalanceSnapshotTTL otherwise (concurrent callers share the same in-flight requests)
+    FuturePtr<cosmos::BalanceSnapshot> getBalanceSnapshot(
+        const std::string &account) const override;
     /// Get Total Balance
     FuturePtr<BigInt> getTotalBalance(const std::string &account) const override;
     /// Get Total Balance except pending rewards
@@ -129,6 +144,13 @@ class GaiaCosmosLikeBlockchainExplorer :
         const std::string gasAdjustment = "1.0") const override;
 
    private:
+    struct TransactionsPage {
+        std::shared_ptr<cosmos::TransactionsBulk> bulk;
+        int totalCount;
+    };
+
+    Future<TransactionsPage> getTransactionsPage(
+        const TransactionFilter &filter, int page, int limit) const;
 
     /// Parse a transaction and add post-treatment / sanitization.
     /// The sanitization of output includes :
@@ -185,9 +207,22 @@ class GaiaCosmosLikeBlockchainExplorer :
         const std::shared_ptr<api::CosmosLikeMessage> &message,
         const std::string gasAdjustment = "1.0") const;
 
+    FuturePtr<BigInt> fetchDelegatedBalance(const std::string &account) const;
+    FuturePtr<BigInt> fetchPendingRewardsBalance(const std::string &account) const;
+    FuturePtr<BigInt> fetchUnbondingBalance(const std::string &account) const;
+    FuturePtr<BigInt> fetchSpendableBalance(const std::string &account) const;
+
+    struct CachedBalanceSnapshot {
+        std::chrono::steady_clock::time_point requestedAt;
+        FuturePtr<cosmos::BalanceSnapshot> snapshot;
+    };
+
    private:
     std::shared_ptr<HttpClient> _http;
     api::CosmosLikeNetworkParameters _parameters;
+    std::chrono::seconds _balanceSnapshotTTL;
+    mutable std::mutex _balanceSnapshotsLock;
+    mutable std::unordered_map<std::string, CachedBalanceSnapshot> _balanceSnapshots;
 };
 
 }  // namespace core
@@ -35,6 +35,7 @@
 #include <api/KeychainEngines.hpp>
 #include <api/SynchronizationEngines.hpp>
 #include <database/migrations.hpp>
+#include <wallet/cosmos/CosmosLikeConstants.hpp>
 #include <wallet/cosmos/CosmosLikeWallet.hpp>
 #include <wallet/cosmos/CosmosNetworks.hpp>
 #include <wallet/cosmos/explorers/GaiaCosmosLikeBlockchainExplorer.hpp>
@@ -129,6 +130,7 @@ std::shared_ptr<AbstractWallet> CosmosLikeWalletFactory::build(const WalletDatab
     return std::make_shared<CosmosLikeWallet>(
         entry.name,
         explorer,
+        getValidatorCache(explorer),
         observer,
         keychainFactory->second,
         synchronizerFactory.getValue(),
@@ -184,6 +186,32 @@ std::shared_ptr<CosmosLikeBlockchainExplorer> CosmosLikeWalletFactory::getExplor
         "CosmosLikeWalletFactory using non supported explorer");
 }
 
+std::shared_ptr<CosmosLikeValidatorCache> CosmosLikeWalletFactory::getValidatorCache(
+    const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer)
+{
+    // A cache queries the explorer of the wallets it serves: wallets configured with another
+    // endpoint get their own cache
+    auto it = _validatorCaches.begin();
+    while (it != _validatorCaches.end()) {
+        auto cache = it->lock();
+        if (cache != nullptr) {
+            if (cache->getExplorer() == explorer) {
+                return cache;
+            }
+            it++;
+        }
+        else {
+            it = _validatorCaches.erase(it);
+        }
+    }
+    auto context = getPool()->getDispatcher()->getSerialExecutionContext(
+        api::BlockchainObserverEngines::COSMOS_NODE);
+    auto cache = std::make_shared<CosmosLikeValidatorCache>(
+        context, explorer, cosmos::constants::kValidatorsRefreshInterval);
+    _validatorCaches.push_back(cache);
+    return cache;
+}
+
 std::shared_ptr<CosmosLikeBlockchainObserver> CosmosLikeWalletFactory::getObserver(
     const std::string &currencyName, const std::shared_ptr<api::DynamicObject> &configuration)
 {
@@ -35,6 +35,7 @@
 
 #include <api/Currency.hpp>
 #include <wallet/common/AbstractWalletFactory.hpp>
+#include <wallet/cosmos/CosmosLikeValidatorCache.hpp>
 #include <wallet/cosmos/explorers/CosmosLikeBlockchainExplorer.hpp>
 #include <wallet/cosmos/factories/CosmosLikeKeychainFactory.hpp>
 #include <wallet/cosmos/observers/CosmosLikeBlockchainObserver.hpp>
@@ -57,8 +58,13 @@ class CosmosLikeWalletFactory : public AbstractWalletFactory {
         const std::string &currencyName, const std::shared_ptr<api::DynamicObject> &configuration);
     std::shared_ptr<CosmosLikeBlockchainObserver> getObserver(
         const std::string &currencyName, const std::shared_ptr<api::DynamicObject> &configuration);
+    std::shared_ptr<CosmosLikeValidatorCache> getValidatorCache(
+        const std::shared_ptr<CosmosLikeBlockchainExplorer> &explorer);
 
    private:
+    // Validators of the currency, shared by all the wallets of the pool using the same explorer
+    std::list<std::weak_ptr<CosmosLikeValidatorCache>> _validatorCaches;
+
     // Explorers
     std::list<std::weak_ptr<CosmosLikeBlockchainExplorer>> _runningExplorers;
 
@@ -66,7 +66,7 @@ std::string CosmosLikeKeychain::getRestoreKey() const
 {
     std::vector<uint8_t> payload{0xEB, 0x5A, 0xE9, 0x87, (uint8_t)_pubKey.size()};
     payload.insert(payload.end(), _pubKey.begin(), _pubKey.end());
-    return CosmosBech32(api::CosmosBech32Type::PUBLIC_KEY).encode(payload, {});
+    return CosmosBech32::forType(api::CosmosBech32Type::PUBLIC_KEY)->encode(payload, {});
 }
 
 const std::vector<uint8_t> &CosmosLikeKeychain::getPublicKey() const
@@ -83,7 +83,7 @@ std::vector<CosmosLikeKeychain::Address> CosmosLikeKeychain::getAllObservableAdd
 std::shared_ptr<CosmosLikeKeychain> CosmosLikeKeychain::restore(
     const DerivationPath &path, const api::Currency &currency, const std::string &restoreKey)
 {
-    auto p = CosmosBech32(api::CosmosBech32Type::PUBLIC_KEY).decode(restoreKey);
+    auto p = CosmosBech32::forType(api::CosmosBech32Type::PUBLIC_KEY)->decode(restoreKey);
     std::vector<uint8_t> pubKey(std::get<1>(p).begin() + 5, std::get<1>(p).end());
     return std::make_shared<CosmosLikeKeychain>(pubKey, path, currency);
 }
@@ -422,7 +422,7 @@ Future<bool> CosmosLikeAccountSynchronizer::synchronizeBatch(
 
                 // Get the last block
                 if (bulk->transactions.size() > 0) {
-                    auto &lastBlock = bulk->transactions.back().block;
+                    auto &lastBlock = bulk->resumeBlock.nonEmpty() ? bulk->resumeBlock : bulk->transactions.back().block;
 
                     if (lastBlock.nonEmpty()) {
                         batchState.blockHeight = (uint32_t)lastBlock.getValue().height;
@@ -30,6 +30,7 @@
 
 #include "ERC20LikeAccount.h"
 #include <math/BigInt.h>
+#include <math/FixedWidthInt.hpp>
 #include <api_impl/BigIntImpl.hpp>
 #include <api/Amount.hpp>
 #include <api/OperationType.hpp>
@@ -46,7 +47,9 @@
 #include <soci.h>
 #include <database/soci-date.h>
 #include <database/query/ConditionQueryFilter.h>
+#include <database/BulkDatabaseHelper.hpp>
 #include <wallet/pool/WalletPool.hpp>
+#include <wallet/ethereum/database/EthereumLikeAccountDatabaseHelper.h>
 
 using namespace soci;
 
@@ -78,7 +81,9 @@ namespace ledger {
             if (!parentAccount) {
                 throw make_exception(api::ErrorCode::NULL_POINTER, "Could not lock parent account.");
             }
-            return parentAccount->getERC20Balance(_token.contractAddress);
+            return parentAccount->getLocalERC20Balance(_accountUid).mapPtr<api::BigInt>(getContext(), [] (const std::shared_ptr<BigInt> &balance) -> std::shared_ptr<api::BigInt> {
+                return std::make_shared<api::BigIntImpl>(*balance);
+            });
         }
 
         void ERC20LikeAccount::getBalance(const std::shared_ptr<api::BigIntCallback> & callback) {
@@ -90,39 +95,69 @@ namespace ledger {
             const std::chrono::system_clock::time_point& endDate,
             api::TimePeriod precision
         ) {
-            auto operations = getOperations();
-            // manually sort by date
-            std::sort(
-                operations.begin(),
-                operations.end(),
-                [](
-                    const std::shared_ptr<api::ERC20LikeOperation>& a,
-                    const std::shared_ptr<api::ERC20LikeOperation>& b
-                ) {
-                    return a->getTime() < b->getTime();
+            auto localAccount = _account.lock();
+            if (!localAccount) {
+                throw make_exception(api::ErrorCode::NULL_POINTER, "Account was released.");
+            }
+
+            // Only the columns needed to compute balances, already sorted by the (account_uid, date) index.
+            // Dates are stored in the fixed width JSON format, so their lexicographic order is chronological.
+            struct BalanceEntry {
+                std::chrono::system_clock::time_point date;
+                api::OperationType type;
+                UInt256 value;
+            };
+            std::vector<BalanceEntry> entries;
+            {
+                soci::session sql(localAccount->getWallet()->getDatabase()->getPool());
+                soci::rowset<soci::row> rows = (sql.prepare << "SELECT type, value, date FROM erc20_operations"
+                        " WHERE account_uid = :account_uid ORDER BY date", soci::use(_accountUid));
+                for (auto& row : rows) {
+                    entries.push_back(BalanceEntry {
+                        DateUtils::fromJSON(row.get<std::string>(2)),
+                        api::from_string<api::OperationType>(row.get<std::string>(0)),
+                        UInt256::fromHex(row.get<std::string>(1))
+                    });
                 }
-            );
+            }
 
-            // a small type used to pick implementations used by agnostic::getBalanceHistoryFor.
+            // a small type used to pick implementations used by agnostic::getBalanceHistoryFor. Sums are
+            // kept in Int256, and in BigInt when a token with a huge supply overflows it.
             struct OperationStrategy {
-                static inline std::chrono::system_clock::time_point date(std::shared_ptr<api::ERC20LikeOperation>& op) {
-                    return op->getTime();
+                static inline std::chrono::system_clock::time_point date(const BalanceEntry& entry) {
+                    return entry.date;
+                }
+
+                static inline std::shared_ptr<api::BigInt> value_constructor(const Int256& v) {
+                    return std::make_shared<api::BigIntImpl>(v.toBigInt());
                 }
 
                 static inline std::shared_ptr<api::BigInt> value_constructor(const BigInt& v) {
                     return std::make_shared<api::BigIntImpl>(v);
                 }
 
-                static inline void update_balance(std::shared_ptr<api::ERC20LikeOperation>& op, BigInt& sum) {
-                    auto value = BigInt(op->getValue()->toString(10));
+                static inline void update_balance(const BalanceEntry& entry, Int256& sum) {
+                    switch (entry.type) {
+                        case api::OperationType::RECEIVE:
+                            sum += Int256(entry.value);
+                            break;
+
+                        case api::OperationType::SEND:
+                            sum -= Int256(entry.value);
+                            break;
+                        default:
+                            break;
+                    }
+                }
 
-                    switch (op->getOperationType()) {
+                static inline void update_balance(const BalanceEntry& entry, BigInt& sum) {
+                    switch (entry.type) {
                         case api::OperationType::RECEIVE:
-                            sum = sum + value;
+                            sum = sum + entry.value.toBigInt();
                             break;
 
                         case api::OperationType::SEND:
-                            sum = sum - value;
+                            sum = sum - entry.value.toBigInt();
                             break;
                         default:
                             break;
@@ -130,13 +165,27 @@ namespace ledger {
                 }
             };
 
+            try {
+                return agnostic::getBalanceHistoryFor<OperationStrategy, Int256, api::BigInt>(
+                    startDate,
+                    endDate,
+                    precision,
+                    entries.cbegin(),
+                    entries.cend(),
+                    Int256()
+                );
+            } catch (const Exception& ex) {
+                if (ex.getErrorCode() != api::ErrorCode::OUT_OF_RANGE) {
+                    throw;
+                }
+            }
             return agnostic::getBalanceHistoryFor<OperationStrategy, BigInt, api::BigInt>(
                 startDate,
                 endDate,
                 precision,
-                operations.cbegin(),
-                operations.cend(),
-                BigInt()
+                entries.cbegin(),
+                entries.cend(),
+                BigInt::ZERO
             );
         }
 
@@ -242,39 +291,116 @@ namespace ledger {
             getTransferToAddressData(amount, address).callback(context, data);
         }
 
-        void ERC20LikeAccount::putOperation(soci::session &sql, const std::shared_ptr<ERC20LikeOperation> &operation, bool newOperation) {
+        void ERC20LikeAccount::putOperation(soci::session &sql,
+                                            const std::shared_ptr<ERC20LikeOperation> &operation,
+                                            const Option<int32_t> &storedStatus) {
+            if (storedStatus.isEmpty()) {
+                putOperations(sql, {operation});
+                return;
+            }
             auto status = operation->getStatus();
             auto erc20OpUid = operation->getOperationUid();
             auto gasUsed = operation->getUsedGas()->toString(16);
-            if (newOperation) {
-                auto ethOpUid = operation->getETHOperationUid();
-                auto hash = operation->getHash();
-                auto receiver = operation->getReceiver();
-                auto sender = operation->getSender();
-                auto data = hex::toString(operation->getData());
-                auto operationType = api::to_string(operation->getOperationType());
-                auto nonce = operation->getNonce()->toString(16);
-                auto value = operation->getValue()->toString(16);
-                auto time = operation->getTime();
-                auto gasPrice = operation->getGasPrice()->toString(16);
-                auto gasLimit = operation->getGasLimit()->toString(16);
-                auto blockHeight = operation->getBlockHeight().value_or(0);
-                sql << "INSERT INTO erc20_operations VALUES("
-                        ":uid, :eth_op_uid, :accout_uid, :op_type, :hash, :nonce, :value, :date, :sender,"
-                        ":receiver, :data, :gas_price, :gas_limit, :gas_used, :status, :block_height"
-                        ")"
-                        , use(erc20OpUid), use(ethOpUid)
-                        , use(_accountUid), use(operationType), use(hash)
-                        , use(nonce), use(value), use(time)
-                        , use(sender), use(receiver), use(data)
-                        , use(gasPrice), use(gasLimit), use(gasUsed)
-                        , use(status), use(blockHeight);
+            // Only successful transfers move tokens, a status change (e.g. a pending transfer being mined or
+            // failing) applies or reverts the operation on the local balance.
+            auto wasApplied = storedStatus.getValue() == 1;
+            auto isApplied = status == 1;
+            if (wasApplied != isApplied) {
+                BigInt credit, debit;
+                accumulateTransfer(*operation, isApplied, credit, debit);
+                updateLocalBalance(sql, credit, debit);
+            }
+            sql << "UPDATE erc20_operations SET status = :code , gas_used = :gas WHERE uid = :uid"
+                    , use(status)
+                    , use(gasUsed)
+                    , use(erc20OpUid);
+        }
+
+        void ERC20LikeAccount::putOperations(soci::session &sql,
+                                             const std::vector<std::shared_ptr<ERC20LikeOperation>> &operations) {
+            struct OperationRow {
+                std::string uid;
+                std::string ethOpUid;
+                std::string type;
+                std::string hash;
+                std::string nonce;
+                std::string value;
+                std::string date;
+                std::string sender;
+                std::string receiver;
+                std::string data;
+                std::string gasPrice;
+                std::string gasLimit;
+                std::string gasUsed;
+                int32_t status;
+                long long blockHeight;
+            };
+            std::vector<OperationRow> rows;
+            rows.reserve(operations.size());
+            BigInt credit, debit;
+            for (auto &operation : operations) {
+                rows.push_back(OperationRow {
+                    operation->getOperationUid(),
+                    operation->getETHOperationUid(),
+                    api::to_string(operation->getOperationType()),
+                    operation->getHash(),
+                    operation->getNonce()->toString(16),
+                    operation->getValue()->toString(16),
+                    DateUtils::toJSON(operation->getTime()),
+                    operation->getSender(),
+                    operation->getReceiver(),
+                    hex::toString(operation->getData()),
+                    operation->getGasPrice()->toString(16),
+                    operation->getGasLimit()->toString(16),
+                    operation->getUsedGas()->toString(16),
+                    operation->getStatus(),
+                    operation->getBlockHeight().value_or(0)
+                });
+                if (operation->getStatus() == 1) {
+                    accumulateTransfer(*operation, true, credit, debit);
+                }
+            }
+            BulkDatabaseHelper::insert(sql, "erc20_operations", 16, rows, [this] (BulkDatabaseHelper::Statement &statement, const OperationRow &row) {
+                statement, use(row.uid), use(row.ethOpUid), use(_accountUid), use(row.type), use(row.hash),
+                        use(row.nonce), use(row.value), use(row.date), use(row.sender), use(row.receiver),
+                        use(row.data), use(row.gasPrice), use(row.gasLimit), use(row.gasUsed),
+                        use(row.status), use(row.blockHeight);
+            });
+            if (!credit.isZero() || !debit.isZero()) {
+                updateLocalBalance(sql, credit, debit);
+            }
+        }
+
+        void ERC20LikeAccount::accumulateTransfer(ERC20LikeOperation &operation, bool apply, BigInt &credit, BigInt &debit) {
+            auto type = operation.getOperationType();
+            if (type != api::OperationType::RECEIVE && type != api::OperationType::SEND) {
+                return;
+            }
+            BigInt value(operation.getValue()->toString(10));
+            if ((type == api::OperationType::RECEIVE) == apply) {
+                credit = credit + value;
+            } else {
+                debit = debit + value;
+            }
+        }
+
+        void ERC20LikeAccount::updateLocalBalance(soci::session &sql, const BigInt &credit, const BigInt &debit) {
+            // Let an in-flight reconciliation know that its explorer balances may predate these transfers
+            auto parentAccount = _account.lock();
+            if (parentAccount) {
+                parentAccount->onERC20LedgerUpdate();
+            }
+            auto balance = EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, _accountUid);
+            if (balance.isEmpty()) {
+                // Not reconciled yet, the next reconciliation will account for these operations
+                return;
+            }
+            auto updated = balance.getValue() + credit;
+            if (updated >= debit) {
+                EthereumLikeAccountDatabaseHelper::putERC20AccountBalance(sql, _accountUid, updated - debit);
             } else {
-                // Update
-                sql << "UPDATE erc20_operations SET status = :code , gas_used = :gas WHERE uid = :uid"
-                        , use(status)
-                        , use(gasUsed)
-                        , use(erc20OpUid);
+                // The local ledger drifted from the stored transfers, drop it so that it is summed again
+                EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalance(sql, _accountUid);
             }
         }
 
@@ -100,9 +100,17 @@ namespace ledger {
                                           const std::shared_ptr<api::BinaryCallback> &data) override;
 
             std::shared_ptr<api::OperationQuery> queryOperations() override ;
-            void putOperation(soci::session &sql, const std::shared_ptr<ERC20LikeOperation> &operation, bool newOperation = false);
+            // Insert or update an operation and report its effect on the locally maintained balance.
+            // storedStatus is the status currently stored for the operation, none if it is a new operation.
+            void putOperation(soci::session &sql,
+                              const std::shared_ptr<ERC20LikeOperation> &operation,
+                              const Option<int32_t> &storedStatus = Option<int32_t>());
+            // Insert new operations in bulk and apply the successful ones on the local balance.
+            void putOperations(soci::session &sql, const std::vector<std::shared_ptr<ERC20LikeOperation>> &operations);
         private:
             std::shared_ptr<api::ExecutionContext> getContext();
+            static void accumulateTransfer(ERC20LikeOperation &operation, bool apply, BigInt &credit, BigInt &debit);
+            void updateLocalBalance(soci::session &sql, const BigInt &credit, const BigInt &debit);
 
             api::ERC20Token _token;
             std::string _accountAddress;
@@ -55,6 +55,8 @@
 #include <database/soci-number.h>
 #include <database/soci-date.h>
 #include <database/soci-option.h>
+#include <database/BulkDatabaseHelper.hpp>
+#include <algorithm>
 
 namespace ledger {
     namespace core {
@@ -64,7 +66,7 @@ namespace ledger {
                                                  const std::shared_ptr<EthereumLikeBlockchainExplorer>& explorer,
                                                  const std::shared_ptr<EthereumLikeBlockchainObserver>& observer,
                                                  const std::shared_ptr<EthereumLikeAccountSynchronizer>& synchronizer,
-                                                 const std::shared_ptr<EthereumLikeKeychain>& keychain): AbstractAccount(wallet, index) {
+                                                 const std::shared_ptr<EthereumLikeKeychain>& keychain): AbstractAccount(wallet, index), _erc20LedgerGeneration(0) {
             _explorer = explorer;
             _observer = observer;
             _synchronizer = synchronizer;
@@ -102,6 +104,15 @@ namespace ledger {
 
         int EthereumLikeAccount::putTransaction(soci::session &sql,
                                                 const EthereumLikeBlockchainExplorerTransaction &transaction) {
+            ERC20OperationsBatch erc20Batch;
+            auto result = putTransaction(sql, transaction, erc20Batch);
+            flushERC20Operations(sql, erc20Batch);
+            return result;
+        }
+
+        int EthereumLikeAccount::putTransaction(soci::session &sql,
+                                                const EthereumLikeBlockchainExplorerTransaction &transaction,
+                                                ERC20OperationsBatch &erc20Batch) {
             auto wallet = getWallet();
             if (wallet == nullptr) {
                 throw Exception(api::ErrorCode::RUNTIME_ERROR, "Wallet reference is dead.");
@@ -135,7 +146,7 @@ namespace ledger {
                 operation.type = ty;
                 operation.refreshUid();
                 OperationDatabaseHelper::putOperation(sql, operation);
-                updateERC20Accounts(sql, operation);
+                updateERC20Accounts(sql, operation, erc20Batch);
                 updateInternalTransactions(sql, operation);
             };
 
@@ -160,7 +171,8 @@ namespace ledger {
         }
 
         void EthereumLikeAccount::updateERC20Accounts(soci::session &sql,
-                                                      const Operation &operation) {
+                                                      const Operation &operation,
+                                                      ERC20OperationsBatch &erc20Batch) {
             auto transaction = operation.ethereumTransaction.getValue();
             // No need filter because erc20 transfer events sent by explorer
             // are only the ones concerning current account
@@ -170,11 +182,11 @@ namespace ledger {
                                    api::OperationType::SEND : (erc20Tx.to == _accountAddress) ?
                                                               api::OperationType::RECEIVE : api::OperationType::NONE;
 
-                    updateERC20Operation(sql, operation, erc20Tx);
+                    updateERC20Operation(sql, operation, erc20Tx, erc20Batch);
                     // Handle ERC20 self-transactions
                     if (erc20Tx.to == _accountAddress) {
                         erc20Tx.type = api::OperationType::RECEIVE;
-                        updateERC20Operation(sql, operation, erc20Tx);
+                        updateERC20Operation(sql, operation, erc20Tx, erc20Batch);
                     }
                 }
             }
@@ -182,48 +194,118 @@ namespace ledger {
 
         void EthereumLikeAccount::updateERC20Operation(soci::session &sql,
                                                        const Operation &operation,
-                                                       const ERC20Transaction &erc20Tx) {
+                                                       const ERC20Transaction &erc20Tx,
+                                                       ERC20OperationsBatch &erc20Batch) {
             auto erc20ContractAddress = erc20Tx.contractAddress;
             auto erc20OperationUid = OperationDatabaseHelper::createUid(operation.uid, erc20ContractAddress, erc20Tx.type);
             auto erc20Operation = std::make_shared<ERC20LikeOperation>(_accountAddress, erc20OperationUid, operation, erc20Tx, getWallet()->getCurrency());
-            auto erc20AccountUid = AccountDatabaseHelper::createERC20AccountUid(getAccountUid(), erc20ContractAddress);
-
-            auto erc20OpCount = 0;
-            sql << "SELECT COUNT(*) FROM erc20_operations WHERE uid = :uid", soci::use(erc20OperationUid), soci::into(erc20OpCount);
-            auto newOperation = erc20OpCount == 0;
-            //Check if account already exists
-            auto needNewAccount = true;
-            for (auto& account : _erc20LikeAccounts) {
-                auto erc20Account = std::static_pointer_cast<ERC20LikeAccount>(account);
-                if (erc20Account->getToken().contractAddress == erc20ContractAddress &&
-                    erc20Account->getAddress() == _accountAddress) {
-                    //Update account
-                    erc20Account->putOperation(sql, erc20Operation, newOperation);
-                    needNewAccount = false;
-                }
-            }
 
-            //Create a new account
-            if (needNewAccount) {
+            std::shared_ptr<ERC20LikeAccount> erc20Account;
+            auto it = _erc20LikeAccountsByContract.find(erc20ContractAddress);
+            auto staged = std::find_if(_stagedERC20Accounts.begin(), _stagedERC20Accounts.end(), [&] (const std::shared_ptr<ERC20LikeAccount> &account) {
+                return account->getToken().contractAddress == erc20ContractAddress;
+            });
+            if (it != _erc20LikeAccountsByContract.end()) {
+                erc20Account = it->second;
+            } else if (staged != _stagedERC20Accounts.end()) {
+                erc20Account = *staged;
+            } else {
+                //Create a new account
+                auto erc20AccountUid = AccountDatabaseHelper::createERC20AccountUid(getAccountUid(), erc20ContractAddress);
                 auto erc20Token = EthereumLikeAccountDatabaseHelper::getOrCreateERC20Token(sql, erc20ContractAddress);
-                auto newAccount = std::make_shared<ERC20LikeAccount>(erc20AccountUid,
-                                                                     erc20Token,
-                                                                     _accountAddress,
-                                                                     getWallet()->getCurrency(),
-                                                                     std::dynamic_pointer_cast<EthereumLikeAccount>(shared_from_this()));
-                _erc20LikeAccounts.push_back(newAccount);
+                erc20Account = std::make_shared<ERC20LikeAccount>(erc20AccountUid,
+                                                                  erc20Token,
+                                                                  _accountAddress,
+                                                                  getWallet()->getCurrency(),
+                                                                  std::dynamic_pointer_cast<EthereumLikeAccount>(shared_from_this()));
+                // Its row may still be rolled back with the staged writes, the account is indexed once they commit
+                if (isStagingChanges()) {
+                    _stagedERC20Accounts.push_back(erc20Account);
+                } else {
+                    _erc20LikeAccounts.push_back(erc20Account);
+                    _erc20LikeAccountsByContract[erc20ContractAddress] = erc20Account;
+                }
                 //Persist erc20 account
                 int erc20AccountCount = 0;
                 sql << "SELECT COUNT(*) FROM erc20_accounts WHERE uid = :uid", soci::use(erc20AccountUid), soci::into(erc20AccountCount);
                 if (erc20AccountCount == 0) {
                     EthereumLikeAccountDatabaseHelper::createERC20Account(sql, getAccountUid(), erc20AccountUid, erc20Token.contractAddress);
                 }
-                newAccount->putOperation(sql, erc20Operation, newOperation);
             }
+            erc20Batch.operations.emplace_back(erc20Account, erc20Operation);
+        }
+
+        void EthereumLikeAccount::stageLocalChanges() {
+            _stagedERC20Accounts.clear();
+        }
+
+        size_t EthereumLikeAccount::markLocalChanges() {
+            return _stagedERC20Accounts.size();
+        }
+
+        void EthereumLikeAccount::dropLocalChanges(size_t mark) {
+            if (mark < _stagedERC20Accounts.size()) {
+                _stagedERC20Accounts.resize(mark);
+            }
+        }
+
+        void EthereumLikeAccount::commitLocalChanges() {
+            for (auto &erc20Account : _stagedERC20Accounts) {
+                _erc20LikeAccounts.push_back(erc20Account);
+                _erc20LikeAccountsByContract[erc20Account->getToken().contractAddress] = erc20Account;
+            }
+            _stagedERC20Accounts.clear();
+        }
+
+        void EthereumLikeAccount::discardLocalChanges() {
+            _stagedERC20Accounts.clear();
+        }
+
+        void EthereumLikeAccount::flushERC20Operations(soci::session &sql, ERC20OperationsBatch &erc20Batch) {
+            if (erc20Batch.operations.empty()) {
+                return;
+            }
+            // An operation seen several times in the batch is written with its latest state
+            std::unordered_map<std::string, size_t> latestIndexes;
+            std::vector<std::string> uids;
+            for (size_t index = 0; index < erc20Batch.operations.size(); index++) {
+                auto uid = erc20Batch.operations[index].second->getOperationUid();
+                if (latestIndexes.find(uid) == latestIndexes.end()) {
+                    uids.push_back(uid);
+                }
+                latestIndexes[uid] = index;
+            }
+
+            auto storedStatuses = EthereumLikeAccountDatabaseHelper::getERC20OperationsStatuses(sql, uids);
+            std::map<std::shared_ptr<ERC20LikeAccount>, std::vector<std::shared_ptr<ERC20LikeOperation>>> newOperations;
+            for (auto &uid : uids) {
+                auto &entry = erc20Batch.operations[latestIndexes[uid]];
+                auto stored = storedStatuses.find(uid);
+                if (stored == storedStatuses.end()) {
+                    newOperations[entry.first].push_back(entry.second);
+                } else {
+                    entry.first->putOperation(sql, entry.second, Option<int32_t>(stored->second));
+                }
+            }
+            for (auto &accountOperations : newOperations) {
+                accountOperations.first->putOperations(sql, accountOperations.second);
+            }
+            erc20Batch.operations.clear();
         }
 
         void EthereumLikeAccount::updateInternalTransactions(soci::session &sql,
                                                              const Operation &operation) {
+            struct InternalOperationRow {
+                std::string uid;
+                std::string type;
+                std::string value;
+                std::string sender;
+                std::string receiver;
+                std::string gasLimit;
+                std::string gasUsed;
+                std::string inputData;
+            };
+            std::vector<InternalOperationRow> rows;
             auto transaction = operation.ethereumTransaction.getValue();
             uint64_t index = 0;
             for (auto &internalTx : transaction.internalTransactions) {
@@ -241,27 +323,24 @@ namespace ledger {
                                 api::OperationType::NONE;
 
                     auto internalTxUid = OperationDatabaseHelper::createUid(operation.uid, fmt::format("{}-{}-{}", internalTx.from, hex::toString(internalTx.inputData), index), type);
-                    auto actionCount = 0;
-                    sql << "SELECT COUNT(*) FROM internal_operations WHERE uid = :uid", soci::use(internalTxUid), soci::into(actionCount);
-                    if (actionCount == 0) {
-                        auto value = internalTx.value.toHexString();
-                        auto gasLimit = internalTx.gasLimit.toHexString();
-                        auto gasUsed = internalTx.gasUsed.getValueOr(BigInt::ZERO).toHexString();
-                        auto inputData = hex::toString(internalTx.inputData);
-                        auto operationType = api::to_string(type);
-                        sql << "INSERT INTO internal_operations VALUES(:uid, :eth_op_uid, :type, :value, :sender, :receiver, :gas_limit, :gas_used, :input_data)",
-                                soci::use(internalTxUid),
-                                soci::use(operation.uid),
-                                soci::use(operationType),
-                                soci::use(value),
-                                soci::use(internalTx.from),
-                                soci::use(internalTx.to),
-                                soci::use(gasLimit),
-                                soci::use(gasUsed),
-                                soci::use(inputData);
-                    }
+                    rows.push_back(InternalOperationRow {
+                        internalTxUid,
+                        api::to_string(type),
+                        internalTx.value.toHexString(),
+                        internalTx.from,
+                        internalTx.to,
+                        internalTx.gasLimit.toHexString(),
+                        internalTx.gasUsed.getValueOr(BigInt::ZERO).toHexString(),
+                        hex::toString(internalTx.inputData)
+                    });
                 }
             }
+            // Already stored internal operations are left untouched
+            BulkDatabaseHelper::insert(sql, "internal_operations", 9, rows, [&operation] (BulkDatabaseHelper::Statement &statement, const InternalOperationRow &row) {
+                statement, soci::use(row.uid), soci::use(operation.uid), soci::use(row.type), soci::use(row.value),
+                        soci::use(row.sender), soci::use(row.receiver), soci::use(row.gasLimit),
+                        soci::use(row.gasUsed), soci::use(row.inputData);
+            }, BulkDatabaseHelper::OnConflict::IGNORE);
         }
 
         std::vector<Operation> EthereumLikeAccount::getInternalOperations(soci::session &sql) {
@@ -477,6 +556,12 @@ namespace ledger {
 
                 auto accountUid = getAccountUid();
                 sql << "DELETE FROM operations WHERE account_uid = :account_uid AND date >= :date ", soci::use(accountUid), soci::use(date);
+                // Erased ERC20 operations leave the local balances behind, they will be reconciled on next read
+                EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalances(sql, accountUid);
+                {
+                    std::lock_guard<std::mutex> balancesLock(_erc20BalancesLock);
+                    _erc20BalancesReconciledAt = Option<std::chrono::system_clock::time_point>();
+                }
                 return Future<api::ErrorCode>::successful(api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
 
         }
@@ -662,6 +747,102 @@ namespace ledger {
             getERC20Balances(erc20Addresses).callback(getMainExecutionContext(), callback);
         }
 
+        const std::chrono::seconds EthereumLikeAccount::ERC20_BALANCES_RECONCILIATION_INTERVAL = std::chrono::seconds(60);
+
+        bool EthereumLikeAccount::areERC20BalancesReconciled() {
+            std::lock_guard<std::mutex> lock(_erc20BalancesLock);
+            return _erc20BalancesReconciledAt.hasValue() &&
+                   std::chrono::system_clock::now() - _erc20BalancesReconciledAt.getValue() < ERC20_BALANCES_RECONCILIATION_INTERVAL;
+        }
+
+        FuturePtr<BigInt> EthereumLikeAccount::getLocalERC20Balance(const std::string &erc20AccountUid) {
+            auto self = getSelf();
+            auto readBalance = [self, erc20AccountUid] () -> Option<BigInt> {
+                soci::session sql(self->getWallet()->getDatabase()->getPool());
+                return EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, erc20AccountUid);
+            };
+            return async<Option<BigInt>>(readBalance)
+                    .flatMap<std::shared_ptr<BigInt>>(getContext(), [self, erc20AccountUid] (const Option<BigInt> &balance) {
+                        if (balance.hasValue() && self->areERC20BalancesReconciled()) {
+                            return FuturePtr<BigInt>::successful(std::make_shared<BigInt>(balance.getValue()));
+                        }
+                        return self->reconcileERC20Balances().map<std::shared_ptr<BigInt>>(self->getContext(), [erc20AccountUid] (const std::unordered_map<std::string, BigInt> &computed) {
+                            auto it = computed.find(erc20AccountUid);
+                            return std::make_shared<BigInt>(it != computed.end() ? it->second : BigInt::ZERO);
+                        });
+                    });
+        }
+
+        void EthereumLikeAccount::onERC20LedgerUpdate() {
+            _erc20LedgerGeneration++;
+        }
+
+        Future<std::unordered_map<std::string, BigInt>> EthereumLikeAccount::reconcileERC20Balances() {
+            std::vector<std::string> erc20AccountUids;
+            std::vector<std::string> contractAddresses;
+            for (auto &account : _erc20LikeAccounts) {
+                auto erc20Account = std::static_pointer_cast<ERC20LikeAccount>(account);
+                erc20AccountUids.push_back(AccountDatabaseHelper::createERC20AccountUid(getAccountUid(), erc20Account->getToken().contractAddress));
+                contractAddresses.push_back(erc20Account->getToken().contractAddress);
+            }
+            using Balances = std::unordered_map<std::string, BigInt>;
+            auto self = getSelf();
+            auto stored = std::make_shared<bool>(false);
+            Future<Balances> reconciliation = Future<Balances>::successful(Balances());
+            {
+                std::lock_guard<std::mutex> lock(_erc20BalancesLock);
+                if (_erc20BalancesReconciliation.hasValue()) {
+                    return _erc20BalancesReconciliation.getValue();
+                }
+                if (!contractAddresses.empty()) {
+                    // The explorer balances are read at its own chain tip, which synchronization may not have reached
+                    // yet: storing them would count again the transfers synchronized afterwards. They only check the
+                    // balances summed from the stored transfers, which are the ones served.
+                    auto logger = self->logger();
+                    reconciliation = _explorer->getERC20Balances(_keychain->getAddress()->toEIP55(), contractAddresses)
+                            .recover(getContext(), [logger] (const Exception &exception) {
+                                logger->warn("Failed to check ERC20 balances against the explorer: {}", exception.getMessage());
+                                return std::vector<BigInt>();
+                            })
+                            .map<Balances>(getContext(), [self, erc20AccountUids, contractAddresses, stored, logger] (const std::vector<BigInt> &balances) {
+                                soci::session sql(self->getWallet()->getDatabase()->getPool());
+                                soci::transaction tr(sql);
+                                uint64_t generation = self->_erc20LedgerGeneration;
+                                Balances computed;
+                                for (size_t index = 0; index < erc20AccountUids.size(); index++) {
+                                    auto balance = EthereumLikeAccountDatabaseHelper::computeERC20AccountBalance(sql, erc20AccountUids[index]);
+                                    EthereumLikeAccountDatabaseHelper::putERC20AccountBalance(sql, erc20AccountUids[index], balance);
+                                    if (index < balances.size() && balances[index] != balance) {
+                                        logger->info("ERC20 balance of {} is {} locally and {} on the explorer, synchronization may be behind",
+                                                     contractAddresses[index], balance.toString(), balances[index].toString());
+                                    }
+                                    computed[erc20AccountUids[index]] = balance;
+                                }
+                                // Synchronization applies transfers on the ledger inside its own database transaction,
+                                // after bumping the generation. Checking once our rows are written means that any
+                                // transfer applied while we were summing is either seen here, or applied on top of
+                                // the balances we store.
+                                if (self->_erc20LedgerGeneration != generation) {
+                                    tr.rollback();
+                                    return computed;
+                                }
+                                tr.commit();
+                                *stored = true;
+                                return computed;
+                            });
+                }
+                _erc20BalancesReconciliation = reconciliation;
+            }
+            reconciliation.onComplete(getContext(), [self, stored] (const Try<Balances> &result) {
+                std::lock_guard<std::mutex> lock(self->_erc20BalancesLock);
+                self->_erc20BalancesReconciliation = Option<Future<Balances>>();
+                if (*stored) {
+                    self->_erc20BalancesReconciledAt = std::chrono::system_clock::now();
+                }
+            });
+            return reconciliation;
+        }
+
         void EthereumLikeAccount::addERC20Accounts(soci::session &sql,
                                                    const std::vector<ERC20LikeAccountDatabaseEntry> &erc20Entries) {
             auto self = std::dynamic_pointer_cast<EthereumLikeAccount>(shared_from_this());
@@ -673,6 +854,7 @@ namespace ledger {
                                                                           self->getWallet()->getCurrency(),
                                                                           self);
                 _erc20LikeAccounts.push_back(newERC20Account);
+                _erc20LikeAccountsByContract[erc20Entry.contractAddress] = newERC20Account;
             }
         }
 
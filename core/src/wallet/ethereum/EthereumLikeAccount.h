@@ -33,6 +33,9 @@
 #define LEDGER_CORE_ETHEREUMLIKEACCOUNT_H
 
 #include <time.h>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
 #include <api/AddressListCallback.hpp>
 #include <api/Address.hpp>
 #include <api/EthereumLikeAccount.hpp>
@@ -43,6 +46,7 @@
 #include <api/BigIntListCallback.hpp>
 #include <wallet/common/AbstractWallet.hpp>
 #include <wallet/common/AbstractAccount.hpp>
+#include <utils/Unit.hpp>
 #include <wallet/common/Amount.h>
 #include <wallet/ethereum/api_impl/InternalTransaction.h>
 #include <wallet/ethereum/explorers/EthereumLikeBlockchainExplorer.h>
@@ -54,8 +58,16 @@
 
 namespace ledger {
     namespace core {
+        class ERC20LikeAccount;
+        class ERC20LikeOperation;
+
         class EthereumLikeAccount : public api::EthereumLikeAccount, public AbstractAccount {
         public:
+            // ERC20 operations collected while inserting transactions. Their existence is checked with a
+            // single query and the new ones are inserted in bulk when the batch is flushed.
+            struct ERC20OperationsBatch {
+                std::vector<std::pair<std::shared_ptr<ERC20LikeAccount>, std::shared_ptr<ERC20LikeOperation>>> operations;
+            };
 
             static const int FLAG_TRANSACTION_IGNORED = 0x00;
             static const int FLAG_TRANSACTION_CREATED_SENDING_OPERATION = 0x01;
@@ -75,13 +87,20 @@ namespace ledger {
                                   const EthereumLikeBlockchainExplorerTransaction &tx);
 
             int putTransaction(soci::session& sql, const EthereumLikeBlockchainExplorerTransaction &transaction);
+            // Same as above but ERC20 operations are only written when erc20Batch is flushed, so that
+            // a synchronizer can write the ERC20 operations of a whole explorer page at once.
+            int putTransaction(soci::session& sql,
+                               const EthereumLikeBlockchainExplorerTransaction &transaction,
+                               ERC20OperationsBatch &erc20Batch);
+            void flushERC20Operations(soci::session &sql, ERC20OperationsBatch &erc20Batch);
             /// Get internal transactions related to the parent operation.
             std::vector<Operation> getInternalOperations(soci::session &sql);
 
-            void updateERC20Accounts(soci::session &sql, const Operation &operation);
+            void updateERC20Accounts(soci::session &sql, const Operation &operation, ERC20OperationsBatch &erc20Batch);
             void updateERC20Operation(soci::session &sql,
                                       const Operation &operation,
-                                      const ERC20Transaction &erc20Tx);
+                                      const ERC20Transaction &erc20Tx,
+                                      ERC20OperationsBatch &erc20Batch);
             void updateInternalTransactions(soci::session &sql, const Operation &operation);
             bool putBlock(soci::session& sql, const EthereumLikeBlockchainExplorer::Block& block);
 
@@ -127,13 +146,35 @@ namespace ledger {
             Future<std::vector<std::shared_ptr<api::BigInt>>> getERC20Balances(const std::vector<std::string> &erc20Addresses);
             void getERC20Balances(const std::vector<std::string> &erc20Addresses, const std::shared_ptr<api::BigIntListCallback> & callback) override;
 
+            // Balance of an ERC20 sub-account read from the locally maintained ledger. The ledger is reconciled
+            // first when it is missing or older than ERC20_BALANCES_RECONCILIATION_INTERVAL.
+            FuturePtr<BigInt> getLocalERC20Balance(const std::string &erc20AccountUid);
+            // Sum the balances of all ERC20 sub-accounts from their stored transfers, store them on the local ledger
+            // and return them by ERC20 account uid. They are checked against a single explorer request, whose
+            // balances are only logged when they differ. Concurrent calls share the same reconciliation. The
+            // balances are not stored when synchronization changed the local ledger while they were summed.
+            Future<std::unordered_map<std::string, BigInt>> reconcileERC20Balances();
+            // Called by ERC20 sub-accounts before they apply synchronized transfers on the local ledger
+            void onERC20LedgerUpdate();
+
             void addERC20Accounts(soci::session &sql,
                                   const std::vector<ERC20LikeAccountDatabaseEntry> &erc20Entries);
 
             std::shared_ptr<api::Keychain> getAccountKeychain() override;
 
+            static const std::chrono::seconds ERC20_BALANCES_RECONCILIATION_INTERVAL;
+
+        protected:
+            // Sub-accounts created while synchronization stages its changes are only indexed once committed
+            void stageLocalChanges() override;
+            size_t markLocalChanges() override;
+            void dropLocalChanges(size_t mark) override;
+            void commitLocalChanges() override;
+            void discardLocalChanges() override;
+
         private:
             std::shared_ptr<EthereumLikeAccount> getSelf();
+            bool areERC20BalancesReconciled();
             std::shared_ptr<EthereumLikeKeychain> _keychain;
             std::string _accountAddress;
             std::shared_ptr<Preferences> _internalPreferences;
@@ -146,6 +187,14 @@ namespace ledger {
             uint64_t _currentBlockHeight;
             std::vector<ERC20LikeAccountDatabaseEntry> erc20Entries;
             std::vector<std::shared_ptr<api::ERC20LikeAccount> >_erc20LikeAccounts;
+            // Sub-accounts indexed by contract address, for lookups while ingesting transfer events
+            std::unordered_map<std::string, std::shared_ptr<ERC20LikeAccount>> _erc20LikeAccountsByContract;
+            // Sub-accounts written in the staged changes, in creation order
+            std::vector<std::shared_ptr<ERC20LikeAccount>> _stagedERC20Accounts;
+            std::mutex _erc20BalancesLock;
+            Option<Future<std::unordered_map<std::string, BigInt>>> _erc20BalancesReconciliation;
+            std::atomic<uint64_t> _erc20LedgerGeneration;
+            Option<std::chrono::system_clock::time_point> _erc20BalancesReconciledAt;
         };
     }
 }
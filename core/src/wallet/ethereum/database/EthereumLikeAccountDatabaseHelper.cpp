@@ -31,6 +31,8 @@
 
 #include "EthereumLikeAccountDatabaseHelper.h"
 #include <wallet/common/database/AccountDatabaseHelper.h>
+#include <database/BulkDatabaseHelper.hpp>
+#include <api/OperationType.hpp>
 
 using namespace soci;
 
@@ -97,5 +99,74 @@ namespace ledger {
             return erc20Token;
         }
 
+        Option<BigInt> EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(soci::session &sql,
+                                                                                  const std::string &erc20AccountUid) {
+            rowset<row> rows = (sql.prepare << "SELECT balance FROM erc20_account_balances WHERE account_uid = :uid",
+                    use(erc20AccountUid));
+            for (auto& row : rows) {
+                return Option<BigInt>(BigInt::fromHex(row.get<std::string>(0)));
+            }
+            return Option<BigInt>();
+        }
+
+        BigInt EthereumLikeAccountDatabaseHelper::computeERC20AccountBalance(soci::session &sql,
+                                                                             const std::string &erc20AccountUid) {
+            static const auto receive = api::to_string(api::OperationType::RECEIVE);
+            static const auto send = api::to_string(api::OperationType::SEND);
+            // Values are stored as hexadecimal strings, they are summed here rather than by the database
+            rowset<row> rows = (sql.prepare << "SELECT type, value FROM erc20_operations "
+                                               "WHERE account_uid = :uid AND status = 1 AND type IN (:receive, :send)",
+                    use(erc20AccountUid), use(receive), use(send));
+            BigInt credit, debit;
+            for (auto& row : rows) {
+                auto value = BigInt::fromHex(row.get<std::string>(1));
+                if (row.get<std::string>(0) == receive) {
+                    credit = credit + value;
+                } else {
+                    debit = debit + value;
+                }
+            }
+            return credit >= debit ? credit - debit : BigInt::ZERO;
+        }
+
+        void EthereumLikeAccountDatabaseHelper::putERC20AccountBalance(soci::session &sql,
+                                                                       const std::string &erc20AccountUid,
+                                                                       const BigInt &balance) {
+            auto hexBalance = balance.toHexString();
+            eraseERC20AccountBalance(sql, erc20AccountUid);
+            sql << "INSERT INTO erc20_account_balances VALUES(:uid, :balance)", use(erc20AccountUid), use(hexBalance);
+        }
+
+        void EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalance(soci::session &sql,
+                                                                         const std::string &erc20AccountUid) {
+            sql << "DELETE FROM erc20_account_balances WHERE account_uid = :uid", use(erc20AccountUid);
+        }
+
+        void EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalances(soci::session &sql,
+                                                                          const std::string &ethAccountUid) {
+            sql << "DELETE FROM erc20_account_balances WHERE account_uid IN "
+                   "(SELECT uid FROM erc20_accounts WHERE ethereum_account_uid = :uid)", use(ethAccountUid);
+        }
+
+        std::unordered_map<std::string, int32_t>
+        EthereumLikeAccountDatabaseHelper::getERC20OperationsStatuses(soci::session &sql,
+                                                                      const std::vector<std::string> &uids) {
+            std::unordered_map<std::string, int32_t> statuses;
+            size_t uidsPerQuery = BulkDatabaseHelper::MAX_BOUND_PARAMETERS;
+            for (size_t offset = 0; offset < uids.size(); offset += uidsPerQuery) {
+                auto count = std::min(uidsPerQuery, uids.size() - offset);
+                BulkDatabaseHelper::Statement statement = (sql.prepare << "SELECT uid, status FROM erc20_operations WHERE uid IN ("
+                        << BulkDatabaseHelper::placeholders(count) << ")");
+                for (size_t index = 0; index < count; index++) {
+                    statement, use(uids[offset + index]);
+                }
+                rowset<row> rows(statement);
+                for (auto& row : rows) {
+                    statuses[row.get<std::string>(0)] = row.get<int32_t>(1);
+                }
+            }
+            return statuses;
+        }
+
     }
 }
\ No newline at end of file
@@ -33,10 +33,14 @@
 #define LEDGER_CORE_ETHEREUMLIKEACCOUNTDATABASEHELPER_H
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <soci.h>
 #include <wallet/ethereum/database/EthereumLikeAccountDatabaseEntry.h>
 #include <api/ERC20Token.hpp>
+#include <math/BigInt.h>
+#include <utils/Option.hpp>
 
 namespace ledger {
     namespace core {
@@ -54,6 +58,19 @@ namespace ledger {
                                      const std::string& accountUid,
                                      EthereumLikeAccountDatabaseEntry& entry);
             static api::ERC20Token getOrCreateERC20Token(soci::session &sql, const std::string &contractAddress);
+
+            // Locally maintained balance of an ERC20 account, none if it was not computed since its last invalidation
+            static Option<BigInt> getERC20AccountBalance(soci::session &sql, const std::string &erc20AccountUid);
+            // Balance of an ERC20 account summed from its successful stored transfers
+            static BigInt computeERC20AccountBalance(soci::session &sql, const std::string &erc20AccountUid);
+            static void putERC20AccountBalance(soci::session &sql, const std::string &erc20AccountUid, const BigInt &balance);
+            static void eraseERC20AccountBalance(soci::session &sql, const std::string &erc20AccountUid);
+            static void eraseERC20AccountBalances(soci::session &sql, const std::string &ethAccountUid);
+
+            // Status of the already stored ERC20 operations among uids, with one query per
+            // BulkDatabaseHelper::MAX_BOUND_PARAMETERS uids
+            static std::unordered_map<std::string, int32_t> getERC20OperationsStatuses(soci::session &sql,
+                                                                                      const std::vector<std::string> &uids);
         };
     }
 }
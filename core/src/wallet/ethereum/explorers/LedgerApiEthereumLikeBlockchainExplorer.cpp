@@ -57,16 +57,38 @@ namespace ledger {
         }
 
         Future<std::shared_ptr<BigInt>> LedgerApiEthereumLikeBlockchainExplorer::getBalance(const std::vector<EthereumLikeKeychain::Address> &addresses) {
+            std::vector<std::string> eip55Addresses;
+            eip55Addresses.reserve(addresses.size());
+            for (const auto &address : addresses) {
+                eip55Addresses.push_back(address->toEIP55());
+            }
+            auto chunks = explorers::packAddresses(eip55Addresses);
+            auto self = shared_from_this();
+            auto budget = getConnectionBudget();
+            std::vector<std::function<Future<std::shared_ptr<BigInt>> ()>> tasks;
+            for (const auto &chunk : chunks) {
+                tasks.push_back([self, budget, chunk] () {
+                    return budget->run<std::shared_ptr<BigInt>>(self->getContext(), [self, chunk] () {
+                        return self->getBalanceChunk(chunk);
+                    });
+                });
+            }
+            if (tasks.size() == 1) {
+                return tasks.front()();
+            }
+            return executeAll(getContext(), tasks, explorers::DEFAULT_MAX_PARALLEL_REQUESTS)
+                    .mapPtr<BigInt>(getContext(), [] (const std::vector<std::shared_ptr<BigInt>> &balances) {
+                        BigInt balance;
+                        for (const auto &chunkBalance : balances) {
+                            balance = balance + *chunkBalance;
+                        }
+                        return std::make_shared<BigInt>(balance);
+                    });
+        }
 
-            std::string addressesStr;
+        Future<std::shared_ptr<BigInt>> LedgerApiEthereumLikeBlockchainExplorer::getBalanceChunk(const std::vector<std::string> &addresses) {
+            auto addressesStr = Array<std::string>(addresses).join(strings::mkString(",")).getValueOr("");
             auto size = addresses.size();
-            for (auto i = 0; i < size; i++) {
-                auto address = addresses[i];
-                addressesStr += address->toEIP55();
-                if (i < addresses.size() - 1) {
-                    addressesStr += ",";
-                }
-            }
             bool parseNumbersAsString = true;
             return _http->GET(fmt::format("/blockchain/{}/{}/addresses/{}/balance", _explorerVersion, _parameters.Identifier, addressesStr))
                     .json(parseNumbersAsString).mapPtr<BigInt>(getContext(), [addressesStr, size] (const HttpRequest::JsonResult& result) {
@@ -87,10 +109,15 @@ namespace ledger {
         }
 
         Future<std::shared_ptr<BigInt>> LedgerApiEthereumLikeBlockchainExplorer::getHelper(const std::string &url,
-                                                                                           const std::string &field) {
+                                                                                           const std::string &field,
+                                                                                           bool cacheable) {
             bool parseNumbersAsString = true;
             auto networkId = getNetworkParameters().Identifier;
-            return _http->GET(url, std::unordered_map<std::string, std::string>()).json(parseNumbersAsString).mapPtr<BigInt>(getContext(), [field, networkId] (const HttpRequest::JsonResult& result) {
+            auto request = _http->GET(url, std::unordered_map<std::string, std::string>());
+            if (cacheable) {
+                request.cacheable();
+            }
+            return request.json(parseNumbersAsString).mapPtr<BigInt>(getContext(), [field, networkId] (const HttpRequest::JsonResult& result) {
                         auto& json = *std::get<1>(result);
                         if (!json.IsObject() || !json.GetObject().HasMember(field.c_str()) || !json.GetObject()[field.c_str()].IsString()) {
                             throw make_exception(api::ErrorCode::HTTP_ERROR, fmt::format("Failed to get {} for {}", field, networkId));
@@ -100,7 +127,7 @@ namespace ledger {
         }
 
         Future<std::shared_ptr<BigInt>> LedgerApiEthereumLikeBlockchainExplorer::getGasPrice() {
-            return getHelper(fmt::format("/blockchain/{}/{}/fees", getExplorerVersion(), getNetworkParameters().Identifier), "gas_price");
+            return getHelper(fmt::format("/blockchain/{}/{}/fees", getExplorerVersion(), getNetworkParameters().Identifier), "gas_price", true);
         }
 
         Future<std::shared_ptr<BigInt>>
@@ -336,5 +363,9 @@ namespace ledger {
         std::string LedgerApiEthereumLikeBlockchainExplorer::getExplorerVersion() const {
             return _explorerVersion;
         }
+
+        std::shared_ptr<LedgerApiEthBlockchainExplorer> LedgerApiEthereumLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
     }
 }
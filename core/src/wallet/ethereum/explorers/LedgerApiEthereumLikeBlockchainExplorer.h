@@ -83,10 +83,13 @@ namespace ledger {
             std::shared_ptr<api::ExecutionContext> getExplorerContext() const override;
             api::EthereumLikeNetworkParameters getNetworkParameters() const override;
             std::string getExplorerVersion() const override;
+            std::shared_ptr<LedgerApiEthBlockchainExplorer> getSharedFromThis() override;
 
         private:
+            Future<std::shared_ptr<BigInt>> getBalanceChunk(const std::vector<std::string> &addresses);
             Future<std::shared_ptr<BigInt>> getHelper(const std::string &url,
-                                                      const std::string &field);
+                                                      const std::string &field,
+                                                      bool cacheable = false);
             api::EthereumLikeNetworkParameters _parameters;
             std::string _explorerVersion;
         };
@@ -35,6 +35,11 @@
 
 namespace ledger {
     namespace core {
+        struct EthereumSynchronizationBuddy : public EthereumBlockchainAccountSynchronizer::SynchronizationBuddy {
+            // ERC20 operations of the current explorer page
+            EthereumLikeAccount::ERC20OperationsBatch erc20Batch;
+        };
+
         EthereumLikeBlockchainExplorerAccountSynchronizer::EthereumLikeBlockchainExplorerAccountSynchronizer(const std::shared_ptr<WalletPool> &pool,
                                                                                                              const std::shared_ptr<EthereumLikeBlockchainExplorer> &explorer) :
                 DedicatedContext(pool->getDispatcher()->getThreadPoolExecutionContext("synchronizers")) {
@@ -97,7 +102,33 @@ namespace ledger {
         int EthereumLikeBlockchainExplorerAccountSynchronizer::putTransaction(soci::session &sql,
                                                                               const EthereumLikeBlockchainExplorerTransaction &transaction,
                                                                               const std::shared_ptr<AbstractBlockchainExplorerAccountSynchronizer<EthereumLikeAccount, EthereumLikeAddress, EthereumLikeKeychain, EthereumLikeBlockchainExplorer>::SynchronizationBuddy> &buddy) {
-            return buddy->account->putTransaction(sql, transaction);
+            auto &erc20Batch = std::static_pointer_cast<EthereumSynchronizationBuddy>(buddy)->erc20Batch;
+            auto batchSize = erc20Batch.operations.size();
+            try {
+                return buddy->account->putTransaction(sql, transaction, erc20Batch);
+            } catch (...) {
+                // The transaction is rolled back, so are its ERC20 operations
+                erc20Batch.operations.erase(erc20Batch.operations.begin() + batchSize, erc20Batch.operations.end());
+                throw;
+            }
+        }
+
+        void EthereumLikeBlockchainExplorerAccountSynchronizer::flushTransactionsBulk(soci::session &sql,
+                                                                                     const std::shared_ptr<SynchronizationBuddy> &buddy) {
+            // Runs inside the page ingestion transaction, the ETH transactions and their ERC20
+            // operations are committed (or rolled back) together
+            auto &erc20Batch = std::static_pointer_cast<EthereumSynchronizationBuddy>(buddy)->erc20Batch;
+            auto batch = erc20Batch;
+            buddy->account->flushERC20Operations(sql, batch);
+        }
+
+        void EthereumLikeBlockchainExplorerAccountSynchronizer::resetTransactionsBulk(const std::shared_ptr<SynchronizationBuddy> &buddy) {
+            std::static_pointer_cast<EthereumSynchronizationBuddy>(buddy)->erc20Batch.operations.clear();
+        }
+
+        std::shared_ptr<EthereumBlockchainAccountSynchronizer::SynchronizationBuddy>
+        EthereumLikeBlockchainExplorerAccountSynchronizer::makeSynchronizationBuddy() {
+            return std::make_shared<EthereumSynchronizationBuddy>();
         }
     }
 }
\ No newline at end of file
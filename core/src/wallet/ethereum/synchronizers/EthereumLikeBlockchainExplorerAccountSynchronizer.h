@@ -71,6 +71,9 @@ namespace ledger {
         protected:
             int putTransaction(soci::session &sql, const Transaction &transaction,
                                const std::shared_ptr<SynchronizationBuddy> &buddy) override;
+            void flushTransactionsBulk(soci::session &sql, const std::shared_ptr<SynchronizationBuddy> &buddy) override;
+            void resetTransactionsBulk(const std::shared_ptr<SynchronizationBuddy> &buddy) override;
+            std::shared_ptr<SynchronizationBuddy> makeSynchronizationBuddy() override;
 
         private:
             std::shared_ptr<EthereumBlockchainAccountSynchronizer> getSharedFromThis() override ;
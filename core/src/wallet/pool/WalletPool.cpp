@@ -124,6 +124,7 @@ namespace ledger {
             _threadDispatcher = dispatcher;
 
             _publisher = std::make_shared<EventPublisher>(getContext());
+            _publisher->setLogger(_logger);
 
             _threadPoolExecutionContext = _threadDispatcher->getThreadPoolExecutionContext(fmt::format("pool_{}_thread_pool", name));
         }
@@ -262,6 +263,11 @@ namespace ledger {
                 );
                 _httpClients[baseUrl] = client;
                 client->setLogger(logger());
+                if (_configuration->getBoolean(api::PoolConfiguration::ENABLE_HTTP_REQUEST_COALESCING).value_or(true)) {
+                    auto ttl = _configuration->getInt(api::PoolConfiguration::HTTP_CACHE_TTL)
+                            .value_or(api::ConfigurationDefaults::DEFAULT_HTTP_CACHE_TTL);
+                    client->setResponseCache(std::make_shared<HttpResponseCache>(std::chrono::seconds(ttl)));
+                }
                 return client;
             }
             auto client = _httpClients[baseUrl].lock();
@@ -122,6 +122,18 @@ namespace ledger {
         ApiRippleLikeBlockchainExplorer::getTransactions(const std::vector<std::string> &addresses,
                                                                Option<std::string> fromBlockHash,
                                                                Option<void *> session) {
+            auto self = shared_from_this();
+            std::function<FuturePtr<TransactionsBulk> (const std::vector<std::string> &)> fetch =
+                    [self, fromBlockHash] (const std::vector<std::string> &chunk) {
+                        return self->getTransactionsChunk(chunk, fromBlockHash);
+                    };
+            return explorers::getBatchedTransactions<TransactionsBulk>(getExplorerContext(), getConnectionBudget(),
+                                                                       addresses, fetch);
+        }
+
+        FuturePtr<RippleLikeBlockchainExplorer::TransactionsBulk>
+        ApiRippleLikeBlockchainExplorer::getTransactionsChunk(const std::vector<std::string> &addresses,
+                                                              Option<std::string> fromBlockHash) {
             auto joinedAddresses = Array<std::string>(addresses).join(strings::mkString(",")).getValueOr("");
             std::string params;
             std::unordered_map<std::string, std::string> headers;
@@ -182,5 +194,9 @@ namespace ledger {
         std::string ApiRippleLikeBlockchainExplorer::getExplorerVersion() const {
             return _explorerVersion;
         }
+
+        std::shared_ptr<LedgerApiBlockchainExplorer> ApiRippleLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
     }
 }
@@ -96,8 +96,13 @@ namespace ledger {
             api::RippleLikeNetworkParameters getNetworkParameters() const override;
 
             std::string getExplorerVersion() const override;
+            std::shared_ptr<LedgerApiBlockchainExplorer> getSharedFromThis() override;
 
         private:
+            FuturePtr<RippleLikeBlockchainExplorer::TransactionsBulk>
+            getTransactionsChunk(const std::vector<std::string> &addresses,
+                                 Option<std::string> fromBlockHash);
+
             api::RippleLikeNetworkParameters _parameters;
             std::string _explorerVersion;
         };
@@ -163,10 +163,11 @@ namespace ledger {
         }
 
         Future<void *> NodeRippleLikeBlockchainExplorer::startSession() {
-            return Future<void *>::successful(new std::string("", 0));
+            return Future<void *>::successful(new Session());
         }
 
         Future<Unit> NodeRippleLikeBlockchainExplorer::killSession(void *session) {
+            delete static_cast<Session *>(session);
             return Future<Unit>::successful(unit);
         }
 
@@ -207,27 +208,82 @@ namespace ledger {
                 throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
                                      "Can only get transactions for 1 address from Ripple Node, but got {} addresses", addresses.size());
             }
+            const auto address = addresses[0];
+            if (session.isEmpty() || session.getValue() == nullptr) {
+                return getSessionlessTransactionsPage(address, fromBlockHash);
+            }
+
+            // handle transaction pagination in the case we have a pagination marker, which happens
+            // when a getTransactions returns a TransactionsBulk containing such a marker
+            auto state = static_cast<Session *>(session.getValue());
+            std::string paginationMarker;
+            {
+                std::lock_guard<std::mutex> lock(state->lock);
+                paginationMarker = state->paginationMarkers[address];
+            }
+            return getTransactionsPage(address, paginationMarker, fromBlockHash)
+                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [state, address] (const std::shared_ptr<TransactionsBulk> &bulk) {
+                        std::lock_guard<std::mutex> lock(state->lock);
+                        if (bulk->hasNext) {
+                            state->paginationMarkers[address] = bulk->paginationMarker;
+                        } else {
+                            state->paginationMarkers.erase(address);
+                        }
+                        return bulk;
+                    });
+        }
+
+        FuturePtr<RippleLikeBlockchainExplorer::TransactionsBulk>
+        NodeRippleLikeBlockchainExplorer::getSessionlessTransactionsPage(const std::string &address,
+                                                                         const Option<std::string> &fromBlockHash) {
+            // The synchronizer asks for the next page from the block of the last transaction it got, only
+            // that call continues from the kept marker, any other one starts over from the first page
+            std::string paginationMarker;
+            {
+                std::lock_guard<std::mutex> lock(_sessionlessLock);
+                auto it = _sessionlessMarkers.find(address);
+                if (it != _sessionlessMarkers.end()) {
+                    if (it->second.first == fromBlockHash.getValueOr("")) {
+                        paginationMarker = it->second.second;
+                    }
+                    _sessionlessMarkers.erase(it);
+                }
+            }
+            auto self = shared_from_this();
+            return getTransactionsPage(address, paginationMarker, fromBlockHash)
+                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [self, address, fromBlockHash] (const std::shared_ptr<TransactionsBulk> &bulk) {
+                        if (bulk->hasNext) {
+                            auto resumeFrom = fromBlockHash.getValueOr("");
+                            if (!bulk->transactions.empty() && bulk->transactions.back().block.nonEmpty()) {
+                                resumeFrom = bulk->transactions.back().block.getValue().hash;
+                            }
+                            std::lock_guard<std::mutex> lock(self->_sessionlessLock);
+                            self->_sessionlessMarkers[address] = std::make_pair(resumeFrom, bulk->paginationMarker);
+                        }
+                        return bulk;
+                    });
+        }
 
+        FuturePtr<RippleLikeBlockchainExplorer::TransactionsBulk>
+        NodeRippleLikeBlockchainExplorer::getTransactionsPage(const std::string &address,
+                                                              const std::string &paginationMarker,
+                                                              const Option<std::string> &fromBlockHash) {
             NodeRippleLikeBodyRequest bodyRequest;
             bodyRequest.setMethod("account_tx");
-            bodyRequest.pushParameter("account", addresses[0]);
+            bodyRequest.pushParameter("account", address);
 
-            // handle transaction pagination in the case we have a pagination marker, which happens
-            // when a getTransactions returns a TransactionsBulk containing such a marker
-            if (!_paginationMarker.empty()) {
-                auto marker = strings::split(_paginationMarker, "-");
-                bodyRequest.pushPagination(marker[0], marker[1]);
+            if (!paginationMarker.empty()) {
+                auto separator = paginationMarker.find('-');
+                bodyRequest.pushPagination(paginationMarker.substr(0, separator), paginationMarker.substr(separator + 1));
             }
 
             auto requestBody = bodyRequest.getString();
             std::unordered_map<std::string, std::string> headers{{"Content-Type", "application/json"}};
 
-            auto self = shared_from_this();
-
             return _http->POST("", std::vector<uint8_t>(requestBody.begin(), requestBody.end()), headers)
                     .template json<TransactionsBulk, Exception>(
                             LedgerApiParser<TransactionsBulk, RippleLikeTransactionsBulkParser>())
-                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [self, fromBlockHash](
+                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [fromBlockHash](
                             const Either<Exception, std::shared_ptr<TransactionsBulk>> &result) {
                         if (result.isLeft()) {
                             // Only case where we should emit block not found error
@@ -236,19 +292,11 @@ namespace ledger {
                             } else {
                                 throw result.getLeft();
                             }
-                        } else {
-                            // handle pagination if a pagination marker is present
-                            auto bulk = result.getRight();
-
-                            if (!bulk->paginationMarker.empty()) {
-                                bulk->hasNext = true;
-                                self->_paginationMarker = bulk->paginationMarker;
-                            } else {
-                                self->_paginationMarker = "";
-                            }
-
-                            return bulk;
                         }
+                        // the marker is carried by the bulk, callers decide where to keep it
+                        auto bulk = result.getRight();
+                        bulk->hasNext = !bulk->paginationMarker.empty();
+                        return bulk;
                     });
         }
 
@@ -291,6 +339,10 @@ namespace ledger {
             return "";
         }
 
+        std::shared_ptr<LedgerApiBlockchainExplorer> NodeRippleLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
+
 
         Future<std::shared_ptr<BigInt>>
         NodeRippleLikeBlockchainExplorer::getAccountInfo(const std::string &address,
@@ -39,6 +39,8 @@
 #include <wallet/ripple/explorers/api/RippleLikeTransactionsBulkParser.h>
 #include <wallet/ripple/explorers/api/RippleLikeBlockParser.h>
 #include <api/RippleLikeNetworkParameters.hpp>
+#include <mutex>
+#include <unordered_map>
 
 namespace ledger {
     namespace core {
@@ -194,15 +196,36 @@ namespace ledger {
             api::RippleLikeNetworkParameters getNetworkParameters() const override;
 
             std::string getExplorerVersion() const override;
+            std::shared_ptr<LedgerApiBlockchainExplorer> getSharedFromThis() override;
 
         private:
+            // account_tx markers of one synchronization, the explorer itself holds no paging state so that
+            // several accounts can page through it concurrently
+            struct Session {
+                std::mutex lock;
+                std::unordered_map<std::string, std::string> paginationMarkers;
+            };
+
             Future<std::shared_ptr<BigInt>>
             getAccountInfo(const std::string &address,
                            const std::string &key,
                            const BigInt &defaultValue);
 
+            // One account_tx page, starting at the given marker ("ledger-seq") when not empty
+            FuturePtr<TransactionsBulk>
+            getTransactionsPage(const std::string &address,
+                                const std::string &paginationMarker,
+                                const Option<std::string> &fromBlockHash);
+
+            // Without a session, the marker of an address is kept along the block its next page is requested from
+            FuturePtr<TransactionsBulk>
+            getSessionlessTransactionsPage(const std::string &address,
+                                           const Option<std::string> &fromBlockHash);
+
             api::RippleLikeNetworkParameters _parameters;
-            std::string _paginationMarker;
+            std::mutex _sessionlessLock;
+            // address -> (block hash of the last transaction of the previous page, marker of the next one)
+            std::unordered_map<std::string, std::pair<std::string, std::string>> _sessionlessMarkers;
         };
     }
 }
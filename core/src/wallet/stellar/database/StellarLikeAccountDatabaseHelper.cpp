@@ -165,5 +165,28 @@ namespace ledger {
             }
         }
 
+        Option<std::string> StellarLikeAccountDatabaseHelper::getTransactionPagingToken(soci::session &sql,
+                                                                                        const std::string &accountUid) {
+            rowset<row> rows = (sql.prepare <<
+                    "SELECT transaction_paging_token FROM stellar_account_sync_states WHERE account_uid = :uid",
+                    use(accountUid));
+            for (const auto& row : rows) {
+                return Option<std::string>(row.get<std::string>(0));
+            }
+            return Option<std::string>();
+        }
+
+        void StellarLikeAccountDatabaseHelper::putTransactionPagingToken(soci::session &sql,
+                                                                         const std::string &accountUid,
+                                                                         const std::string &pagingToken) {
+            eraseTransactionPagingToken(sql, accountUid);
+            sql << "INSERT INTO stellar_account_sync_states VALUES (:uid, :token)", use(accountUid), use(pagingToken);
+        }
+
+        void StellarLikeAccountDatabaseHelper::eraseTransactionPagingToken(soci::session &sql,
+                                                                           const std::string &accountUid) {
+            sql << "DELETE FROM stellar_account_sync_states WHERE account_uid = :uid", use(accountUid);
+        }
+
     }
-}
\ No newline at end of file
+}
@@ -34,6 +34,7 @@
 
 #include <wallet/stellar/stellar.hpp>
 #include <soci.h>
+#include <utils/Option.hpp>
 
 namespace ledger {
     namespace core {
@@ -51,6 +52,10 @@ namespace ledger {
             static bool putAccountBalance(soci::session& sql, const std::string& accountUid, const stellar::Balance& balance);
             static std::string createAccountBalanceUid(const std::string& accountUid, const std::string& assetUid);
 
+            static Option<std::string> getTransactionPagingToken(soci::session& sql, const std::string& accountUid);
+            static void putTransactionPagingToken(soci::session& sql, const std::string& accountUid, const std::string& pagingToken);
+            static void eraseTransactionPagingToken(soci::session& sql, const std::string& accountUid);
+
         };
     }
 }
@@ -42,6 +42,8 @@
 #include <utils/Exception.hpp>
 #include <math/BaseConverter.hpp>
 #include <utils/URL.h>
+#include <api/Configuration.hpp>
+#include <algorithm>
 
 namespace ledger {
     namespace core {
@@ -52,10 +54,14 @@ namespace ledger {
         using TransactionsParser = HorizonApiParser<std::vector<std::shared_ptr<stellar::Transaction>>, HorizonTransactionsParser>;
         using OperationsParser = HorizonApiParser<std::vector<std::shared_ptr<stellar::Operation>>, HorizonOperationsParser>;
 
+        const int32_t HorizonBlockchainExplorer::MAX_PAGE_SIZE;
+
         HorizonBlockchainExplorer::HorizonBlockchainExplorer(const std::shared_ptr<api::ExecutionContext>& context,
                                                              const std::shared_ptr<HttpClient>& http,
                                                              const std::shared_ptr<api::DynamicObject>& configuration)
             : StellarLikeBlockchainExplorer(context, http) {
+            auto pageSize = configuration->getInt(api::Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE).value_or(MAX_PAGE_SIZE);
+            _pageSize = std::max(1, std::min(pageSize, MAX_PAGE_SIZE));
         }
 
         Future<Option<std::shared_ptr<stellar::Asset>>> HorizonBlockchainExplorer::getAsset(const std::string& assetCode, const std::string& assetIssuer) {
@@ -75,6 +81,7 @@ namespace ledger {
 
         Future<std::shared_ptr<stellar::Ledger>> HorizonBlockchainExplorer::getLastLedger() {
             return http->GET("/ledgers?order=desc&limit=1")
+                    .cacheable()
                     .template json<LedgersParser::Result, Exception>(LedgersParser())
                     .map<std::shared_ptr<stellar::Ledger>>(getContext(), [] (const LedgersParser::Response& result) -> std::shared_ptr<stellar::Ledger> {
                         if (result.isLeft()) {
@@ -88,6 +95,7 @@ namespace ledger {
 
         FuturePtr<stellar::FeeStats> HorizonBlockchainExplorer::getRecommendedFees() {
             return http->GET("/fee_stats")
+                    .cacheable()
                     .template json<FeeStatsParser::Result, Exception>(FeeStatsParser())
                     .map<std::shared_ptr<stellar::FeeStats>>(getContext(), [] (const FeeStatsParser::Response& result) -> std::shared_ptr<stellar::FeeStats> {
                         if (result.isLeft()) {
@@ -100,7 +108,7 @@ namespace ledger {
         Future<std::vector<std::shared_ptr<stellar::Operation>>> HorizonBlockchainExplorer::getOperations(const std::string& address,
                                                               const Option<std::string>& cursor) {
             auto cursorParam = cursor.isEmpty() ? "" : fmt::format("&cursor={}", cursor.getValue());
-            return http->GET(fmt::format("/accounts/{}/operations?limit=50&order=asc{}", address, cursorParam))
+            return http->GET(fmt::format("/accounts/{}/operations?limit={}&order=asc{}", address, _pageSize, cursorParam))
                     .template json<OperationsParser::Result, Exception>(OperationsParser())
                     .map<std::vector<std::shared_ptr<stellar::Operation>>>(getContext(), [] (const OperationsParser::Response& response) -> std::vector<std::shared_ptr<stellar::Operation>> {
                         if (response.isLeft()) {
@@ -114,7 +122,7 @@ namespace ledger {
                                                                   const Option<std::string>& cursor) {
 
             auto cursorParam = cursor.isEmpty() ? "" : fmt::format("&cursor={}", cursor.getValue());
-            return http->GET(fmt::format("/accounts/{}/transactions?limit=50&order=asc{}", address, cursorParam))
+            return http->GET(fmt::format("/accounts/{}/transactions?limit={}&order=asc{}", address, _pageSize, cursorParam))
                     .template json<TransactionsParser::Result, Exception>(TransactionsParser())
                     .map<std::vector<std::shared_ptr<stellar::Transaction>>>(getContext(), [] (const TransactionsParser::Response& response) -> std::vector<std::shared_ptr<stellar::Transaction>> {
                         if (response.isLeft()) {
@@ -51,6 +51,12 @@ namespace ledger {
             Future<std::shared_ptr<stellar::Account>> getAccount(const std::string &accountId) const override;
 
             Future<std::string> postTransaction(const std::vector<uint8_t> &tx) override;
+
+            // Horizon caps the limit parameter of paginated endpoints to 200
+            static const int32_t MAX_PAGE_SIZE = 200;
+
+        private:
+            int32_t _pageSize;
         };
     }
 }
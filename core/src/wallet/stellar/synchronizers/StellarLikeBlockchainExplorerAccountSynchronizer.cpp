@@ -31,13 +31,7 @@
 
 #include "StellarLikeBlockchainExplorerAccountSynchronizer.hpp"
 #include <wallet/stellar/StellarLikeAccount.hpp>
-
-/**
- * Current version of the synchronization. Please keep this field up to date to ensure that we have proper migration
- * mechanism if the synchronizer needs to save more data in its state in the future (or modify current value). This
- * version allow smooth migration.
- */
-static const auto SYNCHRONIZATION_ALGORITHM_VERSION = 1;
+#include <wallet/stellar/database/StellarLikeAccountDatabaseHelper.hpp>
 
 namespace ledger {
     namespace core {
@@ -54,6 +48,8 @@ namespace ledger {
         void StellarLikeBlockchainExplorerAccountSynchronizer::reset(const std::shared_ptr<StellarLikeAccount> &account,
                                                                      const std::chrono::system_clock::time_point &toDate) {
             account->getInternalPreferences()->getSubPreferences("StellarLikeBlockchainExplorerAccountSynchronizer")->editor()->clear();
+            soci::session sql(_database->getPool());
+            StellarLikeAccountDatabaseHelper::eraseTransactionPagingToken(sql, account->getAccountUid());
         }
 
         std::shared_ptr<ProgressNotifier<Unit>> StellarLikeBlockchainExplorerAccountSynchronizer::synchronize(
@@ -100,15 +96,35 @@ namespace ledger {
                 const std::shared_ptr<StellarLikeAccount> &account,
                 const Option<StellarLikeBlockchainExplorerAccountSynchronizer::SavedState> &state) {
             auto address = account->getKeychain()->getAddress()->toString();
-            auto transactionCursor = state.flatMap<std::string>([] (const SavedState& s) {
-                return s.transactionPagingToken.empty() ? Option<std::string>() : Option<std::string>(s.transactionPagingToken);
-            });
+            Option<std::string> transactionCursor;
+            {
+                soci::session sql(_database->getPool());
+                transactionCursor = StellarLikeAccountDatabaseHelper::getTransactionPagingToken(sql, account->getAccountUid());
+            }
+            if (transactionCursor.isEmpty()) {
+                // Cursor saved in preferences by previous versions of the synchronizer
+                transactionCursor = state.flatMap<std::string>([] (const SavedState& s) {
+                    return s.transactionPagingToken.empty() ? Option<std::string>() : Option<std::string>(s.transactionPagingToken);
+                });
+            }
+            synchronizeTransactions(account, transactionCursor, _explorer->getTransactions(address, transactionCursor));
+        }
 
+        void StellarLikeBlockchainExplorerAccountSynchronizer::synchronizeTransactions(
+                const std::shared_ptr<StellarLikeAccount> &account,
+                const Option<std::string> &cursor,
+                Future<stellar::TransactionVector> page) {
+            auto address = account->getKeychain()->getAddress()->toString();
             auto self = shared_from_this();
-            _explorer->getTransactions(address, transactionCursor).onComplete(account->getContext(), [=] (const Try<stellar::TransactionVector>& txs) {
+            page.onComplete(account->getContext(), [=] (const Try<stellar::TransactionVector>& txs) {
                 if (txs.isFailure()) {
                     self->failSynchronization(txs.getFailure());
+                } else if (txs.getValue().empty()) {
+                    self->endSynchronization();
                 } else {
+                    auto nextCursor = Option<std::string>(txs.getValue().back()->pagingToken);
+                    // Request the next page while this one is being stored
+                    auto nextPage = self->_explorer->getTransactions(address, nextCursor);
                     {
                         soci::session sql(_database->getPool());
                         soci::transaction tr(sql);
@@ -116,18 +132,11 @@ namespace ledger {
                         for (const auto &tx : txs.getValue()) {
                             account->putTransaction(sql, *tx);
                         }
+                        // Keep the cursor in the same transaction so that it never points past stored data
+                        StellarLikeAccountDatabaseHelper::putTransactionPagingToken(sql, account->getAccountUid(), nextCursor.getValue());
                         tr.commit();
                     }
-                    if (!txs.getValue().empty()) {
-                        SavedState newState = state.getValueOr(SavedState());
-                        newState.algorithmVersion = SYNCHRONIZATION_ALGORITHM_VERSION;
-                        newState.transactionPagingToken = txs.getValue().back()->pagingToken;
-                        auto preferences = account->getInternalPreferences()->getSubPreferences("StellarLikeBlockchainExplorerAccountSynchronizer");
-                        preferences->editor()->putObject("state", newState)->commit();
-                        self->synchronizeTransactions(account, Option<SavedState>(newState));
-                    } else {
-                        self->endSynchronization();
-                    }
+                    self->synchronizeTransactions(account, nextCursor, nextPage);
                 }
             });
         }
@@ -46,8 +46,9 @@ namespace ledger {
                   public std::enable_shared_from_this<StellarLikeBlockchainExplorerAccountSynchronizer> {
         public:
             /**
-             * Save the current state of the synchronize to enable incremental update and keep current
-             * pagination cursors, to avoid synchronizing everytime the full account.
+             * State saved in preferences by previous versions of the synchronizer. The transaction paging
+             * token is now stored in database along with synchronized transactions, this state is only read
+             * to resume synchronizations started before.
              */
             struct SavedState {
                 /**
@@ -83,6 +84,9 @@ namespace ledger {
                                     const Option<SavedState>& state);
             void synchronizeTransactions(const std::shared_ptr<StellarLikeAccount>& account,
                                          const Option<SavedState>& state);
+            void synchronizeTransactions(const std::shared_ptr<StellarLikeAccount>& account,
+                                         const Option<std::string>& cursor,
+                                         Future<stellar::TransactionVector> page);
             inline void failSynchronization(const Exception& ex);
             inline void endSynchronization();
 
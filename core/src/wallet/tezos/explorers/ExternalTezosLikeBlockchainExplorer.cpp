@@ -76,6 +76,7 @@ namespace ledger {
                   "fees";
 
             return _http->GET("block/head")
+                    .cacheable()
                     .json(parseNumbersAsString).mapPtr<BigInt>(getContext(), [=](const HttpRequest::JsonResult &result) {
                         auto &json = *std::get<1>(result);
 
@@ -184,6 +185,7 @@ namespace ledger {
 
         FuturePtr<Block> ExternalTezosLikeBlockchainExplorer::getCurrentBlock() const {
             return _http->GET("block/head")
+                    .cacheable()
                     .template json<Block, Exception>(LedgerApiParser<Block, TezosLikeBlockParser>())
                     .template mapPtr<Block>(getExplorerContext(),
                                             [](const Either<Exception, std::shared_ptr<Block>> &result) {
@@ -216,6 +218,10 @@ namespace ledger {
             return "";
         }
 
+        std::shared_ptr<ExternalApiBlockchainExplorer> ExternalTezosLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
+
         Future<std::shared_ptr<BigInt>>
         ExternalTezosLikeBlockchainExplorer::getHelper(const std::string &url,
                                                        const std::string &field,
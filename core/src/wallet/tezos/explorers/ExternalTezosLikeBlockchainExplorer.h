@@ -89,6 +89,7 @@ namespace ledger {
             api::TezosLikeNetworkParameters getNetworkParameters() const override;
 
             std::string getExplorerVersion() const override;
+            std::shared_ptr<ExternalApiBlockchainExplorer> getSharedFromThis() override;
 
             Future<std::shared_ptr<BigInt>>
             getEstimatedGasLimit(const std::string &address) override;
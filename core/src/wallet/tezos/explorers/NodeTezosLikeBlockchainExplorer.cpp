@@ -33,6 +33,8 @@
 #include <api/TezosConfigurationDefaults.hpp>
 #include <api/Configuration.hpp>
 #include <rapidjson/document.h>
+#include <async/FutureUtils.hpp>
+#include <wallet/common/explorers/ExplorerRequestBatcher.hpp>
 namespace ledger {
     namespace core {
         NodeTezosLikeBlockchainExplorer::NodeTezosLikeBlockchainExplorer(
@@ -77,6 +79,7 @@ namespace ledger {
         NodeTezosLikeBlockchainExplorer::getFees() {
             bool parseNumbersAsString = true;
             return _http->GET(fmt::format("blockchain/{}/{}/head", getExplorerVersion(), getNetworkParameters().Identifier))
+                    .cacheable()
                     .json(parseNumbersAsString).mapPtr<BigInt>(getContext(), [](const HttpRequest::JsonResult &result) {
                         auto &json = *std::get<1>(result);
                         //Is there a fees field ?
@@ -112,10 +115,11 @@ namespace ledger {
         }
 
         Future<void *> NodeTezosLikeBlockchainExplorer::startSession() {
-            return Future<void *>::successful(new std::string("", 0));
+            return Future<void *>::successful(new Session());
         }
 
         Future<Unit> NodeTezosLikeBlockchainExplorer::killSession(void *session) {
+            delete static_cast<Session *>(session);
             return Future<Unit>::successful(unit);
         }
 
@@ -136,44 +140,94 @@ namespace ledger {
                 throw make_exception(api::ErrorCode::INVALID_ARGUMENT,
                                      "Can only get transactions for 1 address from Tezos Node, but got {} addresses", addresses.size());
             }
-            std::string params;
-            if (fromBlockHash.hasValue()) {
-                params = "&block_hash=" + fromBlockHash.getValue();
-            }
-            auto self = shared_from_this();
-            using EitherTransactionsBulk = Either<Exception, std::shared_ptr<TransactionsBulk>>;
-            static std::vector<std::string> txTypes {"Transaction", "Reveal", "Origination", "Delegation"};
             // Note: we should get rid of this if we tweak explorer
             // to have all type of operations at once
-            static std::function<FuturePtr<TransactionsBulk> (const std::string address,
-                                                              const std::string &params,
-                                                              const std::shared_ptr<TransactionsBulk> &txsBulk,
-                                                              size_t type)> getTransactionsOfType = [self] (const std::string &address,
-                                                                                                            const std::string &parameters,
-                                                                                                            const std::shared_ptr<TransactionsBulk> &txsBulk,
-                                                                                                            size_t type) -> FuturePtr<TransactionsBulk> {
-                return self->_http->GET(fmt::format("blockchain/{}/{}/operations/{}?type={}{}", self->getExplorerVersion(), self->getNetworkParameters().Identifier, address, txTypes[type], parameters))
-                        .template json<TransactionsBulk, Exception>(LedgerApiParser<TransactionsBulk, TezosLikeTransactionsBulkParser>())
-                        .template flatMapPtr<TransactionsBulk>(self->getExplorerContext(), [=](const EitherTransactionsBulk &result) {
-                            if (result.isLeft()) {
-                                throw result.getLeft();
-                            } else {
-                                txsBulk->transactions.insert(txsBulk->transactions.end(), result.getRight()->transactions.begin(), result.getRight()->transactions.end());
-                                // Only originated accounts can delegate
-                                auto isOriginated = address.find("KT") == 0;
-                                if (type == txTypes.size() - 1 || (type == txTypes.size() - 2 && !isOriginated)) {
-                                    return FuturePtr<TransactionsBulk>::successful(txsBulk);
-                                }
-                                return getTransactionsOfType(address, parameters, txsBulk, type + 1);
+            static const std::vector<std::string> txTypes {"Transaction", "Reveal", "Origination", "Delegation"};
+            const auto address = addresses[0];
+            // Only originated accounts can delegate
+            auto isOriginated = address.find("KT") == 0;
+            auto typesCount = isOriginated ? txTypes.size() : txTypes.size() - 1;
+
+            // Types are fetched concurrently, each one paginates on its own: the merged bulk resumes from the
+            // lowest block a truncated type reached, but within a session the next page asks every type from
+            // its own last block, and no more the types which had no next page. Without a session, or when
+            // asked from another block, every type starts from fromBlockHash.
+            std::unordered_map<std::string, std::string> fromBlocks;
+            for (size_t type = 0; type < typesCount; type++) {
+                fromBlocks[txTypes[type]] = fromBlockHash.getValueOr("");
+            }
+            auto state = session.nonEmpty() ? static_cast<Session *>(session.getValue()) : nullptr;
+            if (state != nullptr) {
+                std::lock_guard<std::mutex> lock(state->lock);
+                auto it = state->cursors.find(address);
+                if (it != state->cursors.end()) {
+                    if (it->second.resumeFrom == fromBlockHash.getValueOr("")) {
+                        fromBlocks = it->second.fromBlocks;
+                    }
+                    state->cursors.erase(it);
+                }
+            }
+
+            std::vector<std::string> types;
+            std::vector<FuturePtr<TransactionsBulk>> requests;
+            for (size_t type = 0; type < typesCount; type++) {
+                auto from = fromBlocks.find(txTypes[type]);
+                if (from != fromBlocks.end()) {
+                    types.push_back(txTypes[type]);
+                    requests.push_back(getTransactionsOfType(address, from->first, from->second));
+                }
+            }
+            return executeAll(getExplorerContext(), requests)
+                    .template map<std::shared_ptr<TransactionsBulk>>(getExplorerContext(), [state, address, types, fromBlocks, fromBlockHash] (const std::vector<std::shared_ptr<TransactionsBulk>> &bulks) {
+                        auto merged = explorers::mergeTransactionsBulks(bulks);
+                        if (state == nullptr || !merged->hasNext) {
+                            return merged;
+                        }
+                        // The block the synchronizer resumes from, see AbstractBlockchainExplorerAccountSynchronizer
+                        auto lastBlockOf = [] (const TransactionsBulk &bulk, const std::string &fallback) {
+                            if (bulk.resumeBlock.nonEmpty()) {
+                                return bulk.resumeBlock.getValue().hash;
                             }
-                        });
-            };
-            auto transactionsBulk = std::make_shared<TransactionsBulk>();
-            return getTransactionsOfType(addresses[0], params, transactionsBulk, 0);
+                            if (!bulk.transactions.empty() && bulk.transactions.back().block.nonEmpty()) {
+                                return bulk.transactions.back().block.getValue().hash;
+                            }
+                            return fallback;
+                        };
+                        TypeCursors cursors;
+                        cursors.resumeFrom = lastBlockOf(*merged, fromBlockHash.getValueOr(""));
+                        for (size_t index = 0; index < bulks.size(); index++) {
+                            if (bulks[index]->hasNext) {
+                                cursors.fromBlocks[types[index]] = lastBlockOf(*bulks[index], fromBlocks.at(types[index]));
+                            }
+                        }
+                        std::lock_guard<std::mutex> lock(state->lock);
+                        state->cursors[address] = std::move(cursors);
+                        return merged;
+                    });
+        }
+
+        FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>
+        NodeTezosLikeBlockchainExplorer::getTransactionsOfType(const std::string &address,
+                                                                const std::string &type,
+                                                                const std::string &fromBlockHash) {
+            using EitherTransactionsBulk = Either<Exception, std::shared_ptr<TransactionsBulk>>;
+            std::string params;
+            if (!fromBlockHash.empty()) {
+                params = "&block_hash=" + fromBlockHash;
+            }
+            return _http->GET(fmt::format("blockchain/{}/{}/operations/{}?type={}{}", getExplorerVersion(), getNetworkParameters().Identifier, address, type, params))
+                    .template json<TransactionsBulk, Exception>(LedgerApiParser<TransactionsBulk, TezosLikeTransactionsBulkParser>())
+                    .template mapPtr<TransactionsBulk>(getExplorerContext(), [] (const EitherTransactionsBulk &result) {
+                        if (result.isLeft()) {
+                            throw result.getLeft();
+                        }
+                        return result.getRight();
+                    });
         }
 
         FuturePtr<Block> NodeTezosLikeBlockchainExplorer::getCurrentBlock() const {
             return _http->GET(fmt::format("blockchain/{}/{}/head", getExplorerVersion(), getNetworkParameters().Identifier))
+                    .cacheable()
                     .template json<Block, Exception>(LedgerApiParser<Block, TezosLikeBlockParser>())
                     .template mapPtr<Block>(getExplorerContext(),
                                             [](const Either<Exception, std::shared_ptr<Block>> &result) {
@@ -206,6 +260,10 @@ namespace ledger {
             return _explorerVersion;
         }
 
+        std::shared_ptr<LedgerApiBlockchainExplorer> NodeTezosLikeBlockchainExplorer::getSharedFromThis() {
+            return shared_from_this();
+        }
+
         Future<std::shared_ptr<BigInt>> NodeTezosLikeBlockchainExplorer::getHelper(const std::string &url,
                                                                                    const std::string &field,
                                                                                    const std::unordered_map<std::string, std::string> &params,
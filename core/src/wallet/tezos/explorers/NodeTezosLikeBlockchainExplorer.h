@@ -38,6 +38,8 @@
 #include <wallet/tezos/explorers/api/TezosLikeTransactionsBulkParser.h>
 #include <wallet/tezos/explorers/api/TezosLikeBlockParser.h>
 #include <api/TezosLikeNetworkParameters.hpp>
+#include <mutex>
+#include <unordered_map>
 
 namespace ledger {
     namespace core {
@@ -86,6 +88,7 @@ namespace ledger {
             api::TezosLikeNetworkParameters getNetworkParameters() const override;
 
             std::string getExplorerVersion() const override;
+            std::shared_ptr<LedgerApiBlockchainExplorer> getSharedFromThis() override;
 
             Future<std::shared_ptr<BigInt>>
             getEstimatedGasLimit(const std::string &address) override;
@@ -104,6 +107,27 @@ namespace ledger {
             Future<bool> isFunded(const std::string &address) override;
 
         private:
+            // Where each operation type of an address resumes, once a page of it was returned
+            struct TypeCursors {
+                // Block hash the synchronizer asks the next page from
+                std::string resumeFrom;
+                // type -> block hash its next page starts from, types without more pages are absent
+                std::unordered_map<std::string, std::string> fromBlocks;
+            };
+
+            // Type cursors of one synchronization, the explorer itself holds no paging state so that
+            // several accounts can page through it concurrently
+            struct Session {
+                std::mutex lock;
+                std::unordered_map<std::string, TypeCursors> cursors;
+            };
+
+            // One page of operations of a type, after the block of hash fromBlockHash when not empty
+            FuturePtr<TezosLikeBlockchainExplorer::TransactionsBulk>
+            getTransactionsOfType(const std::string &address,
+                                  const std::string &type,
+                                  const std::string &fromBlockHash);
+
             /*
              * Helper to a get specific field's value from given url
              * WARNING: this is only useful for fields with an integer (decimal representation) value (with a string type)
@@ -0,0 +1,210 @@
+/*
+ *
+ * AlgorandAccountSynchronizerTests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "AlgorandTestFixtures.hpp"
+#include <wallet/algorand/AlgorandAccount.hpp>
+#include <wallet/algorand/AlgorandAccountSynchronizer.hpp>
+#include <wallet/algorand/AlgorandBlockchainExplorer.hpp>
+#include <wallet/algorand/AlgorandExplorerConstants.hpp>
+#include <wallet/algorand/AlgorandLikeCurrencies.hpp>
+#include <wallet/algorand/AlgorandNetworks.hpp>
+#include <wallet/algorand/AlgorandWallet.hpp>
+#include <wallet/algorand/AlgorandWalletFactory.hpp>
+#include <wallet/common/OperationQuery.h>
+#include <api/AccountCreationInfo.hpp>
+#include <api/HttpRequest.hpp>
+
+#include "../integration/WalletFixture.hpp"
+#include "FakeHttpClient.hpp"
+
+#include <algorithm>
+#include <set>
+
+using namespace ledger::testing::algorand;
+using namespace ledger::core::algorand;
+
+namespace {
+
+    struct IndexedTransaction {
+        std::string id;
+        uint64_t round;
+    };
+
+    std::string paymentJson(const std::string& id, uint64_t round) {
+        return fmt::format(
+            R"({{"id":"{}","tx-type":"pay","sender":"{}","fee":1000,"first-valid":{},"last-valid":{},)"
+            R"("genesis-hash":"SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI=","confirmed-round":{},"round-time":1590000000,)"
+            R"("payment-transaction":{{"receiver":"{}","amount":1,"close-amount":0}}}})",
+            id, OBELIX_ADDRESS, round, round + 1000, round, TEST_ACCOUNT_ADDRESS);
+    }
+
+    // Serves the status, block and account transactions endpoints of an indexer holding the given history.
+    // Transactions are returned from the highest round down, with a next token only when enabled.
+    std::shared_ptr<test::FakeHttpClient> fakeIndexer(uint64_t latestRound, std::vector<IndexedTransaction> history, bool withNextToken) {
+        std::stable_sort(history.begin(), history.end(), [] (const IndexedTransaction& a, const IndexedTransaction& b) {
+            return a.round > b.round;
+        });
+        auto indexer = std::make_shared<test::FakeHttpClient>();
+        indexer->route("/status", [latestRound] (const std::shared_ptr<api::HttpRequest>&) {
+            return Option<std::string>(fmt::format(R"({{"last-round":{}}})", latestRound));
+        });
+        indexer->route("/blocks/", [latestRound] (const std::shared_ptr<api::HttpRequest>&) {
+            return Option<std::string>(fmt::format(R"({{"block":{{"rnd":{},"ts":1590000000}}}})", latestRound));
+        });
+        indexer->route("/transactions?", [latestRound, history, withNextToken] (const std::shared_ptr<api::HttpRequest>& request) {
+            const auto url = request->getUrl();
+            const auto minRound = std::stoull(test::FakeHttpClient::getQueryParameter(url, "min-round").getValueOr("0"));
+            const auto maxRound = std::stoull(test::FakeHttpClient::getQueryParameter(url, "max-round").getValueOr(std::to_string(UINT64_MAX)));
+            const auto offset = std::stoull(test::FakeHttpClient::getQueryParameter(url, "next").getValueOr("0"));
+
+            std::vector<IndexedTransaction> matching;
+            std::copy_if(history.begin(), history.end(), std::back_inserter(matching), [=] (const IndexedTransaction& tx) {
+                return tx.round >= minRound && tx.round <= maxRound;
+            });
+
+            std::string transactions;
+            const auto end = std::min<uint64_t>(matching.size(), offset + constants::EXPLORER_QUERY_LIMIT);
+            for (auto index = offset; index < end; index++) {
+                transactions += (index == offset ? "" : ",") + paymentJson(matching[index].id, matching[index].round);
+            }
+            const auto nextToken = withNextToken && end < matching.size() ? fmt::format(R"("next-token":"{}",)", end) : "";
+            return Option<std::string>(fmt::format(R"({{"current-round":{},{}"transactions":[{}]}})", latestRound, nextToken, transactions));
+        });
+        return indexer;
+    }
+
+    // Several transactions per round, so that pages end in the middle of a round
+    std::vector<IndexedTransaction> historyOf(uint64_t lowestRound, uint64_t count, uint64_t perRound) {
+        std::vector<IndexedTransaction> history;
+        for (uint64_t index = 0; index < count; index++) {
+            const auto round = lowestRound + index / perRound;
+            history.push_back({fmt::format("TX-{}-{}", round, index % perRound), round});
+        }
+        return history;
+    }
+
+} // namespace
+
+class AlgorandAccountSynchronizerTest : public WalletFixture<WalletFactory> {
+public:
+    void SetUp() override {
+        WalletFixture::SetUp();
+        registerCurrency(currencies::ALGORAND);
+
+        auto configuration = DynamicObject::newInstance();
+        wallet = std::dynamic_pointer_cast<Wallet>(wait(pool->createWallet("algorand", currencies::ALGORAND.name, configuration)));
+        account = createAlgorandAccount(wallet, 0, api::AccountCreationInfo(0, {}, {}, { Address::toPublicKey(OBELIX_ADDRESS) }, {}));
+    }
+
+    void TearDown() override {
+        account.reset();
+        wallet.reset();
+        WalletFixture::TearDown();
+    }
+
+    Future<Unit> synchronize(const std::shared_ptr<test::FakeHttpClient>& indexer) {
+        auto context = dispatcher->getSerialExecutionContext("algorand-explorer");
+        auto explorer = std::make_shared<BlockchainExplorer>(
+                context,
+                std::make_shared<HttpClient>("http://fake-indexer", indexer, context),
+                networks::getAlgorandNetworkParameters(currencies::ALGORAND.name),
+                DynamicObject::newInstance());
+        synchronizer = std::make_shared<AccountSynchronizer>(pool, explorer);
+        return synchronizer->synchronizeAccount(account)->getFuture();
+    }
+
+    std::vector<std::shared_ptr<api::Operation>> operations() {
+        return wait(std::dynamic_pointer_cast<OperationQuery>(account->queryOperations()->complete())->execute());
+    }
+
+    uint64_t savedRound() {
+        auto preferences = account->getInternalPreferences()->getSubPreferences("AlgorandAccountSynchronizer");
+        return preferences->template getObject<SavedState>("state").getValue().round;
+    }
+
+    std::shared_ptr<Wallet> wallet;
+    std::shared_ptr<Account> account;
+    std::shared_ptr<AccountSynchronizer> synchronizer;
+};
+
+TEST_F(AlgorandAccountSynchronizerTest, WindowsStoreEveryTransactionOnce) {
+    // Two million rounds are split into four windows of 500001 rounds, each holding 130 transactions,
+    // three per round: the second page of a window starts again at the round the first one ended in
+    const uint64_t windowSize = 500001;
+    std::vector<IndexedTransaction> history;
+    for (uint64_t window = 0; window < 4; window++) {
+        const auto transactions = historyOf(window * windowSize + 10, 130, 3);
+        history.insert(history.end(), transactions.begin(), transactions.end());
+    }
+    auto indexer = fakeIndexer(2000000, history, false);
+
+    wait(synchronize(indexer));
+
+    EXPECT_EQ(operations().size(), history.size());
+    EXPECT_EQ(savedRound(), history.back().round);
+
+    std::set<std::string> lowestRounds;
+    auto pages = 0;
+    for (const auto& url : indexer->getUrls()) {
+        auto minRound = test::FakeHttpClient::getQueryParameter(url, "min-round");
+        if (minRound.nonEmpty()) {
+            lowestRounds.insert(minRound.getValue());
+            pages += 1;
+        }
+    }
+    EXPECT_EQ(lowestRounds, std::set<std::string>({"0", "500001", "1000002", "1500003"}));
+    // Each window is read in two pages, the second one ends the walk as it is not full
+    EXPECT_EQ(pages, 8);
+}
+
+TEST_F(AlgorandAccountSynchronizerTest, RoundLargerThanAPageFollowsNextToken) {
+    const auto history = historyOf(500, 250, 250);
+    auto indexer = fakeIndexer(1000, history, true);
+
+    wait(synchronize(indexer));
+
+    EXPECT_EQ(operations().size(), 250);
+    EXPECT_EQ(savedRound(), 500);
+    const auto urls = indexer->getUrls();
+    EXPECT_EQ(std::count_if(urls.begin(), urls.end(), [] (const std::string& url) {
+        return url.find("&next=") != std::string::npos;
+    }), 2);
+}
+
+TEST_F(AlgorandAccountSynchronizerTest, RoundLargerThanAPageWithoutNextTokenFails) {
+    auto indexer = fakeIndexer(1000, historyOf(500, 250, 250), false);
+
+    EXPECT_THROW(wait(synchronize(indexer)), Exception);
+
+    // Nothing is stored and the next synchronization starts from the same round
+    EXPECT_EQ(operations().size(), 0);
+    EXPECT_EQ(savedRound(), 0);
+}
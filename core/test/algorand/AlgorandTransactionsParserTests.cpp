@@ -0,0 +1,109 @@
+/*
+ *
+ * AlgorandTransactionsParserTests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "AlgorandTestFixtures.hpp"
+#include <wallet/algorand/AlgorandTransactionsBulkParser.hpp>
+
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <gtest/gtest.h>
+
+using namespace ledger::testing::algorand;
+
+namespace {
+
+    std::string paymentJson(const std::string & id, uint64_t round, uint64_t amount) {
+        return fmt::format(
+            R"({{"id":"{}","tx-type":"pay","sender":"{}","fee":1000,"first-valid":{},"last-valid":{},)"
+            R"("genesis-hash":"SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI=","confirmed-round":{},"round-time":1590000000,)"
+            R"("signature":{{"sig":"abc"}},"payment-transaction":{{"receiver":"{}","amount":{},"close-amount":0}}}})",
+            id, OBELIX_ADDRESS, round - 10, round + 990, round, TEST_ACCOUNT_ADDRESS, amount);
+    }
+
+    ledger::core::Either<ledger::core::Exception, std::shared_ptr<model::TransactionsBulk>> parse(const std::string & json) {
+        TransactionsBulkParser parser;
+        rapidjson::StringStream stream(json.c_str());
+        rapidjson::Reader reader;
+        reader.Parse<rapidjson::ParseFlag::kParseNumbersAsStringsFlag>(stream, parser);
+        return parser.build();
+    }
+
+} // namespace
+
+TEST(AlgorandTransactionsBulkParser, ParsesEveryTransaction) {
+    const auto json = fmt::format(
+        R"({{"current-round":8000000,"next-token":"abc","other":[{{"id":"ignored"}}],"transactions":[{},{}]}})",
+        paymentJson("TX1", 7000000, 42), paymentJson("TX2", 6999999, 18446744073709551615ULL));
+    auto result = parse(json);
+    ASSERT_TRUE(result.isRight());
+    const auto& txs = result.getRight()->transactions;
+    ASSERT_EQ(txs.size(), 2);
+    EXPECT_FALSE(result.getRight()->hasNext);
+    EXPECT_EQ(result.getRight()->nextToken.getValueOr(""), "abc");
+
+    EXPECT_EQ(txs[0].header.id.getValue(), "TX1");
+    EXPECT_EQ(txs[0].header.round.getValue(), 7000000);
+    EXPECT_EQ(txs[0].header.fee, 1000);
+    EXPECT_EQ(txs[0].header.sender.toString(), OBELIX_ADDRESS);
+    EXPECT_EQ(boost::get<model::PaymentTxnFields>(txs[0].details).amount, 42);
+    EXPECT_EQ(boost::get<model::PaymentTxnFields>(txs[0].details).receiverAddr.toString(), TEST_ACCOUNT_ADDRESS);
+
+    EXPECT_EQ(txs[1].header.id.getValue(), "TX2");
+    EXPECT_EQ(boost::get<model::PaymentTxnFields>(txs[1].details).amount, 18446744073709551615ULL);
+}
+
+TEST(AlgorandTransactionsBulkParser, FailsWithoutTransactions) {
+    auto result = parse(R"({"current-round":8000000})");
+    EXPECT_TRUE(result.isLeft());
+}
+
+TEST(AlgorandTransactionsBulkParser, FullPageHasNext) {
+    std::string transactions;
+    for (auto i = 0; i < constants::EXPLORER_QUERY_LIMIT; i++) {
+        transactions += (i == 0 ? "" : ",") + paymentJson(fmt::format("TX{}", i), 7000000 - i, 1);
+    }
+    auto result = parse(fmt::format(R"({{"transactions":[{}]}})", transactions));
+    ASSERT_TRUE(result.isRight());
+    EXPECT_EQ(result.getRight()->transactions.size(), constants::EXPLORER_QUERY_LIMIT);
+    EXPECT_TRUE(result.getRight()->hasNext);
+}
+
+TEST(AlgorandTransactionsBulkParser, FailsOnTruncatedPayload) {
+    const auto json = fmt::format(R"({{"transactions":[{},{}]}})",
+        paymentJson("TX1", 7000000, 42), paymentJson("TX2", 6999999, 1));
+
+    // Cut after the first transaction, then inside the closing brackets
+    EXPECT_TRUE(parse(json.substr(0, json.find(paymentJson("TX2", 6999999, 1)))).isLeft());
+    EXPECT_TRUE(parse(json.substr(0, json.size() - 2)).isLeft());
+    EXPECT_TRUE(parse(json.substr(0, json.size() - 1)).isLeft());
+    EXPECT_TRUE(parse(json).isRight());
+}
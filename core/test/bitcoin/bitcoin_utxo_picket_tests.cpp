@@ -5,8 +5,12 @@
 #include <ledger/core/api/Networks.hpp>
 #include <wallet/currencies.hpp>
 #include <wallet/common/Amount.h>
+#include <async/Promise.hpp>
 #include <wallet/bitcoin/transaction_builders/BitcoinLikeStrategyUtxoPicker.h>
 #include <spdlog/sinks/null_sink.h>
+#include <chrono>
+#include <iostream>
+#include <random>
 
 
 using namespace ledger::core;
@@ -95,12 +99,16 @@ std::vector<BitcoinLikeUtxo> createUtxos(const std::vector<int64_t>& values) {
     return utxos;
 }
 
-std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> createBuddy(int64_t feesPerByte, int64_t outputAmount, const api::Currency& currency) {
+std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> createBuddy(int64_t feesPerByte, int64_t outputAmount, const api::Currency& currency,
+                                                          const Option<std::chrono::milliseconds>& selectionTimeBudget = Option<std::chrono::milliseconds>(),
+                                                          const std::shared_ptr<BitcoinLikeUtxoSource>& utxoSource = nullptr,
+                                                          api::BitcoinLikePickingStrategy strategy = api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE) {
     BitcoinLikeTransactionBuildRequest r(std::make_shared<BigInt>(0));
     r.wipe = false;
+    r.selectionTimeBudget = selectionTimeBudget;
     r.feePerByte = std::make_shared<BigInt>(feesPerByte);
     r.outputs.push_back(std::make_tuple(std::make_shared<BigInt>(outputAmount), std::make_shared<MockBitcoinLikeScript>()));
-    r.utxoPicker = std::make_tuple(api::BitcoinLikePickingStrategy::OPTIMIZE_SIZE, 0);
+    r.utxoPicker = std::make_tuple(strategy, 0);
 
     BitcoinLikeGetUtxoFunction g;
     BitcoinLikeGetTxFunction tx;
@@ -111,9 +119,57 @@ std::shared_ptr<BitcoinLikeUtxoPicker::Buddy> createBuddy(int64_t feesPerByte, i
     std::shared_ptr<MockKeychain> k = std::make_shared<MockKeychain>(config, currency, 0, preferences);
     static std::shared_ptr<spdlog::logger> l = spdlog::null_logger_mt("null_sink");
     std::shared_ptr<BitcoinLikeTransactionApi> t;
-    return std::make_shared<BitcoinLikeUtxoPicker::Buddy>(r, g, tx, e, k, l, t, false);
+    return std::make_shared<BitcoinLikeUtxoPicker::Buddy>(r, g, tx, e, k, l, t, false, utxoSource);
 }
 
+class InMemoryUtxoSource : public BitcoinLikeUtxoSource {
+public:
+    explicit InMemoryUtxoSource(const std::vector<int64_t>& values) {
+        for (size_t i = 0; i < values.size(); i++) {
+            BitcoinLikeUtxoRow row;
+            auto index = std::to_string(i);
+            row.transactionHash.fill('0');
+            std::copy(index.rbegin(), index.rend(), row.transactionHash.rbegin());
+            row.outputIndex = 0;
+            row.value = values[i];
+            row.blockHeight = values.size() - i;
+            _rows.push_back(row);
+        }
+    }
+
+    void stream(BitcoinLikeUtxoOrder order, const std::function<bool(const BitcoinLikeUtxoRow&)>& visitor) override {
+        auto rows = _rows;
+        std::sort(rows.begin(), rows.end(), [=] (auto const &lhs, auto const &rhs) {
+            switch (order) {
+                case BitcoinLikeUtxoOrder::LARGEST_FIRST: return lhs.value > rhs.value;
+                case BitcoinLikeUtxoOrder::SMALLEST_FIRST: return lhs.value < rhs.value;
+                default: return lhs.blockHeight < rhs.blockHeight;
+            }
+        });
+        for (auto const &row : rows) {
+            visited += 1;
+            if (!visitor(row)) {
+                break;
+            }
+        }
+    }
+
+    std::vector<BitcoinLikeUtxo> resolve(const std::vector<BitcoinLikeUtxoRow>& rows) override {
+        std::vector<int64_t> values;
+        for (auto const &row : rows) {
+            values.push_back(row.value);
+        }
+        resolved += rows.size();
+        return createUtxos(values);
+    }
+
+    size_t visited = 0;
+    size_t resolved = 0;
+
+private:
+    std::vector<BitcoinLikeUtxoRow> _rows;
+};
+
 TEST(OptimizeSize, BacktrackingCalculateChangeCorrectly) {
     const api::Currency currency = currencies::BITCOIN;
     const int64_t feesPerByte = 20;
@@ -185,3 +241,119 @@ TEST(OptimizeSize, ApproximationShouldTookEnough) {
     if (buddy->changeAmount.toInt64() != 0)
         EXPECT_GE(buddy->changeAmount.toInt64(), inputSizeInBytes * feesPerByte);
 }
+
+namespace {
+    // Consolidation-heavy wallet: a lot of small utxos and a few large ones
+    std::vector<int64_t> createLargeWalletAmounts(size_t count) {
+        std::mt19937_64 generator(42);
+        std::uniform_int_distribution<int64_t> small(5000, 50000);
+        std::uniform_int_distribution<int64_t> large(1000000, 5000000);
+        std::vector<int64_t> amounts(count);
+        for (size_t i = 0; i < count; i++) {
+            amounts[i] = i % 500 == 0 ? large(generator) : small(generator);
+        }
+        return amounts;
+    }
+
+    void checkSelection(const std::shared_ptr<BitcoinLikeUtxoPicker::Buddy>& buddy,
+                        const std::vector<BitcoinLikeUtxo>& pickedUtxos,
+                        int64_t feesPerByte, int64_t outputAmount) {
+        const int64_t inputSizeInBytes = 148;
+        const int64_t outputSizeInBytes = 34;
+        const int64_t emtyTransactionSizeInBytes = 10;
+        ASSERT_FALSE(pickedUtxos.empty());
+        int64_t totalInputsValue = 0;
+        for (auto utxo : pickedUtxos) {
+            totalInputsValue += utxo.value.toLong();
+        }
+        int64_t transactionFees = totalInputsValue - buddy->changeAmount.toInt64() - outputAmount;
+        int64_t minimumRequiredFees = (emtyTransactionSizeInBytes + outputSizeInBytes * 2 + inputSizeInBytes * pickedUtxos.size()) * feesPerByte;
+        EXPECT_GE(transactionFees, minimumRequiredFees);
+    }
+
+    template <typename Function>
+    long long measure(Function f) {
+        auto start = std::chrono::high_resolution_clock::now();
+        f();
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start).count();
+    }
+}
+
+TEST(OptimizeSize, BenchmarkLargeWallet) {
+    const api::Currency currency = currencies::BITCOIN;
+    const int64_t feesPerByte = 20;
+    const int64_t outputAmount = 3500000;
+    auto utxos = createUtxos(createLargeWalletAmounts(20000));
+
+    std::vector<BitcoinLikeUtxo> branchAndBound, knapsack;
+    auto branchAndBoundBuddy = createBuddy(feesPerByte, outputAmount, currency);
+    auto branchAndBoundTime = measure([&] () {
+        branchAndBound = BitcoinLikeStrategyUtxoPicker::filterWithOptimizeSize(branchAndBoundBuddy, utxos, BigInt(-1), currency);
+    });
+    auto knapsackBuddy = createBuddy(feesPerByte, outputAmount, currency);
+    auto knapsackTime = measure([&] () {
+        knapsack = BitcoinLikeStrategyUtxoPicker::filterWithKnapsackSolver(knapsackBuddy, utxos, BigInt(-1), currency);
+    });
+
+    checkSelection(branchAndBoundBuddy, branchAndBound, feesPerByte, outputAmount);
+    checkSelection(knapsackBuddy, knapsack, feesPerByte, outputAmount);
+    std::cout << utxos.size() << " utxos" << std::endl
+              << "  optimize size: " << branchAndBoundTime << "us, " << branchAndBound.size() << " inputs" << std::endl
+              << "  knapsack: " << knapsackTime << "us, " << knapsack.size() << " inputs" << std::endl;
+}
+
+TEST(OptimizeSize, TimeBudgetStillSelectsEnough) {
+    const api::Currency currency = currencies::BITCOIN;
+    const int64_t feesPerByte = 20;
+    const int64_t outputAmount = 3500000;
+    auto utxos = createUtxos(createLargeWalletAmounts(10000));
+
+    auto buddy = createBuddy(feesPerByte, outputAmount, currency, Option<std::chrono::milliseconds>(std::chrono::milliseconds(0)));
+    auto pickedUtxos = BitcoinLikeStrategyUtxoPicker::filterWithOptimizeSize(buddy, utxos, BigInt(-1), currency);
+    checkSelection(buddy, pickedUtxos, feesPerByte, outputAmount);
+}
+
+TEST(OptimizeSize, BuilderForwardsTimeBudget) {
+    Option<std::chrono::milliseconds> forwarded;
+    BitcoinLikeTransactionBuildFunction build = [&] (const BitcoinLikeTransactionBuildRequest& request) {
+        forwarded = request.selectionTimeBudget;
+        return Future<std::shared_ptr<api::BitcoinLikeTransaction>>::failure(
+                make_exception(api::ErrorCode::IMPLEMENTATION_IS_MISSING, "Only the request is checked"));
+    };
+    static std::shared_ptr<spdlog::logger> logger = spdlog::null_logger_mt("builder_null_sink");
+
+    BitcoinLikeTransactionBuilder(nullptr, currencies::BITCOIN, logger, build).build();
+    EXPECT_TRUE(forwarded.isEmpty());
+
+    BitcoinLikeTransactionBuilder(nullptr, currencies::BITCOIN, logger, build,
+                                  Option<std::chrono::milliseconds>(std::chrono::milliseconds(250))).build();
+    ASSERT_TRUE(forwarded.nonEmpty());
+    EXPECT_EQ(forwarded.getValue().count(), 250);
+}
+
+TEST(UtxoSource, DeepFirstStopsStreamingWhenEnough) {
+    const api::Currency currency = currencies::BITCOIN;
+    const int64_t feesPerByte = 20;
+    const int64_t outputAmount = 3500000;
+    auto source = std::make_shared<InMemoryUtxoSource>(createLargeWalletAmounts(10000));
+    auto buddy = createBuddy(feesPerByte, outputAmount, currency, Option<std::chrono::milliseconds>(), source,
+                             api::BitcoinLikePickingStrategy::DEEP_OUTPUTS_FIRST);
+
+    auto pickedUtxos = BitcoinLikeStrategyUtxoPicker::filterWithSource(buddy, BigInt(-1), currency);
+    checkSelection(buddy, pickedUtxos, feesPerByte, outputAmount);
+    EXPECT_LT(source->visited, 10000);
+    EXPECT_EQ(source->resolved, pickedUtxos.size());
+}
+
+TEST(UtxoSource, OptimizeSizeResolvesOnlySelection) {
+    const api::Currency currency = currencies::BITCOIN;
+    const int64_t feesPerByte = 20;
+    const int64_t outputAmount = 3500000;
+    auto source = std::make_shared<InMemoryUtxoSource>(createLargeWalletAmounts(10000));
+    auto buddy = createBuddy(feesPerByte, outputAmount, currency, Option<std::chrono::milliseconds>(), source);
+
+    auto pickedUtxos = BitcoinLikeStrategyUtxoPicker::filterWithSource(buddy, BigInt(-1), currency);
+    checkSelection(buddy, pickedUtxos, feesPerByte, outputAmount);
+    EXPECT_EQ(source->resolved, pickedUtxos.size());
+}
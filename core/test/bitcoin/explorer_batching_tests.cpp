@@ -0,0 +1,212 @@
+/*
+ *
+ * explorer_batching_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <wallet/bitcoin/explorers/BitcoinLikeBlockchainExplorer.hpp>
+#include <wallet/common/explorers/ExplorerRequestBatcher.hpp>
+#include <async/Promise.hpp>
+#include <api/ExecutionContext.hpp>
+
+using namespace ledger::core;
+using Bulk = BitcoinLikeBlockchainExplorer::TransactionsBulk;
+
+namespace {
+    BitcoinLikeBlockchainExplorerTransaction makeTransaction(const std::string& hash, Option<uint64_t> height) {
+        BitcoinLikeBlockchainExplorerTransaction tx;
+        tx.hash = hash;
+        if (height.hasValue()) {
+            BitcoinLikeBlockchainExplorer::Block block;
+            block.height = height.getValue();
+            block.hash = "block_" + std::to_string(height.getValue());
+            tx.block = block;
+        }
+        return tx;
+    }
+
+    std::shared_ptr<Bulk> makeBulk(std::vector<BitcoinLikeBlockchainExplorerTransaction> txs, bool hasNext) {
+        auto bulk = std::make_shared<Bulk>();
+        bulk->transactions = std::move(txs);
+        bulk->hasNext = hasNext;
+        return bulk;
+    }
+}
+
+TEST(ExplorerBatching, PackAddressesFitsInLength) {
+    std::vector<std::string> addresses;
+    for (auto i = 0; i < 100; i++) {
+        addresses.push_back(std::string(34, 'a' + (i % 26)));
+    }
+    auto chunks = explorers::packAddresses(addresses, 350);
+    // 10 addresses of 34 chars with 9 separators take 349 chars
+    EXPECT_EQ(chunks.size(), 10);
+    size_t total = 0;
+    for (const auto& chunk : chunks) {
+        EXPECT_LE(chunk.size() * 35 - 1, 350);
+        total += chunk.size();
+    }
+    EXPECT_EQ(total, addresses.size());
+    EXPECT_EQ(explorers::packAddresses(addresses).size(), 3);
+}
+
+TEST(ExplorerBatching, MergeWithoutNextPage) {
+    auto merged = explorers::mergeTransactionsBulks<Bulk>({
+        makeBulk({makeTransaction("a", Option<uint64_t>(10)), makeTransaction("b", Option<uint64_t>()) }, false),
+        makeBulk({makeTransaction("c", Option<uint64_t>(5)), makeTransaction("d", Option<uint64_t>(12))}, false)
+    });
+    EXPECT_FALSE(merged->hasNext);
+    ASSERT_EQ(merged->transactions.size(), 4);
+    EXPECT_EQ(merged->transactions[0].hash, "c");
+    EXPECT_EQ(merged->transactions[1].hash, "a");
+    EXPECT_EQ(merged->transactions[2].hash, "d");
+    EXPECT_EQ(merged->transactions[3].hash, "b");
+    EXPECT_TRUE(merged->resumeBlock.isEmpty());
+}
+
+TEST(ExplorerBatching, MergeResumesFromLowestTruncatedPage) {
+    auto merged = explorers::mergeTransactionsBulks<Bulk>({
+        makeBulk({makeTransaction("a", Option<uint64_t>(10)), makeTransaction("b", Option<uint64_t>(20))}, true),
+        makeBulk({makeTransaction("c", Option<uint64_t>(5)), makeTransaction("d", Option<uint64_t>(25)), makeTransaction("e", Option<uint64_t>())}, false),
+        makeBulk({makeTransaction("f", Option<uint64_t>(15)), makeTransaction("g", Option<uint64_t>(30))}, true)
+    });
+    // The session delivered d, e and g already: they are kept, and the next page starts from block 20
+    EXPECT_TRUE(merged->hasNext);
+    ASSERT_EQ(merged->transactions.size(), 7);
+    std::vector<std::string> hashes;
+    for (const auto& tx : merged->transactions) {
+        hashes.push_back(tx.hash);
+    }
+    EXPECT_EQ(hashes, std::vector<std::string>({"c", "a", "f", "b", "d", "g", "e"}));
+    ASSERT_TRUE(merged->resumeBlock.nonEmpty());
+    EXPECT_EQ(merged->resumeBlock.getValue().height, 20);
+    EXPECT_EQ(merged->resumeBlock.getValue().hash, "block_20");
+}
+
+TEST(ExplorerBatching, BatchWithOneTruncatedChunkKeepsEveryTransaction) {
+    auto context = ImmediateExecutionContext::INSTANCE;
+    auto budget = std::make_shared<HostConnectionBudget>(4);
+    std::vector<std::string> addresses;
+    for (auto i = 0; i < 3; i++) {
+        addresses.push_back(std::string(10, 'a' + i));
+    }
+    // Only the chunk of the first address has a next page
+    std::function<FuturePtr<Bulk> (const std::vector<std::string> &)> fetch = [] (const std::vector<std::string> &chunk) {
+        auto name = chunk.front().substr(0, 1);
+        if (name == "a") {
+            return FuturePtr<Bulk>::successful(makeBulk({makeTransaction("a1", Option<uint64_t>(1)), makeTransaction("a2", Option<uint64_t>(3))}, true));
+        }
+        return FuturePtr<Bulk>::successful(makeBulk({makeTransaction(name + "1", Option<uint64_t>(2)),
+                                                     makeTransaction(name + "2", Option<uint64_t>(8)),
+                                                     makeTransaction(name + "3", Option<uint64_t>())}, false));
+    };
+    auto bulk = explorers::getBatchedTransactions<Bulk>(context, budget, addresses, fetch, 10).getValue().getValue().getValue();
+    EXPECT_TRUE(bulk->hasNext);
+    EXPECT_EQ(bulk->transactions.size(), 8);
+    ASSERT_TRUE(bulk->resumeBlock.nonEmpty());
+    EXPECT_EQ(bulk->resumeBlock.getValue().height, 3);
+    EXPECT_TRUE(bulk->transactions.back().block.isEmpty());
+}
+
+TEST(ExplorerBatching, RemoveDuplicateTransactionsKeepsFirstOccurrence) {
+    auto bulk = makeBulk({
+        makeTransaction("a", Option<uint64_t>(1)),
+        makeTransaction("b", Option<uint64_t>(2)),
+        makeTransaction("a", Option<uint64_t>(1)),
+        makeTransaction("c", Option<uint64_t>(3)),
+        makeTransaction("b", Option<uint64_t>(2))
+    }, true);
+    explorers::removeDuplicateTransactions(*bulk);
+    ASSERT_EQ(bulk->transactions.size(), 3);
+    EXPECT_EQ(bulk->transactions[0].hash, "a");
+    EXPECT_EQ(bulk->transactions[1].hash, "b");
+    EXPECT_EQ(bulk->transactions[2].hash, "c");
+    EXPECT_TRUE(bulk->hasNext);
+}
+
+TEST(ExplorerBatching, HostBudgetQueuesRequestsAboveTheLimit) {
+    auto context = ImmediateExecutionContext::INSTANCE;
+    auto budget = std::make_shared<HostConnectionBudget>(2);
+    std::vector<Promise<int>> requests(3);
+    std::vector<int> started;
+    std::vector<Future<int>> results;
+    for (auto i = 0; i < 3; i++) {
+        results.push_back(budget->run<int>(context, [&requests, &started, i] () {
+            started.push_back(i);
+            return requests[i].getFuture();
+        }));
+    }
+    EXPECT_EQ(started, std::vector<int>({0, 1}));
+    EXPECT_EQ(budget->getInFlightRequests(), 2);
+
+    requests[1].success(1);
+    EXPECT_EQ(started, std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(budget->getInFlightRequests(), 2);
+    EXPECT_EQ(results[1].getValue().getValue().getValue(), 1);
+
+    requests[0].failure(make_exception(api::ErrorCode::HTTP_ERROR, "failed"));
+    requests[2].success(2);
+    EXPECT_EQ(budget->getInFlightRequests(), 0);
+    EXPECT_TRUE(results[0].getValue().getValue().isFailure());
+    EXPECT_EQ(results[2].getValue().getValue().getValue(), 2);
+}
+
+TEST(ExplorerBatching, HostBudgetIsSharedPerHost) {
+    auto budget = HostConnectionBudget::forUrl("https://explorers.api.live.ledger.com/blockchain/v3/btc");
+    EXPECT_EQ(budget, HostConnectionBudget::forUrl("https://explorers.api.live.ledger.com"));
+    EXPECT_NE(budget, HostConnectionBudget::forUrl("https://explorers.api.vault.ledger.com/blockchain/v3/btc"));
+    EXPECT_EQ(HostConnectionBudget::getHost("http://localhost:8080/a/b"), "http://localhost:8080");
+}
+
+TEST(ExplorerBatching, ConcurrentBatchesShareTheHostBudget) {
+    auto context = ImmediateExecutionContext::INSTANCE;
+    auto budget = std::make_shared<HostConnectionBudget>(2);
+    std::vector<Promise<std::shared_ptr<Bulk>>> requests;
+    requests.reserve(8);
+    std::function<FuturePtr<Bulk> (const std::vector<std::string> &)> fetch = [&requests] (const std::vector<std::string> &chunk) {
+        requests.emplace_back();
+        return requests.back().getFuture();
+    };
+    std::vector<std::string> addresses;
+    for (auto i = 0; i < 4; i++) {
+        addresses.push_back(std::string(10, 'a' + i));
+    }
+    // Two accounts, each split in 4 chunks: without a host budget 8 requests would be in flight
+    auto first = explorers::getBatchedTransactions<Bulk>(context, budget, addresses, fetch, 10);
+    auto second = explorers::getBatchedTransactions<Bulk>(context, budget, addresses, fetch, 10);
+    EXPECT_EQ(requests.size(), 2);
+    for (size_t index = 0; index < requests.size(); index++) {
+        EXPECT_LE(budget->getInFlightRequests(), 2);
+        requests[index].success(makeBulk({makeTransaction(std::to_string(index), Option<uint64_t>(index))}, false));
+    }
+    EXPECT_EQ(requests.size(), 8);
+    EXPECT_EQ(budget->getInFlightRequests(), 0);
+    EXPECT_EQ(first.getValue().getValue().getValue()->transactions.size(), 4);
+    EXPECT_EQ(second.getValue().getValue().getValue()->transactions.size(), 4);
+}
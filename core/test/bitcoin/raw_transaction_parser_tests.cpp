@@ -0,0 +1,74 @@
+/*
+ *
+ * raw_transaction_parser_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <wallet/bitcoin/api_impl/BitcoinLikeTransactionApi.h>
+#include <wallet/bitcoin/api_impl/BitcoinLikeRawTransactionView.h>
+#include <wallet/currencies.hpp>
+#include <utils/hex.h>
+#include <SyntheticBitcoinTransactions.hpp>
+
+using namespace ledger::core;
+using namespace ledger::core::test;
+
+TEST(RawTransactionView, ParseSignedSegwitTransaction) {
+    auto signedTx = hex::toByteArray("0100000000010154302828c224cb00c797038d4cbc9e06b5a38d832e879c67de523bd714a8c37c0000000000ffffff00021027000000000000160014bd6df7f5fd8b7d0e1f8dc2873d29277162508c01e82f010000000000160014192381a610b9dda473b2dc3dc0e3e80413dc553002483045022100dc57387b377550476a04f3147d915e57e396ab5ce41f8629f0aebd0f9a472876022025920a6a9d80aa6b31aedd10dfbd16d0b2eb8e449a93b70059e0cec7ac2a40ca012102fbba978d75f5fc4e7987840b78033e0e4797c7776c070037422616e622f8e6dc00000000");
+    BitcoinLikeRawTransactionView view(currencies::BITCOIN, signedTx, 0, true);
+    EXPECT_TRUE(view.isSegwit());
+    EXPECT_EQ(view.getVersion(), 1);
+    EXPECT_EQ(view.getLockTime(), 0);
+    ASSERT_EQ(view.getInputs().size(), 1);
+    ASSERT_EQ(view.getOutputs().size(), 2);
+    EXPECT_EQ(view.getPreviousTxHash(view.getInputs()[0]), "7cc3a814d73b52de679c872e838da3b5069ebc4c8d0397c700cb24c228283054");
+    EXPECT_EQ(view.getInputs()[0].sequence, 0x00FFFFFF);
+    EXPECT_EQ(view.getInputs()[0].witnessPublicKey.size, 33);
+    EXPECT_EQ(view.getOutputs()[0].value, 10000);
+    EXPECT_EQ(view.toHexString(view.getOutputs()[1].script), "0014192381a610b9dda473b2dc3dc0e3e80413dc5530");
+    EXPECT_EQ(view.computeHash(), "c3dd55c86d02ad9d4b0e748c219fd15b79f21c6d5e38f5fe84a453a7f9e37494");
+}
+
+TEST(RawTransactionView, ConsolidationMatchesFullParse) {
+    auto rawTx = createConsolidation(50);
+    BitcoinLikeRawTransactionView view(currencies::BITCOIN, rawTx, 0, true);
+    auto tx = BitcoinLikeTransactionApi::parseRawSignedTransaction(currencies::BITCOIN, rawTx, 0);
+    auto inputs = tx->getInputs();
+    ASSERT_EQ(inputs.size(), view.getInputs().size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        EXPECT_EQ(view.getPreviousTxHash(view.getInputs()[i]), hex::toString(std::vector<uint8_t>(32, static_cast<uint8_t>(i))));
+        EXPECT_EQ(inputs[i]->getPreviousTxHash().value_or(""), view.getPreviousTxHash(view.getInputs()[i]));
+        EXPECT_EQ(inputs[i]->getPreviousOutputIndex().value_or(-1), i % 4);
+        EXPECT_EQ(inputs[i]->getScriptSig(), view.getBytes(view.getInputs()[i].scriptSig));
+    }
+    // Double SHA-256 of the serialized consolidation, computed outside of the library
+    EXPECT_EQ(view.computeHash(), "5ac05fa4bd18cdbd45967dbec2bd723fda6ef5d553cddc446f71ada7516388b3");
+    EXPECT_EQ(tx->getHash(), view.computeHash());
+    EXPECT_EQ(hex::toString(tx->serialize()), hex::toString(rawTx));
+}
@@ -31,6 +31,7 @@
 
 #include <gtest/gtest.h>
 #include <ledger/core/bytes/BytesReader.h>
+#include <memory>
 
 TEST(BytesReader, CursorTests) {
     std::vector<uint8_t> data({0xFF, 0x01, 0x10, 42, 'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', 0x12, 0x16});
@@ -107,3 +108,23 @@ TEST(BytesReader, ReadNextVarString) {
     ledger::core::BytesReader reader(data);
     EXPECT_EQ(reader.readNextVarString(), "Hello world");
 }
+
+TEST(BytesReader, ViewDoesNotCopy) {
+    std::vector<uint8_t> data({0x02, 'H', 'i', 0x2A, 0x00, 0x00, 0x00});
+    ledger::core::BytesReader reader(data.data(), data.size());
+    auto size = reader.readNextVarInt();
+    auto view = reader.readView(size);
+    EXPECT_EQ(view, data.data() + 1);
+    EXPECT_EQ(reader.readNextLeUint(), 42);
+    EXPECT_EQ(reader.hasNext(), false);
+    EXPECT_THROW(reader.readView(1), std::out_of_range);
+}
+
+TEST(BytesReader, CopiedReaderKeepsItsOwnData) {
+    auto reader = std::make_shared<ledger::core::BytesReader>(std::vector<uint8_t>({0x01, 0x02, 0x03}));
+    reader->readNextByte();
+    ledger::core::BytesReader copy(*reader);
+    reader.reset();
+    EXPECT_EQ(copy.readNextByte(), 0x02);
+    EXPECT_EQ(copy.read(1), std::vector<uint8_t>({0x03}));
+}
@@ -0,0 +1,226 @@
+/*
+ *
+ * sync_state_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "StellarFixture.hpp"
+#include <wallet/stellar/database/StellarLikeAccountDatabaseHelper.hpp>
+#include <wallet/stellar/explorers/HorizonBlockchainExplorer.hpp>
+#include <wallet/stellar/synchronizers/StellarLikeBlockchainExplorerAccountSynchronizer.hpp>
+#include <api/Configuration.hpp>
+#include <collections/DynamicObject.hpp>
+#include <FakeHttpClient.hpp>
+
+namespace {
+    // Serves scripted transaction pages keyed by cursor and records the cursors it was asked for
+    class ScriptedStellarExplorer : public StellarLikeBlockchainExplorer {
+    public:
+        ScriptedStellarExplorer(const std::shared_ptr<api::ExecutionContext>& context,
+                                const std::string& address) :
+            StellarLikeBlockchainExplorer(context, nullptr), _address(address) {}
+
+        Future<Option<std::shared_ptr<stellar::Asset>>> getAsset(const std::string& assetCode, const std::string& assetIssuer) override {
+            return Future<Option<std::shared_ptr<stellar::Asset>>>::successful(Option<std::shared_ptr<stellar::Asset>>());
+        }
+
+        Future<std::shared_ptr<stellar::Ledger>> getLastLedger() override {
+            return Future<std::shared_ptr<stellar::Ledger>>::failure(make_exception(api::ErrorCode::IMPLEMENTATION_IS_MISSING, "Not scripted"));
+        }
+
+        FuturePtr<stellar::FeeStats> getRecommendedFees() override {
+            return FuturePtr<stellar::FeeStats>::failure(make_exception(api::ErrorCode::IMPLEMENTATION_IS_MISSING, "Not scripted"));
+        }
+
+        Future<std::vector<std::shared_ptr<stellar::Operation>>> getOperations(const std::string& address, const Option<std::string>& cursor) override {
+            return Future<std::vector<std::shared_ptr<stellar::Operation>>>::successful({});
+        }
+
+        Future<std::vector<std::shared_ptr<stellar::Transaction>>> getTransactions(const std::string& address,
+                                                                                   const Option<std::string>& cursor) override {
+            auto key = cursor.getValueOr("");
+            requestedCursors.push_back(key);
+            auto it = pages.find(key);
+            if (it == pages.end()) {
+                return Future<stellar::TransactionVector>::successful({});
+            }
+            return Future<stellar::TransactionVector>::successful(it->second);
+        }
+
+        Future<std::shared_ptr<stellar::Account>> getAccount(const std::string& accountId) const override {
+            auto account = std::make_shared<stellar::Account>();
+            account->accountId = _address;
+            account->sequence = "1";
+            account->subentryCount = 0;
+            return Future<std::shared_ptr<stellar::Account>>::successful(account);
+        }
+
+        Future<std::string> postTransaction(const std::vector<uint8_t>& tx) override {
+            return Future<std::string>::failure(make_exception(api::ErrorCode::IMPLEMENTATION_IS_MISSING, "Not scripted"));
+        }
+
+        void addPage(const std::string& cursor, const std::vector<std::string>& pagingTokens) {
+            stellar::TransactionVector page;
+            for (const auto& token : pagingTokens) {
+                auto tx = std::make_shared<stellar::Transaction>();
+                tx->hash = "tx_" + token;
+                tx->pagingToken = token;
+                // Fee bump envelopes are skipped by the account, only the paging token matters here
+                tx->envelope.type = stellar::xdr::EnvelopeType::ENVELOPE_TYPE_TX_FEE_BUMP;
+                page.push_back(tx);
+            }
+            pages[cursor] = page;
+        }
+
+        std::unordered_map<std::string, stellar::TransactionVector> pages;
+        std::vector<std::string> requestedCursors;
+
+    private:
+        std::string _address;
+    };
+
+    Option<std::string> storedPagingToken(const std::shared_ptr<WalletPool>& pool, const std::string& accountUid) {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        return StellarLikeAccountDatabaseHelper::getTransactionPagingToken(sql, accountUid);
+    }
+}
+
+TEST_F(StellarFixture, SyncStatePagingTokenRoundTrip) {
+    auto pool = newPool();
+    auto wallet = newWallet(pool, "my_wallet", "stellar", api::DynamicObject::newInstance());
+    auto account = newAccount(wallet, 0, defaultAccount());
+    auto uid = account->getAccountUid();
+
+    EXPECT_TRUE(storedPagingToken(pool, uid).isEmpty());
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        StellarLikeAccountDatabaseHelper::putTransactionPagingToken(sql, uid, "1234");
+    }
+    EXPECT_EQ(storedPagingToken(pool, uid).getValue(), "1234");
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        StellarLikeAccountDatabaseHelper::putTransactionPagingToken(sql, uid, "5678");
+    }
+    EXPECT_EQ(storedPagingToken(pool, uid).getValue(), "5678");
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        StellarLikeAccountDatabaseHelper::eraseTransactionPagingToken(sql, uid);
+    }
+    EXPECT_TRUE(storedPagingToken(pool, uid).isEmpty());
+
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        StellarLikeAccountDatabaseHelper::putTransactionPagingToken(sql, uid, "1234");
+    }
+    ::wait(wallet->eraseDataSince(DateUtils::fromJSON("2000-01-01T00:00:00Z")));
+    EXPECT_TRUE(storedPagingToken(pool, uid).isEmpty());
+}
+
+TEST_F(StellarFixture, SynchronizerResumesFromStoredPagingToken) {
+    auto pool = newPool();
+    auto wallet = newWallet(pool, "my_wallet", "stellar", api::DynamicObject::newInstance());
+    auto account = newAccount(wallet, 0, defaultAccount());
+    auto address = account->getKeychain()->getAddress()->toString();
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        StellarLikeAccountDatabaseHelper::putTransactionPagingToken(sql, account->getAccountUid(), "10");
+    }
+
+    auto explorer = std::make_shared<ScriptedStellarExplorer>(dispatcher->getSerialExecutionContext("explorer"), address);
+    explorer->addPage("", {"1", "2"});
+    explorer->addPage("10", {"11", "12"});
+    explorer->addPage("12", {"13"});
+    auto synchronizer = std::make_shared<StellarLikeBlockchainExplorerAccountSynchronizer>(pool, explorer);
+    ::wait(synchronizer->synchronize(account)->getFuture());
+
+    // Each page prefetches the next one from its last paging token, until an empty page
+    EXPECT_EQ(explorer->requestedCursors, std::vector<std::string>({"10", "12", "13"}));
+    EXPECT_EQ(storedPagingToken(pool, account->getAccountUid()).getValue(), "13");
+
+    // A second run starts from the last stored token
+    explorer->requestedCursors.clear();
+    ::wait(synchronizer->synchronize(account)->getFuture());
+    EXPECT_EQ(explorer->requestedCursors, std::vector<std::string>({"13"}));
+}
+
+TEST_F(StellarFixture, SynchronizerResumesFromPreferencesCursor) {
+    auto pool = newPool();
+    auto wallet = newWallet(pool, "my_wallet", "stellar", api::DynamicObject::newInstance());
+    auto account = newAccount(wallet, 0, defaultAccount());
+    auto address = account->getKeychain()->getAddress()->toString();
+
+    // State left by synchronizers storing the cursor in preferences
+    StellarLikeBlockchainExplorerAccountSynchronizer::SavedState state;
+    state.algorithmVersion = 0;
+    state.transactionPagingToken = "10";
+    account->getInternalPreferences()
+            ->getSubPreferences("StellarLikeBlockchainExplorerAccountSynchronizer")
+            ->editor()
+            ->putObject("state", state)
+            ->commit();
+
+    auto explorer = std::make_shared<ScriptedStellarExplorer>(dispatcher->getSerialExecutionContext("explorer"), address);
+    explorer->addPage("10", {"11"});
+    auto synchronizer = std::make_shared<StellarLikeBlockchainExplorerAccountSynchronizer>(pool, explorer);
+    ::wait(synchronizer->synchronize(account)->getFuture());
+
+    EXPECT_EQ(explorer->requestedCursors, std::vector<std::string>({"10", "11"}));
+    EXPECT_EQ(storedPagingToken(pool, account->getAccountUid()).getValue(), "11");
+
+    // Once the cursor is in database, the preferences state is no longer used
+    explorer->requestedCursors.clear();
+    ::wait(synchronizer->synchronize(account)->getFuture());
+    EXPECT_EQ(explorer->requestedCursors, std::vector<std::string>({"11"}));
+}
+
+TEST_F(StellarFixture, HorizonPageSizeIsReadFromConfiguration) {
+    static const std::string BASE_URL = "http://horizon.test";
+    static const std::string EMPTY_PAGE = "{\"_embedded\":{\"records\":[]}}";
+    auto pool = newPool();
+    auto address = "GCQQQPIROIEFHIWEO2QH4KNWJYHZ5MX7RFHR4SCWFD5KPNR5455E6BR3";
+    auto fakeHttp = std::make_shared<test::FakeHttpClient>();
+    fakeHttp->setBehavior({
+        {fmt::format("{}/accounts/{}/transactions?limit=200&order=asc", BASE_URL, address), test::FakeUrlConnection::fromString(EMPTY_PAGE)},
+        {fmt::format("{}/accounts/{}/transactions?limit=20&order=asc&cursor=42", BASE_URL, address), test::FakeUrlConnection::fromString(EMPTY_PAGE)}
+    });
+    auto context = dispatcher->getSerialExecutionContext("explorer");
+    auto http = std::make_shared<HttpClient>(BASE_URL, fakeHttp, context);
+
+    auto explorerWithPageSize = [&] (Option<int32_t> pageSize) {
+        auto configuration = std::make_shared<DynamicObject>();
+        if (pageSize.hasValue()) {
+            configuration->putInt(api::Configuration::BLOCKCHAIN_EXPLORER_PAGE_SIZE, pageSize.getValue());
+        }
+        return std::make_shared<HorizonBlockchainExplorer>(context, http, configuration);
+    };
+
+    // Defaults to, and is capped at, Horizon's maximum limit
+    EXPECT_TRUE(::wait(explorerWithPageSize(Option<int32_t>())->getTransactions(address, Option<std::string>())).empty());
+    EXPECT_TRUE(::wait(explorerWithPageSize(Option<int32_t>(500))->getTransactions(address, Option<std::string>())).empty());
+    EXPECT_TRUE(::wait(explorerWithPageSize(Option<int32_t>(20))->getTransactions(address, Option<std::string>("42"))).empty());
+}
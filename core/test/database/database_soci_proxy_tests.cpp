@@ -39,6 +39,7 @@
 #include <cmath>
 #include <array>
 #include <utils/DateUtils.hpp>
+#include <database/BulkDatabaseHelper.hpp>
 using namespace ledger::core;
 
 struct Item {
@@ -398,4 +399,36 @@ TEST_F(SociProxyTest, SelectRowsWhenEmpty) {
         count += 1;
     }
     EXPECT_EQ(count, 0);
-}
\ No newline at end of file
+}
+
+TEST_F(SociProxyTest, BulkInsertSpansSeveralStatements) {
+    createTables(sql);
+    std::vector<Item> items;
+    for (auto i = 0; i < 500; i++) {
+        items.emplace_back(fmt::format("item_{}", i), i, i % 7);
+    }
+    // 3 columns per row, 333 rows per statement
+    BulkDatabaseHelper::insert(sql, "item", 3, items, [] (BulkDatabaseHelper::Statement& statement, const Item& item) {
+        statement, soci::use(item.name), soci::use(item.quantity), soci::use(item.owner);
+    });
+    int count;
+    sql << "SELECT COUNT(*) FROM item", soci::into(count);
+    EXPECT_EQ(count, items.size());
+    int64_t quantity;
+    sql << "SELECT quantity FROM item WHERE name = 'item_421'", soci::into(quantity);
+    EXPECT_EQ(quantity, 421);
+}
+
+TEST_F(SociProxyTest, SelectWithPlaceholdersList) {
+    createTables(sql);
+    insertPeople(sql, generateData(10, false));
+    std::vector<int> ids {2, 3, 5, 7, 42};
+    BulkDatabaseHelper::Statement statement = (sql.prepare << "SELECT id FROM people WHERE id IN ("
+                                                           << BulkDatabaseHelper::placeholders(ids.size()) << ") ORDER BY id");
+    for (auto& id : ids) {
+        statement, soci::use(id);
+    }
+    soci::rowset<int> rows(statement);
+    std::vector<int> found(rows.begin(), rows.end());
+    EXPECT_EQ(found, std::vector<int>({2, 3, 5, 7}));
+}
@@ -35,6 +35,10 @@
 #include <src/events/LambdaEventReceiver.hpp>
 #include <src/events/Event.hpp>
 #include <src/collections/DynamicObject.hpp>
+#include <spdlog/sinks/ostream_sink.h>
+#include <atomic>
+#include <sstream>
+#include <thread>
 
 using namespace ledger::core;
 using namespace ledger::qt;
@@ -124,4 +128,163 @@ TEST(Events, EventFilter) {
     eventPublisher->post(api::Event::newInstance(api::EventCode::SYNCHRONIZATION_FAILED, DynamicObject::newInstance()));
     eventPublisher->post(api::Event::newInstance(api::EventCode::SYNCHRONIZATION_STARTED, DynamicObject::newInstance()));
     dispatcher->waitUntilStopped();
-}
\ No newline at end of file
+}
+TEST(Events, BatchedDeliveryKeepsOrder) {
+    auto dispatcher = std::make_shared<QtThreadDispatcher>();
+    auto eventPublisher = std::make_shared<EventPublisher>(dispatcher->getSerialExecutionContext("worker"));
+    std::vector<api::EventCode> received;
+
+    auto receiver = make_receiver([&] (const std::shared_ptr<api::Event>& event) {
+        received.push_back(event->getCode());
+        if (event->getCode() == api::EventCode::SYNCHRONIZATION_SUCCEED) {
+            dispatcher->stop();
+        }
+    });
+    eventPublisher->getEventBus()->subscribe(dispatcher->getMainExecutionContext(), receiver);
+
+    eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_STARTED, nullptr));
+    eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, nullptr));
+    eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, nullptr));
+    eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_SUCCEED, nullptr));
+    dispatcher->waitUntilStopped();
+
+    std::vector<api::EventCode> expected {
+        api::EventCode::SYNCHRONIZATION_STARTED, api::EventCode::NEW_OPERATION,
+        api::EventCode::NEW_OPERATION, api::EventCode::SYNCHRONIZATION_SUCCEED
+    };
+    EXPECT_EQ(received, expected);
+}
+
+TEST(Events, CoalescedEventsKeepLast) {
+    auto dispatcher = std::make_shared<QtThreadDispatcher>();
+    auto eventPublisher = std::make_shared<EventPublisher>(dispatcher->getSerialExecutionContext("worker"));
+    eventPublisher->setCoalesced(api::EventCode::NEW_OPERATION, true);
+    std::vector<std::string> received;
+
+    auto receiver = make_receiver([&] (const std::shared_ptr<api::Event>& event) {
+        if (event->getCode() == api::EventCode::NEW_OPERATION) {
+            received.push_back(event->getPayload()->getString("uid").value_or(""));
+        } else if (event->getCode() == api::EventCode::SYNCHRONIZATION_SUCCEED) {
+            dispatcher->stop();
+        }
+    });
+    eventPublisher->getEventBus()->subscribe(dispatcher->getMainExecutionContext(), receiver);
+
+    // The main context is busy until the whole burst is posted, only the last operation event is delivered
+    dispatcher->getMainExecutionContext()->execute(ledger::qt::make_runnable([=] () {
+        for (auto i = 0; i < 10; i++) {
+            auto payload = std::make_shared<DynamicObject>();
+            payload->putString("uid", std::to_string(i));
+            eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, payload));
+        }
+        eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_SUCCEED, nullptr));
+    }));
+    dispatcher->waitUntilStopped();
+
+    EXPECT_EQ(received, std::vector<std::string>({"9"}));
+}
+
+TEST(Events, CoalescedEventIsDeliveredAfterEventsPostedBeforeIt) {
+    auto dispatcher = std::make_shared<QtThreadDispatcher>();
+    auto eventPublisher = std::make_shared<EventPublisher>(dispatcher->getSerialExecutionContext("worker"));
+    eventPublisher->setCoalesced(api::EventCode::NEW_OPERATION, true);
+    std::vector<std::string> received;
+
+    auto receiver = make_receiver([&] (const std::shared_ptr<api::Event>& event) {
+        if (event->getCode() == api::EventCode::NEW_OPERATION) {
+            received.push_back("operation " + event->getPayload()->getString("uid").value_or(""));
+        } else if (event->getCode() == api::EventCode::NEW_BLOCK) {
+            received.push_back("block");
+        } else if (event->getCode() == api::EventCode::SYNCHRONIZATION_SUCCEED) {
+            dispatcher->stop();
+        }
+    });
+    eventPublisher->getEventBus()->subscribe(dispatcher->getMainExecutionContext(), receiver);
+
+    // The main context is busy until every event is posted, the second operation replaces the first one
+    dispatcher->getMainExecutionContext()->execute(ledger::qt::make_runnable([=] () {
+        for (auto i = 0; i < 2; i++) {
+            auto payload = std::make_shared<DynamicObject>();
+            payload->putString("uid", std::to_string(i));
+            eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, payload));
+            if (i == 0) {
+                eventPublisher->post(make_event(api::EventCode::NEW_BLOCK, nullptr));
+            }
+        }
+        eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_SUCCEED, nullptr));
+    }));
+    dispatcher->waitUntilStopped();
+
+    EXPECT_EQ(received, std::vector<std::string>({"block", "operation 1"}));
+}
+
+TEST(Events, EventsPostedDuringDeliveryAreNotDeliveredConcurrently) {
+    auto dispatcher = std::make_shared<QtThreadDispatcher>();
+    auto eventPublisher = std::make_shared<EventPublisher>(dispatcher->getSerialExecutionContext("worker"));
+    std::atomic<bool> delivering(false);
+    std::atomic<bool> overlapped(false);
+    std::vector<int32_t> received;
+
+    auto receiver = make_receiver([&] (const std::shared_ptr<api::Event>& event) {
+        if (delivering.exchange(true)) {
+            overlapped = true;
+        }
+        auto index = event->getPayload()->getInt("index").value_or(-1);
+        received.push_back(index);
+        if (index < 19) {
+            auto payload = std::make_shared<DynamicObject>();
+            payload->putInt("index", index + 1);
+            eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, payload));
+            // Leaves time to a second drain to start if the first one gave up its turn too early
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        delivering = false;
+        if (index == 19) {
+            dispatcher->stop();
+        }
+    });
+    // A thread pool context would run two drains of the same subscriber in parallel
+    eventPublisher->getEventBus()->subscribe(dispatcher->getThreadPoolExecutionContext("receivers"), receiver);
+
+    auto payload = std::make_shared<DynamicObject>();
+    payload->putInt("index", 0);
+    eventPublisher->post(make_event(api::EventCode::NEW_OPERATION, payload));
+    dispatcher->waitUntilStopped();
+
+    std::vector<int32_t> expected;
+    for (auto i = 0; i < 20; i++) {
+        expected.push_back(i);
+    }
+    EXPECT_FALSE(overlapped);
+    EXPECT_EQ(received, expected);
+}
+
+TEST(Events, FailingReceiverIsLoggedAndDeliveryGoesOn) {
+    auto dispatcher = std::make_shared<QtThreadDispatcher>();
+    auto eventPublisher = std::make_shared<EventPublisher>(dispatcher->getSerialExecutionContext("worker"));
+    std::ostringstream output;
+    auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(output);
+    eventPublisher->setLogger(std::make_shared<spdlog::logger>("events_test", sink));
+    std::vector<api::EventCode> received;
+
+    auto receiver = make_receiver([&] (const std::shared_ptr<api::Event>& event) {
+        received.push_back(event->getCode());
+        if (event->getCode() == api::EventCode::SYNCHRONIZATION_FAILED) {
+            throw std::runtime_error("receiver is broken");
+        } else if (event->getCode() == api::EventCode::SYNCHRONIZATION_SUCCEED) {
+            dispatcher->stop();
+        }
+    });
+    eventPublisher->getEventBus()->subscribe(dispatcher->getMainExecutionContext(), receiver);
+
+    eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_FAILED, nullptr));
+    eventPublisher->post(make_event(api::EventCode::SYNCHRONIZATION_SUCCEED, nullptr));
+    dispatcher->waitUntilStopped();
+
+    std::vector<api::EventCode> expected {
+        api::EventCode::SYNCHRONIZATION_FAILED, api::EventCode::SYNCHRONIZATION_SUCCEED
+    };
+    EXPECT_EQ(received, expected);
+    EXPECT_NE(output.str().find("receiver is broken"), std::string::npos);
+    EXPECT_NE(output.str().find(api::to_string(api::EventCode::SYNCHRONIZATION_FAILED)), std::string::npos);
+}
@@ -56,6 +56,37 @@ TEST_F(AccountCreationTest, CreateBitcoinAccountWithInfoOnExistingWallet) {
     }
 }
 
+TEST_F(AccountCreationTest, RestoreAccountsInParallel) {
+    const auto accountCount = 4;
+    std::vector<std::string> addresses;
+    {
+        auto pool = newDefaultPool();
+        auto wallet = wait(pool->createWallet("my_wallet", "bitcoin", DynamicObject::newInstance()));
+        for (auto index = 0; index < accountCount; index++) {
+            auto account = createBitcoinLikeAccount(wallet, index, P2PKH_MEDIUM_XPUB_INFO);
+            addresses.push_back(wait(account->getFreshPublicAddresses())[0]->toString());
+        }
+    }
+    auto pool = newDefaultPool();
+    auto wallet = std::dynamic_pointer_cast<AbstractWallet>(wait(pool->getWallet("my_wallet")));
+
+    // Concurrent restores of the same accounts keep a single instance per index
+    auto first = wallet->getAccounts(0, accountCount);
+    auto second = wallet->getAccounts(0, accountCount);
+    auto firstAccounts = wait(first);
+    auto secondAccounts = wait(second);
+    ASSERT_EQ(firstAccounts.size(), static_cast<size_t>(accountCount));
+    ASSERT_EQ(secondAccounts.size(), static_cast<size_t>(accountCount));
+    for (auto index = 0; index < accountCount; index++) {
+        EXPECT_EQ(firstAccounts[index], secondAccounts[index]);
+        EXPECT_EQ(firstAccounts[index]->getIndex(), index);
+        EXPECT_EQ(firstAccounts[index], wait(wallet->getAccount(index)));
+        // Restored keychains derive on first use
+        auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(firstAccounts[index]);
+        EXPECT_EQ(wait(account->getFreshPublicAddresses())[0]->toString(), addresses[index]);
+    }
+}
+
 TEST_F(AccountCreationTest, ChangePassword) {
     auto oldPassword = "";
     auto newPassword = "new_test";
@@ -35,6 +35,8 @@
 #include <wallet/common/OperationQuery.h>
 #include <api/KeychainEngines.hpp>
 #include <utils/DateUtils.hpp>
+#include <wallet/common/database/OperationDatabaseHelper.h>
+#include <wallet/bitcoin/database/BitcoinLikeUTXODatabaseHelper.h>
 #include <iostream>
 using namespace std;
 class AccountsPublicInterfaceTest : public BaseFixture {
@@ -91,6 +93,34 @@ TEST_F(AccountsPublicInterfaceTest, GetBalanceHistoryOnAccountWithSomeTxs) {
     EXPECT_EQ(balanceHistory[balanceHistory.size() - 1]->toLong(), balance->toLong());
 }
 
+TEST_F(AccountsPublicInterfaceTest, FixedWidthAmountsMatchBigIntAmounts) {
+    auto account = ledger::testing::medium_xpub::inflate(pool, wallet);
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    auto keychain = account->getKeychain();
+    std::function<bool (const std::string&)> filter = [&keychain] (const std::string& addr) -> bool {
+        return keychain->contains(addr);
+    };
+
+    std::vector<BitcoinLikeBlockchainExplorerOutput> utxos;
+    BitcoinLikeUTXODatabaseHelper::queryUTXO(sql, account->getAccountUid(), 0, std::numeric_limits<int32_t>::max(), utxos, filter);
+    BigInt utxoSum;
+    for (const auto& utxo : utxos) {
+        utxoSum = utxoSum + utxo.value;
+    }
+    EXPECT_EQ(BitcoinLikeUTXODatabaseHelper::sumUTXO(sql, account->getAccountUid(), filter).toBigInt().toString(), utxoSum.toString());
+
+    std::vector<Operation> operations;
+    std::vector<OperationAmount> amounts;
+    OperationDatabaseHelper::queryOperations(sql, account->getAccountUid(), operations, filter);
+    OperationDatabaseHelper::queryOperationAmounts(sql, account->getAccountUid(), amounts, filter);
+    ASSERT_EQ(amounts.size(), operations.size());
+    for (size_t i = 0; i < amounts.size(); i++) {
+        EXPECT_EQ(amounts[i].type, operations[i].type);
+        EXPECT_EQ(amounts[i].amount.toBigInt().toString(), operations[i].amount.toString());
+        EXPECT_EQ(amounts[i].fees.toBigInt().toString(), operations[i].fees.getValue().toString());
+    }
+}
+
 TEST_F(AccountsPublicInterfaceTest, QueryOperations) {
     auto account = ledger::testing::medium_xpub::inflate(pool, wallet);
     auto query = std::dynamic_pointer_cast<ledger::core::OperationQuery>(account->queryOperations()->limit(100)->partial());
@@ -0,0 +1,156 @@
+/*
+ *
+ * bulk_ingestion_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "BaseFixture.h"
+
+#include <chrono>
+#include <iostream>
+
+#include <api/PoolConfiguration.hpp>
+#include <database/BulkDatabaseHelper.hpp>
+#include <utils/Exception.hpp>
+
+namespace {
+    struct IngestionRow {
+        std::string uid;
+        std::string accountUid;
+        std::string amount;
+        int32_t blockHeight;
+    };
+
+    std::vector<IngestionRow> makeRows(size_t offset, size_t count) {
+        std::vector<IngestionRow> rows;
+        rows.reserve(count);
+        for (size_t index = offset; index < offset + count; index++) {
+            rows.push_back(IngestionRow {
+                "operation-" + std::to_string(index),
+                "account-" + std::to_string(index % 16),
+                std::to_string(index * 1000),
+                static_cast<int32_t>(index / 10)
+            });
+        }
+        return rows;
+    }
+
+    void bindRow(BulkDatabaseHelper::Statement &statement, const IngestionRow &row) {
+        statement, soci::use(row.uid), soci::use(row.accountUid), soci::use(row.amount), soci::use(row.blockHeight);
+    }
+}
+
+class BulkIngestionTests : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+#ifdef PG_SUPPORT
+        auto configuration = DynamicObject::newInstance();
+        configuration->putString(api::PoolConfiguration::DATABASE_NAME, "postgres://localhost:5432/test_db");
+        pool = newDefaultPool("postgres", "", configuration, true);
+#else
+        pool = newDefaultPool();
+#endif
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        sql << "DROP TABLE IF EXISTS bulk_ingestion_operations";
+        sql << "CREATE TABLE bulk_ingestion_operations("
+               "uid VARCHAR(255) PRIMARY KEY NOT NULL,"
+               "account_uid VARCHAR(255) NOT NULL,"
+               "amount VARCHAR(255) NOT NULL,"
+               "block_height INTEGER NOT NULL)";
+    }
+
+    void TearDown() override {
+        {
+            soci::session sql(pool->getDatabaseSessionPool()->getPool());
+            sql << "DROP TABLE IF EXISTS bulk_ingestion_operations";
+        }
+        pool.reset();
+        BaseFixture::TearDown();
+    }
+
+    int count(soci::session &sql) {
+        int result = 0;
+        sql << "SELECT COUNT(*) FROM bulk_ingestion_operations", soci::into(result);
+        return result;
+    }
+
+    std::shared_ptr<WalletPool> pool;
+};
+
+TEST_F(BulkIngestionTests, InsertIgnoresConflictingRows) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    auto rows = makeRows(0, 3);
+    BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, rows, bindRow);
+    EXPECT_EQ(count(sql), 3);
+
+    auto overlapping = makeRows(2, 2);
+    EXPECT_THROW(BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, overlapping, bindRow), soci::soci_error);
+    BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, overlapping, bindRow,
+                               BulkDatabaseHelper::OnConflict::IGNORE);
+    EXPECT_EQ(count(sql), 4);
+}
+
+TEST_F(BulkIngestionTests, IngestRollsBackFailedWrites) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    auto rows = makeRows(0, 10);
+    auto attempts = 0;
+    EXPECT_THROW(BulkDatabaseHelper::ingest(sql, [&] () {
+        attempts++;
+        BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, rows, bindRow);
+        throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Failure after the insertion");
+    }), Exception);
+    EXPECT_EQ(attempts, 1);
+    EXPECT_EQ(count(sql), 0);
+
+    BulkDatabaseHelper::ingest(sql, [&] () {
+        BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, rows, bindRow);
+    });
+    EXPECT_EQ(count(sql), 10);
+}
+
+TEST_F(BulkIngestionTests, IngestHundredThousandOperations) {
+    static const size_t OPERATIONS_COUNT = 100000;
+    // Size of an explorer page, one ingestion transaction each
+    static const size_t PAGE_SIZE = 1000;
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < OPERATIONS_COUNT; offset += PAGE_SIZE) {
+        auto rows = makeRows(offset, PAGE_SIZE);
+        BulkDatabaseHelper::ingest(sql, [&] () {
+            BulkDatabaseHelper::insert(sql, "bulk_ingestion_operations", 4, rows, bindRow,
+                                       BulkDatabaseHelper::OnConflict::IGNORE);
+        });
+    }
+    std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start;
+    std::cout << "Ingested " << OPERATIONS_COUNT << " operations on " << sql.get_backend_name() << " in "
+              << diff.count() << " s (" << OPERATIONS_COUNT / diff.count() << " operations/s)" << std::endl;
+
+    EXPECT_EQ(count(sql), static_cast<int>(OPERATIONS_COUNT));
+}
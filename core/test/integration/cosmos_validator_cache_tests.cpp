@@ -0,0 +1,222 @@
+/*
+ *
+ * cosmos_validator_cache_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "BaseFixture.h"
+#include <mutex>
+#include <thread>
+#include <async/Promise.hpp>
+#include <wallet/cosmos/CosmosLikeValidatorCache.hpp>
+#include <wallet/cosmos/CosmosNetworks.hpp>
+#include <wallet/cosmos/explorers/GaiaCosmosLikeBlockchainExplorer.hpp>
+
+namespace {
+    const std::string OPERATOR = "cosmosvaloper1test";
+    const auto REFRESH_INTERVAL = std::chrono::milliseconds(50);
+
+    // Validators requests stay pending until the test answers them, every answer is tagged with a
+    // version carried in the voting power
+    class ScriptedValidatorExplorer : public GaiaCosmosLikeBlockchainExplorer {
+    public:
+        ScriptedValidatorExplorer(const std::shared_ptr<api::ExecutionContext>& context,
+                                  const std::shared_ptr<HttpClient>& http) :
+            GaiaCosmosLikeBlockchainExplorer(context, http, networks::getCosmosLikeNetworkParameters("atom"),
+                                             std::make_shared<DynamicObject>()) {}
+
+        Future<cosmos::ValidatorList> getActiveValidatorSet() const override {
+            std::lock_guard<std::mutex> lock(_lock);
+            setRequests++;
+            _pendingSets.emplace_back();
+            return _pendingSets.back().getFuture();
+        }
+
+        Future<cosmos::Validator> getValidatorInfo(const std::string& operatorAddress) const override {
+            std::lock_guard<std::mutex> lock(_lock);
+            infoRequests++;
+            _pendingInfos.emplace_back();
+            return _pendingInfos.back().getFuture();
+        }
+
+        void answer(const std::string& version) {
+            std::vector<Promise<cosmos::ValidatorList>> sets;
+            std::vector<Promise<cosmos::Validator>> infos;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                std::swap(sets, _pendingSets);
+                std::swap(infos, _pendingInfos);
+            }
+            for (auto& set : sets) {
+                set.success(cosmos::ValidatorList({validator(version)}));
+            }
+            for (auto& info : infos) {
+                info.success(validator(version));
+            }
+        }
+
+        void fail() {
+            std::vector<Promise<cosmos::ValidatorList>> sets;
+            std::vector<Promise<cosmos::Validator>> infos;
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                std::swap(sets, _pendingSets);
+                std::swap(infos, _pendingInfos);
+            }
+            for (auto& set : sets) {
+                set.failure(make_exception(api::ErrorCode::HTTP_ERROR, "Validators are unavailable"));
+            }
+            for (auto& info : infos) {
+                info.failure(make_exception(api::ErrorCode::HTTP_ERROR, "Validator is unavailable"));
+            }
+        }
+
+        mutable int setRequests = 0;
+        mutable int infoRequests = 0;
+
+    private:
+        static cosmos::Validator validator(const std::string& version) {
+            cosmos::Validator result;
+            result.operatorAddress = OPERATOR;
+            result.votingPower = version;
+            return result;
+        }
+
+        mutable std::mutex _lock;
+        mutable std::vector<Promise<cosmos::ValidatorList>> _pendingSets;
+        mutable std::vector<Promise<cosmos::Validator>> _pendingInfos;
+    };
+}
+
+class CosmosLikeValidatorCacheTest : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        context = dispatcher->getSerialExecutionContext("validators");
+        explorer = std::make_shared<ScriptedValidatorExplorer>(context, std::make_shared<HttpClient>("http://gaia.test", http, context));
+        cache = std::make_shared<CosmosLikeValidatorCache>(context, explorer, REFRESH_INTERVAL);
+    }
+
+    void TearDown() override {
+        cache = nullptr;
+        explorer = nullptr;
+        BaseFixture::TearDown();
+    }
+
+    // Let the cache store what the explorer answered
+    void drain() {
+        wait(Future<Unit>::async(context, [] () { return unit; }));
+    }
+
+    void loadAll(const std::string& version) {
+        auto set = cache->getActiveValidatorSet();
+        auto info = cache->getValidatorInfo(OPERATOR);
+        explorer->answer(version);
+        EXPECT_EQ(wait(set).front().votingPower, version);
+        EXPECT_EQ(wait(info).votingPower, version);
+        drain();
+    }
+
+    std::shared_ptr<api::ExecutionContext> context;
+    std::shared_ptr<ScriptedValidatorExplorer> explorer;
+    std::shared_ptr<CosmosLikeValidatorCache> cache;
+};
+
+TEST_F(CosmosLikeValidatorCacheTest, ConcurrentFirstLoadsShareOneRequest) {
+    auto first = cache->getActiveValidatorSet();
+    auto second = cache->getActiveValidatorSet();
+    EXPECT_EQ(explorer->setRequests, 1);
+    explorer->answer("1");
+    EXPECT_EQ(wait(first).front().votingPower, "1");
+    EXPECT_EQ(wait(second).front().votingPower, "1");
+}
+
+TEST_F(CosmosLikeValidatorCacheTest, FreshDataIsServedFromMemory) {
+    loadAll("1");
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "1");
+    EXPECT_EQ(wait(cache->getValidatorInfo(OPERATOR)).votingPower, "1");
+    EXPECT_EQ(explorer->setRequests, 1);
+    EXPECT_EQ(explorer->infoRequests, 1);
+}
+
+TEST_F(CosmosLikeValidatorCacheTest, StaleDataIsServedWhileRevalidating) {
+    loadAll("1");
+    std::this_thread::sleep_for(REFRESH_INTERVAL * 2);
+
+    // Stale data is answered at once, a single refresh is sent for concurrent readers
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "1");
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "1");
+    EXPECT_EQ(wait(cache->getValidatorInfo(OPERATOR)).votingPower, "1");
+    EXPECT_EQ(explorer->setRequests, 2);
+    EXPECT_EQ(explorer->infoRequests, 2);
+
+    explorer->answer("2");
+    drain();
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "2");
+    EXPECT_EQ(wait(cache->getValidatorInfo(OPERATOR)).votingPower, "2");
+    EXPECT_EQ(explorer->setRequests, 2);
+    EXPECT_EQ(explorer->infoRequests, 2);
+}
+
+TEST_F(CosmosLikeValidatorCacheTest, NewBlockRefreshesStaleDataOnly) {
+    // Nothing loaded yet, nothing to refresh
+    cache->onNewBlock();
+    EXPECT_EQ(explorer->setRequests, 0);
+    EXPECT_EQ(explorer->infoRequests, 0);
+
+    loadAll("1");
+    cache->onNewBlock();
+    EXPECT_EQ(explorer->setRequests, 1);
+    EXPECT_EQ(explorer->infoRequests, 1);
+
+    std::this_thread::sleep_for(REFRESH_INTERVAL * 2);
+    cache->onNewBlock();
+    cache->onNewBlock();
+    EXPECT_EQ(explorer->setRequests, 2);
+    EXPECT_EQ(explorer->infoRequests, 2);
+    explorer->answer("2");
+    drain();
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "2");
+    EXPECT_EQ(wait(cache->getValidatorInfo(OPERATOR)).votingPower, "2");
+}
+
+TEST_F(CosmosLikeValidatorCacheTest, FailedRefreshKeepsServingStaleData) {
+    loadAll("1");
+    std::this_thread::sleep_for(REFRESH_INTERVAL * 2);
+    cache->onNewBlock();
+    EXPECT_EQ(explorer->setRequests, 2);
+    explorer->fail();
+    drain();
+
+    // The failure is not cached, the next read refreshes again
+    EXPECT_EQ(wait(cache->getActiveValidatorSet()).front().votingPower, "1");
+    EXPECT_EQ(wait(cache->getValidatorInfo(OPERATOR)).votingPower, "1");
+    EXPECT_EQ(explorer->setRequests, 3);
+    EXPECT_EQ(explorer->infoRequests, 3);
+}
@@ -0,0 +1,293 @@
+/*
+ *
+ * erc20_balance_ledger_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "BaseFixture.h"
+#include <api/HttpRequest.hpp>
+#include <utils/DateUtils.hpp>
+#include <database/BulkDatabaseHelper.hpp>
+#include <wallet/common/database/AccountDatabaseHelper.h>
+#include <wallet/common/database/OperationDatabaseHelper.h>
+#include <wallet/ethereum/database/EthereumLikeAccountDatabaseHelper.h>
+#include <wallet/ethereum/ERC20/ERC20LikeAccount.h>
+#include "FakeHttpClient.hpp"
+
+namespace {
+    const std::string CONTRACT = "0x57e8ba2a915285f984988282ab9346c1336a4e11";
+    const std::string PEER = "0x3d7b9c2a5d5b7ac1f8e1bb8bb8d1cbd0e0ad0001";
+}
+
+class ERC20BalanceLedgerTest : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        http = std::make_shared<test::FakeHttpClient>();
+        pool = WalletPool::newInstance("erc20_pool", "", http, ws, resolver, printer, dispatcher, rng, backend,
+                                       api::DynamicObject::newInstance(), nullptr, nullptr);
+        auto configuration = DynamicObject::newInstance();
+        configuration->putString(api::Configuration::KEYCHAIN_DERIVATION_SCHEME, "44'/60'/0'/0/<account>'");
+        configuration->putString(api::Configuration::BLOCKCHAIN_EXPLORER_API_ENDPOINT, "http://test.test");
+        auto wallet = wait(pool->createWallet("erc20_wallet", "ethereum", configuration));
+        account = createEthereumLikeAccount(wallet, 0, ETH_KEYS_INFO_LIVE);
+        address = account->getKeychain()->getAddress()->toString();
+    }
+
+    void TearDown() override {
+        account = nullptr;
+        pool = nullptr;
+        BaseFixture::TearDown();
+    }
+
+    // Store a token transfer of the account, in a block when height is given
+    std::string putTransfer(const std::string& hash, api::OperationType type, int64_t value, Option<uint64_t> height) {
+        return putTransfer(hash, type, BigInt(value), height);
+    }
+
+    std::string putTransfer(const std::string& hash, api::OperationType type, const BigInt& value, Option<uint64_t> height) {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        soci::transaction tr(sql);
+        account->putTransaction(sql, transferOf(hash, type, value, height));
+        tr.commit();
+        return OperationDatabaseHelper::createUid(account->getAccountUid(), hash, api::OperationType::NONE);
+    }
+
+    // A token transfer of the account, in a block when height is given
+    EthereumLikeBlockchainExplorerTransaction transferOf(const std::string& hash, api::OperationType type, const BigInt& value, Option<uint64_t> height) {
+        EthereumLikeBlockchainExplorerTransaction tx;
+        tx.hash = hash;
+        tx.receivedAt = DateUtils::now();
+        tx.sender = PEER;
+        tx.receiver = CONTRACT;
+        tx.value = BigInt::ZERO;
+        tx.gasPrice = BigInt(1);
+        tx.gasLimit = BigInt(60000);
+        tx.gasUsed = BigInt(50000);
+        tx.status = 1;
+        if (height.hasValue()) {
+            Block block;
+            block.hash = fmt::format("block_{}", height.getValue());
+            block.height = height.getValue();
+            block.time = tx.receivedAt;
+            block.currencyName = account->getWallet()->getCurrency().name;
+            tx.block = block;
+        }
+        ERC20Transaction transfer;
+        transfer.contractAddress = CONTRACT;
+        transfer.from = type == api::OperationType::SEND ? address : PEER;
+        transfer.to = type == api::OperationType::SEND ? PEER : address;
+        transfer.value = value;
+        tx.erc20Transactions.push_back(transfer);
+        return tx;
+    }
+
+    int countERC20Operations(soci::session& sql) {
+        int count = 0;
+        sql << "SELECT COUNT(*) FROM erc20_operations", soci::into(count);
+        return count;
+    }
+
+    std::shared_ptr<ERC20LikeAccount> erc20Account() {
+        return std::dynamic_pointer_cast<ERC20LikeAccount>(account->getERC20Accounts().front());
+    }
+
+    Option<std::string> storedBalance() {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        auto uid = AccountDatabaseHelper::createERC20AccountUid(account->getAccountUid(), CONTRACT);
+        return EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, uid).map<std::string>([] (const BigInt& balance) {
+            return balance.toString();
+        });
+    }
+
+    void eraseStoredBalances() {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalances(sql, account->getAccountUid());
+    }
+
+    // Answers the next explorer request with a token balance, running beforeResponse first
+    void respondWithBalance(const std::string& balance, const std::function<void ()>& beforeResponse = nullptr) {
+        http->script(fmt::format("[{{\"balance\":\"{}\"}}]", balance), beforeResponse);
+    }
+
+    std::shared_ptr<test::FakeHttpClient> http;
+    std::shared_ptr<WalletPool> pool;
+    std::shared_ptr<EthereumLikeAccount> account;
+    std::string address;
+};
+
+TEST_F(ERC20BalanceLedgerTest, BalanceRoundTrip) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    auto uid = AccountDatabaseHelper::createERC20AccountUid(account->getAccountUid(), CONTRACT);
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    EXPECT_TRUE(EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, uid).isEmpty());
+    EthereumLikeAccountDatabaseHelper::putERC20AccountBalance(sql, uid, BigInt(42));
+    EXPECT_EQ(EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, uid).getValue().toString(), "42");
+    EthereumLikeAccountDatabaseHelper::putERC20AccountBalance(sql, uid, BigInt::fromString("1000000000000000000000"));
+    EXPECT_EQ(EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, uid).getValue().toString(), "1000000000000000000000");
+    EthereumLikeAccountDatabaseHelper::eraseERC20AccountBalance(sql, uid);
+    EXPECT_TRUE(EthereumLikeAccountDatabaseHelper::getERC20AccountBalance(sql, uid).isEmpty());
+}
+
+TEST_F(ERC20BalanceLedgerTest, ReconciledBalanceIsServedLocally) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    respondWithBalance("10");
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "10");
+    EXPECT_EQ(storedBalance().getValue(), "10");
+
+    // Synchronized transfers are applied on the ledger, without asking the explorer again
+    putTransfer("0x02", api::OperationType::RECEIVE, 5, Option<uint64_t>(101));
+    putTransfer("0x03", api::OperationType::SEND, 3, Option<uint64_t>(102));
+    EXPECT_EQ(storedBalance().getValue(), "12");
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "12");
+    EXPECT_EQ(http->getScriptedResponsesCount(), 0);
+}
+
+TEST_F(ERC20BalanceLedgerTest, ExplorerBalanceAheadOfSynchronizationIsNotStored) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    // The explorer already counts a transfer that synchronization did not reach yet
+    respondWithBalance("15");
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "10");
+    EXPECT_EQ(storedBalance().getValue(), "10");
+
+    // Synchronizing that transfer counts it once
+    putTransfer("0x02", api::OperationType::RECEIVE, 5, Option<uint64_t>(101));
+    EXPECT_EQ(storedBalance().getValue(), "15");
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "15");
+}
+
+TEST_F(ERC20BalanceLedgerTest, TransferSynchronizedDuringReconciliationIsCounted) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    // A transfer is synchronized while the explorer request is in flight
+    respondWithBalance("10", [this] () {
+        putTransfer("0x02", api::OperationType::RECEIVE, 5, Option<uint64_t>(101));
+    });
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "15");
+    EXPECT_EQ(storedBalance().getValue(), "15");
+}
+
+TEST_F(ERC20BalanceLedgerTest, ExplorerFailureDoesNotFailBalance) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    putTransfer("0x02", api::OperationType::SEND, 4, Option<uint64_t>(101));
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "6");
+    EXPECT_EQ(storedBalance().getValue(), "6");
+}
+
+TEST_F(ERC20BalanceLedgerTest, ReorganizationInvalidatesBalance) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    respondWithBalance("10");
+    wait(erc20Account()->getBalance());
+    putTransfer("0x02", api::OperationType::RECEIVE, 5, Option<uint64_t>(101));
+    EXPECT_EQ(storedBalance().getValue(), "15");
+
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        AccountDatabaseHelper::eraseBlocksFromHeight(sql, account->getWallet()->getCurrency().name, 101);
+    }
+    EXPECT_TRUE(storedBalance().isEmpty());
+
+    // The balance is summed again from the transfers left
+    respondWithBalance("15");
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "10");
+}
+
+TEST_F(ERC20BalanceLedgerTest, DroppedMempoolTransferInvalidatesBalance) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    respondWithBalance("10");
+    wait(erc20Account()->getBalance());
+    auto pendingUid = putTransfer("0x02", api::OperationType::RECEIVE, 5, Option<uint64_t>());
+    EXPECT_EQ(storedBalance().getValue(), "15");
+
+    {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        AccountDatabaseHelper::eraseOperations(sql, account->getAccountUid(), {pendingUid});
+    }
+    EXPECT_TRUE(storedBalance().isEmpty());
+}
+
+TEST_F(ERC20BalanceLedgerTest, EraseDataSinceDropsBalances) {
+    putTransfer("0x01", api::OperationType::RECEIVE, 10, Option<uint64_t>(100));
+    respondWithBalance("10");
+    wait(erc20Account()->getBalance());
+    wait(account->eraseDataSince(DateUtils::fromJSON("2000-01-01T00:00:00Z")));
+    EXPECT_TRUE(storedBalance().isEmpty());
+}
+
+TEST_F(ERC20BalanceLedgerTest, BalanceHistoryOverflowingInt256FallsBackToBigInt) {
+    auto start = DateUtils::now() - std::chrono::hours(1);
+    // Twice 2^255 does not fit in Int256
+    auto half = BigInt::fromHex("8000000000000000000000000000000000000000000000000000000000000000");
+    putTransfer("0x01", api::OperationType::RECEIVE, half, Option<uint64_t>(100));
+    putTransfer("0x02", api::OperationType::RECEIVE, half, Option<uint64_t>(101));
+    auto history = erc20Account()->getBalanceHistoryFor(start, DateUtils::now() + std::chrono::hours(1), api::TimePeriod::HOUR);
+    ASSERT_FALSE(history.empty());
+    EXPECT_EQ(history.back()->toString(10), "115792089237316195423570985008687907853269984665640564039457584007913129639936");
+}
+
+TEST_F(ERC20BalanceLedgerTest, SubAccountOfFailedPageIsCreatedAgainOnReplay) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    // A page writing the first transfer of a token fails after the sub-account was written
+    EXPECT_THROW(BulkDatabaseHelper::ingest(sql, [&] () {
+        account->stageChanges();
+        account->putTransaction(sql, transferOf("0x01", api::OperationType::RECEIVE, BigInt(10), Option<uint64_t>(100)));
+        throw make_exception(api::ErrorCode::RUNTIME_ERROR, "Page failed");
+    }), Exception);
+    account->discardStagedChanges();
+    EXPECT_TRUE(account->getERC20Accounts().empty());
+
+    // Its replay writes the sub-account again before its operation
+    BulkDatabaseHelper::ingest(sql, [&] () {
+        account->stageChanges();
+        account->putTransaction(sql, transferOf("0x01", api::OperationType::RECEIVE, BigInt(10), Option<uint64_t>(100)));
+        EXPECT_TRUE(account->getERC20Accounts().empty());
+    });
+    account->commitStagedChanges();
+    EXPECT_EQ(account->getERC20Accounts().size(), 1);
+    EXPECT_EQ(countERC20Operations(sql), 1);
+}
+
+TEST_F(ERC20BalanceLedgerTest, SubAccountOfRolledBackTransactionIsCreatedAgain) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    BulkDatabaseHelper::ingest(sql, [&] () {
+        account->stageChanges();
+        // The first transaction of the token is rolled back to its savepoint
+        auto mark = account->markStagedChanges();
+        sql << "SAVEPOINT put_transaction";
+        account->putTransaction(sql, transferOf("0x01", api::OperationType::RECEIVE, BigInt(10), Option<uint64_t>(100)));
+        sql << "ROLLBACK TO SAVEPOINT put_transaction";
+        sql << "RELEASE SAVEPOINT put_transaction";
+        account->dropStagedChanges(mark);
+        // The next one of the same page writes the sub-account again
+        account->putTransaction(sql, transferOf("0x02", api::OperationType::RECEIVE, BigInt(5), Option<uint64_t>(101)));
+    });
+    account->commitStagedChanges();
+    EXPECT_EQ(account->getERC20Accounts().size(), 1);
+    EXPECT_EQ(countERC20Operations(sql), 1);
+    EXPECT_EQ(wait(erc20Account()->getBalance())->toString(10), "5");
+}
@@ -0,0 +1,257 @@
+/*
+ *
+ * gaia_explorer_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "BaseFixture.h"
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <api/Configuration.hpp>
+#include <api/CosmosConfigurationDefaults.hpp>
+#include <api/HttpRequest.hpp>
+#include <wallet/cosmos/CosmosLikeConstants.hpp>
+#include <wallet/cosmos/CosmosNetworks.hpp>
+#include <wallet/cosmos/explorers/GaiaCosmosLikeBlockchainExplorer.hpp>
+#include "FakeHttpClient.hpp"
+
+namespace {
+    const std::string FILTER = "message.sender=cosmos1test";
+    const std::string ACCOUNT = "cosmos1test";
+    const std::string SIGNER_PUB_KEY = "Anm+Zn753LusVaBilc6HCwcCm/zbLc4o2VnygVsW+BeY";
+
+    std::string transactionJson(const std::string& hash) {
+        return fmt::format(R"({{"txhash":"{}","logs":[],"timestamp":"2020-01-01T00:00:00Z",)"
+                           R"("tx":{{"type":"cosmos-sdk/StdTx","value":{{"msg":[],"fee":{{"amount":[],"gas":"1"}},)"
+                           R"("signatures":[{{"pub_key":{{"type":"tendermint/PubKeySecp256k1","value":"{}"}}}}],"memo":""}}}}}})",
+                           hash, SIGNER_PUB_KEY);
+    }
+
+    // A page of the /txs endpoint, holding two transactions named after the page
+    std::string transactionsPageJson(int page, int totalCount) {
+        return fmt::format(R"({{"total_count":"{}","count":"2","page_number":"{}","txs":[{},{}]}})",
+                           totalCount, page,
+                           transactionJson(fmt::format("page{}_0", page)),
+                           transactionJson(fmt::format("page{}_1", page)));
+    }
+
+    int pageOf(const std::string& url) {
+        return std::stoi(test::FakeHttpClient::getQueryParameter(url, "page").getValueOr("-1"));
+    }
+}
+
+class GaiaExplorerTest : public BaseFixture {
+public:
+    std::shared_ptr<GaiaCosmosLikeBlockchainExplorer> newExplorer(const std::shared_ptr<test::FakeHttpClient>& routes,
+                                                                  const std::shared_ptr<DynamicObject>& configuration = std::make_shared<DynamicObject>()) {
+        worker = dispatcher->getSerialExecutionContext("gaia_worker");
+        auto client = std::make_shared<HttpClient>("http://gaia.test", routes, worker);
+        return std::make_shared<GaiaCosmosLikeBlockchainExplorer>(
+                worker, client, networks::getCosmosLikeNetworkParameters("atom"), configuration);
+    }
+
+    // Serve the balance resources of ACCOUNT, failing them while failBalances is set
+    std::shared_ptr<test::FakeHttpClient> balances() {
+        auto routes = std::make_shared<test::FakeHttpClient>();
+        auto serve = [this] (const std::string& body) -> test::FakeHttpClient::Handler {
+            return [this, body] (const std::shared_ptr<api::HttpRequest>&) {
+                return failBalances ? Option<std::string>() : Option<std::string>(body);
+            };
+        };
+        routes->route(fmt::format("/bank/balances/{}", ACCOUNT), serve(R"({"result":[{"denom":"uatom","amount":"100"}]})"));
+        routes->route(fmt::format("/staking/delegators/{}/delegations", ACCOUNT), serve(R"({"result":[{"balance":"20"}]})"));
+        routes->route(fmt::format("/staking/delegators/{}/unbonding_delegations", ACCOUNT), serve(R"({"result":[{"entries":[{"balance":"3"}]}]})"));
+        routes->route(fmt::format("/distribution/delegators/{}/rewards", ACCOUNT), serve(R"({"result":{"total":[{"denom":"uatom","amount":"4.5"}]}})"));
+        return routes;
+    }
+
+    // Run what is already queued on the explorer context
+    void drainWorker() {
+        wait(Future<Unit>::async(worker, [] () { return unit; }));
+    }
+
+    // Serve every transactions page of a history holding totalCount transactions
+    std::shared_ptr<test::FakeHttpClient> historyOf(int totalCount) {
+        auto routes = std::make_shared<test::FakeHttpClient>();
+        routes->route("/txs?", [totalCount] (const std::shared_ptr<api::HttpRequest>& request) {
+            return Option<std::string>(transactionsPageJson(pageOf(request->getUrl()), totalCount));
+        });
+        return routes;
+    }
+
+    static std::vector<int> requestedPages(const std::shared_ptr<test::FakeHttpClient>& routes) {
+        std::vector<int> pages;
+        for (const auto& url : routes->getUrls()) {
+            pages.push_back(pageOf(url));
+        }
+        std::sort(pages.begin(), pages.end());
+        return pages;
+    }
+
+    static std::vector<std::string> expectedHashes(int pageCount) {
+        std::vector<std::string> hashes;
+        for (auto page = 1; page <= pageCount; page++) {
+            hashes.push_back(fmt::format("page{}_0", page));
+            hashes.push_back(fmt::format("page{}_1", page));
+        }
+        return hashes;
+    }
+
+    static std::vector<std::string> hashesOf(const cosmos::TransactionsBulk& bulk) {
+        std::vector<std::string> hashes;
+        for (const auto& tx : bulk.transactions) {
+            hashes.push_back(tx.hash);
+        }
+        return hashes;
+    }
+
+    static void expectSnapshot(const cosmos::BalanceSnapshot& snapshot) {
+        EXPECT_EQ(snapshot.spendable.toString(), "100");
+        EXPECT_EQ(snapshot.delegated.toString(), "20");
+        EXPECT_EQ(snapshot.unbonding.toString(), "3");
+        EXPECT_EQ(snapshot.pendingRewards.toString(), "4");
+    }
+
+    std::shared_ptr<api::ExecutionContext> worker;
+    std::atomic<bool> failBalances{false};
+};
+
+TEST_F(GaiaExplorerTest, AllTransactionsOnASinglePage) {
+    auto routes = historyOf(2);
+    auto bulk = wait(newExplorer(routes)->getAllTransactions(FILTER));
+    EXPECT_EQ(requestedPages(routes), std::vector<int>({1}));
+    EXPECT_EQ(hashesOf(*bulk), expectedHashes(1));
+    EXPECT_FALSE(bulk->hasNext);
+}
+
+TEST_F(GaiaExplorerTest, AllTransactionsOnExactlyTheMaximumPages) {
+    const auto limit = cosmos::constants::kGaiaMaxTransactionsPerPage;
+    const auto maxPages = cosmos::constants::kGaiaMaxTransactionsPagesPerBulk;
+    auto routes = historyOf(limit * maxPages);
+    auto bulk = wait(newExplorer(routes)->getAllTransactions(FILTER));
+
+    std::vector<int> pages(maxPages);
+    std::iota(pages.begin(), pages.end(), 1);
+    EXPECT_EQ(requestedPages(routes), pages);
+    // Pages are merged in request order whatever the order of the answers
+    EXPECT_EQ(hashesOf(*bulk), expectedHashes(maxPages));
+    EXPECT_FALSE(bulk->hasNext);
+}
+
+TEST_F(GaiaExplorerTest, AllTransactionsBeyondTheMaximumPages) {
+    const auto limit = cosmos::constants::kGaiaMaxTransactionsPerPage;
+    const auto maxPages = cosmos::constants::kGaiaMaxTransactionsPagesPerBulk;
+    // A single transaction over the cap is one more page
+    auto routes = historyOf(limit * maxPages + 1);
+    auto bulk = wait(newExplorer(routes)->getAllTransactions(FILTER));
+
+    std::vector<int> pages(maxPages);
+    std::iota(pages.begin(), pages.end(), 1);
+    EXPECT_EQ(requestedPages(routes), pages);
+    EXPECT_EQ(hashesOf(*bulk), expectedHashes(maxPages));
+    EXPECT_TRUE(bulk->hasNext);
+}
+
+TEST_F(GaiaExplorerTest, AllTransactionsRoundsThePageCountUp) {
+    const auto limit = cosmos::constants::kGaiaMaxTransactionsPerPage;
+    auto routes = historyOf(limit * 2 + 1);
+    auto bulk = wait(newExplorer(routes)->getAllTransactions(FILTER));
+    EXPECT_EQ(requestedPages(routes), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(hashesOf(*bulk), expectedHashes(3));
+    EXPECT_FALSE(bulk->hasNext);
+}
+
+TEST_F(GaiaExplorerTest, BalanceSnapshotIsCached) {
+    auto routes = balances();
+    auto explorer = newExplorer(routes);
+    expectSnapshot(*wait(explorer->getBalanceSnapshot(ACCOUNT)));
+    EXPECT_EQ(routes->getUrls().size(), 4);
+
+    // Every balance figure is served from the snapshot
+    EXPECT_EQ(wait(explorer->getSpendableBalance(ACCOUNT))->toString(), "100");
+    EXPECT_EQ(wait(explorer->getTotalBalance(ACCOUNT))->toString(), "127");
+    EXPECT_EQ(wait(explorer->getTotalBalanceWithoutPendingRewards(ACCOUNT))->toString(), "123");
+    EXPECT_EQ(routes->getUrls().size(), 4);
+}
+
+TEST_F(GaiaExplorerTest, BalanceSnapshotExpires) {
+    auto routes = balances();
+    auto configuration = std::make_shared<DynamicObject>();
+    configuration->putInt(api::Configuration::TTL_CACHE, 1);
+    auto explorer = newExplorer(routes, configuration);
+    wait(explorer->getBalanceSnapshot(ACCOUNT));
+    wait(explorer->getBalanceSnapshot(ACCOUNT));
+    EXPECT_EQ(routes->getUrls().size(), 4);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    expectSnapshot(*wait(explorer->getBalanceSnapshot(ACCOUNT)));
+    EXPECT_EQ(routes->getUrls().size(), 8);
+}
+
+TEST_F(GaiaExplorerTest, ConcurrentBalanceSnapshotsShareRequests) {
+    auto routes = balances();
+    auto explorer = newExplorer(routes);
+    routes->hold();
+    auto first = explorer->getBalanceSnapshot(ACCOUNT);
+    auto second = explorer->getDelegatedBalance(ACCOUNT);
+    EXPECT_EQ(routes->getUrls().size(), 4);
+    routes->release();
+
+    expectSnapshot(*wait(first));
+    EXPECT_EQ(wait(second)->toString(), "20");
+    EXPECT_EQ(routes->getUrls().size(), 4);
+}
+
+TEST_F(GaiaExplorerTest, FailedBalanceSnapshotIsEvicted) {
+    auto routes = balances();
+    auto explorer = newExplorer(routes);
+    failBalances = true;
+    EXPECT_THROW(wait(explorer->getBalanceSnapshot(ACCOUNT)), Exception);
+    // The eviction runs on the explorer context once the snapshot failed
+    drainWorker();
+    EXPECT_EQ(routes->getUrls().size(), 4);
+
+    // The failure is not served until the TTL expires
+    failBalances = false;
+    expectSnapshot(*wait(explorer->getBalanceSnapshot(ACCOUNT)));
+    EXPECT_EQ(routes->getUrls().size(), 8);
+}
+
+TEST_F(GaiaExplorerTest, BalanceSnapshotOutlivingExplorerCompletes) {
+    auto routes = balances();
+    auto explorer = newExplorer(routes);
+    routes->hold();
+    failBalances = true;
+    auto snapshot = explorer->getBalanceSnapshot(ACCOUNT);
+    explorer.reset();
+    routes->release();
+    EXPECT_THROW(wait(snapshot), Exception);
+    drainWorker();
+}
@@ -37,6 +37,17 @@ class BitcoinKeychains : public KeychainFixture<P2PKHBitcoinLikeKeychain> {
 
 };
 
+// Exposes the address cache of the keychain
+class InspectableP2PKHKeychain : public P2PKHBitcoinLikeKeychain {
+public:
+    using P2PKHBitcoinLikeKeychain::P2PKHBitcoinLikeKeychain;
+    using P2PKHBitcoinLikeKeychain::getPreferences;
+};
+
+class LazyBitcoinKeychains : public KeychainFixture<InspectableP2PKHKeychain> {
+
+};
+
 TEST_F(BitcoinKeychains, KeychainDerivation) {
     testKeychain(BTC_DATA, [] (P2PKHBitcoinLikeKeychain& keychain) {
         EXPECT_EQ(keychain.getFreshAddress(BitcoinLikeKeychain::KeyPurpose::RECEIVE)->toBase58(), "151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR");
@@ -241,3 +252,53 @@ TEST_F(BitcoinKeychains, CheckIfEmpty) {
         EXPECT_FALSE(keychain.isEmpty());
     });
 }
+
+TEST_F(LazyBitcoinKeychains, ObservableRangeIsCachedOnFirstUse) {
+    testKeychain(BTC_DATA, [] (InspectableP2PKHKeychain& keychain) {
+        // Building the keychain derives nothing
+        EXPECT_TRUE(keychain.getPreferences()->getString("address:151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR", "").empty());
+        EXPECT_TRUE(keychain.getPreferences()->getString("address:18tMkbibtxJPQoTPUv8s3mSXqYzEsrbeRb", "").empty());
+
+        // Lookups by address restore the initial observable range first
+        EXPECT_TRUE(keychain.contains("18tMkbibtxJPQoTPUv8s3mSXqYzEsrbeRb"));
+        EXPECT_FALSE(keychain.getPreferences()->getString("address:151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR", "").empty());
+        EXPECT_EQ(keychain.getAddressPurpose("13hSrTAvfRzyEcjRcGS5gLEcNVNDhPvvUv").getValue(), BitcoinLikeKeychain::KeyPurpose::CHANGE);
+    });
+}
+
+TEST_F(LazyBitcoinKeychains, MarkAsUsedRestoresFirst) {
+    testKeychain(BTC_DATA, [] (InspectableP2PKHKeychain& keychain) {
+        EXPECT_TRUE(keychain.markAsUsed("151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR"));
+        EXPECT_FALSE(keychain.isEmpty());
+        EXPECT_EQ(keychain.getFreshAddress(BitcoinLikeKeychain::KeyPurpose::RECEIVE)->toBase58(), "18tMkbibtxJPQoTPUv8s3mSXqYzEsrbeRb");
+    });
+}
+
+TEST_F(LazyBitcoinKeychains, StagedUsedPathsArePersistedOnceCommitted) {
+    testKeychain(BTC_DATA, [] (InspectableP2PKHKeychain& keychain) {
+        keychain.stageUsedPaths();
+        EXPECT_TRUE(keychain.markAsUsed("151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR"));
+        // The keychain sees the staged paths before they are persisted
+        EXPECT_EQ(keychain.getFreshAddress(BitcoinLikeKeychain::KeyPurpose::RECEIVE)->toBase58(), "1GJr9FHZ1pbR4hjhX24M4L1BDUd2QogYYA");
+        EXPECT_TRUE(keychain.getPreferences()->getData("state", {}).empty());
+        keychain.commitUsedPaths();
+        EXPECT_FALSE(keychain.getPreferences()->getData("state", {}).empty());
+    });
+}
+
+TEST_F(LazyBitcoinKeychains, DroppedUsedPathsAreForgotten) {
+    testKeychain(BTC_DATA, [] (InspectableP2PKHKeychain& keychain) {
+        keychain.stageUsedPaths();
+        auto mark = keychain.markUsedPaths();
+        EXPECT_TRUE(keychain.markAsUsed("151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR"));
+        keychain.dropUsedPaths(mark);
+        EXPECT_EQ(keychain.getFreshAddress(BitcoinLikeKeychain::KeyPurpose::RECEIVE)->toBase58(), "151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR");
+
+        // A replay marks it again, discarding it leaves the keychain as it was before staging
+        EXPECT_TRUE(keychain.markAsUsed("151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR"));
+        keychain.discardUsedPaths();
+        EXPECT_TRUE(keychain.isEmpty());
+        EXPECT_EQ(keychain.getFreshAddress(BitcoinLikeKeychain::KeyPurpose::RECEIVE)->toBase58(), "151krzHgfkNoH3XHBzEVi6tSn4db7pVjmR");
+        EXPECT_TRUE(keychain.getPreferences()->getData("state", {}).empty());
+    });
+}
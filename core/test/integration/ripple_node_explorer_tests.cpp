@@ -0,0 +1,178 @@
+/*
+ *
+ * ripple_node_explorer_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "BaseFixture.h"
+#include <mutex>
+#include <api/HttpRequest.hpp>
+#include <wallet/ripple/rippleNetworks.h>
+#include <wallet/ripple/explorers/NodeRippleLikeBlockchainExplorer.h>
+#include <rapidjson/document.h>
+#include "FakeHttpClient.hpp"
+
+namespace {
+    const std::string ALICE = "rsvAf4P8Tx6tBUdWPNesMngXDmbZ2LMVF8";
+    const std::string BOB = "rMspb4Kxa3EwdF4uN5TMqhHfsAkBit6w7k";
+    constexpr int PAGES = 3;
+    constexpr int PAGE_SIZE = 2;
+
+    // The fake node answers account_tx with PAGES pages of PAGE_SIZE transactions per account. The marker of page p is
+    // {"ledger": p, "seq": p}; ledger indexes (which are also the block hashes) differ between accounts.
+    std::string hashOf(const std::string& account, int page, int index) {
+        return fmt::format("{}-{}-{}", account.substr(0, 4), page, index);
+    }
+
+    std::string pageJson(const std::string& account, int page) {
+        std::string transactions;
+        for (auto index = 0; index < PAGE_SIZE; index++) {
+            const auto ledger = (account == ALICE ? 1000 : 2000) + page * PAGE_SIZE + index;
+            transactions += fmt::format(
+                R"({}{{"meta":{{"TransactionResult":"tesSUCCESS"}},"tx":{{"Account":"{}","Amount":"1","Destination":"{}",)"
+                R"("Fee":"10","Sequence":1,"TransactionType":"Payment","date":600000000,"hash":"{}","ledger_index":{}}},"validated":true}})",
+                index == 0 ? "" : ",", account, account == ALICE ? BOB : ALICE, hashOf(account, page, index), ledger);
+        }
+        const auto marker = page + 1 < PAGES ? fmt::format(R"(,"marker":{{"ledger":{},"seq":{}}})", page + 1, page + 1) : "";
+        return fmt::format(R"({{"result":{{"account":"{}","transactions":[{}]{},"status":"success"}}}})", account, transactions, marker);
+    }
+
+    using Bulk = RippleLikeBlockchainExplorer::TransactionsBulk;
+
+    std::vector<std::string> hashesOf(const std::shared_ptr<Bulk>& bulk) {
+        std::vector<std::string> hashes;
+        for (const auto& tx : bulk->transactions) {
+            hashes.push_back(tx.hash);
+        }
+        return hashes;
+    }
+
+    std::vector<std::string> historyOf(const std::string& account) {
+        std::vector<std::string> hashes;
+        for (auto page = 0; page < PAGES; page++) {
+            for (auto index = 0; index < PAGE_SIZE; index++) {
+                hashes.push_back(hashOf(account, page, index));
+            }
+        }
+        return hashes;
+    }
+}
+
+class RippleNodeExplorerTest : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        node = std::make_shared<test::FakeHttpClient>();
+        node->route("", [this] (const std::shared_ptr<api::HttpRequest>& request) {
+            rapidjson::Document document;
+            document.Parse(test::FakeHttpClient::getBody(request).c_str());
+            const auto& params = document["params"][0];
+            const std::string account = params["account"].GetString();
+            const auto page = params.HasMember("marker") ? params["marker"]["ledger"].GetInt() : 0;
+            {
+                std::lock_guard<std::mutex> lock(requestsLock);
+                requests.push_back(fmt::format("{}#{}", account, page));
+            }
+            return Option<std::string>(pageJson(account, page));
+        });
+        auto context = dispatcher->getSerialExecutionContext("ripple-node-explorer");
+        explorer = std::make_shared<NodeRippleLikeBlockchainExplorer>(
+                context,
+                std::make_shared<HttpClient>("http://fake-node", node, context),
+                networks::getRippleLikeNetworkParameters("ripple"),
+                DynamicObject::newInstance());
+    }
+
+    // Pages through both accounts at once, each page of one account requested while the other one's is in flight
+    void pageConcurrently(const std::function<FuturePtr<Bulk> (const std::string&, const Option<std::string>&)>& getPage) {
+        std::map<std::string, std::vector<std::string>> received;
+        std::map<std::string, Option<std::string>> lastBlocks;
+        std::map<std::string, bool> done {{ALICE, false}, {BOB, false}};
+        while (!done[ALICE] || !done[BOB]) {
+            std::map<std::string, FuturePtr<Bulk>> pages;
+            for (const auto& account : {ALICE, BOB}) {
+                if (!done[account]) {
+                    pages.emplace(account, getPage(account, lastBlocks[account]));
+                }
+            }
+            for (auto& page : pages) {
+                auto bulk = wait(page.second);
+                auto hashes = hashesOf(bulk);
+                received[page.first].insert(received[page.first].end(), hashes.begin(), hashes.end());
+                lastBlocks[page.first] = bulk->transactions.back().block.getValue().hash;
+                done[page.first] = !bulk->hasNext;
+            }
+        }
+        EXPECT_EQ(received[ALICE], historyOf(ALICE));
+        EXPECT_EQ(received[BOB], historyOf(BOB));
+        // Every page was requested exactly once
+        EXPECT_EQ(requested().size(), 2 * PAGES);
+    }
+
+    // Account and page of every account_tx request, as "account#page"
+    std::vector<std::string> requested() {
+        std::lock_guard<std::mutex> lock(requestsLock);
+        return requests;
+    }
+
+    std::shared_ptr<test::FakeHttpClient> node;
+    std::mutex requestsLock;
+    std::vector<std::string> requests;
+    std::shared_ptr<NodeRippleLikeBlockchainExplorer> explorer;
+};
+
+TEST_F(RippleNodeExplorerTest, AccountsPageConcurrentlyWithTheirOwnSessions) {
+    auto aliceSession = wait(explorer->startSession());
+    auto bobSession = wait(explorer->startSession());
+    pageConcurrently([&] (const std::string& account, const Option<std::string>& fromBlockHash) {
+        return explorer->getTransactions({account}, fromBlockHash, account == ALICE ? aliceSession : bobSession);
+    });
+    wait(explorer->killSession(aliceSession));
+    wait(explorer->killSession(bobSession));
+}
+
+TEST_F(RippleNodeExplorerTest, AccountsPageConcurrentlyWithoutSession) {
+    pageConcurrently([&] (const std::string& account, const Option<std::string>& fromBlockHash) {
+        return explorer->getTransactions({account}, fromBlockHash, Option<void *>());
+    });
+}
+
+TEST_F(RippleNodeExplorerTest, SessionlessPagingReturnsOnePageAtATime) {
+    auto first = wait(explorer->getTransactions({ALICE}, Option<std::string>(), Option<void *>()));
+    EXPECT_TRUE(first->hasNext);
+    EXPECT_EQ(first->paginationMarker, "1-1");
+    EXPECT_EQ(first->transactions.size(), PAGE_SIZE);
+    EXPECT_EQ(requested(), std::vector<std::string>({ALICE + "#0"}));
+
+    // Asking from another block than the last one returned starts over
+    auto restarted = wait(explorer->getTransactions({ALICE}, Option<std::string>("42"), Option<void *>()));
+    EXPECT_EQ(hashesOf(restarted), hashesOf(first));
+    auto second = wait(explorer->getTransactions({ALICE}, restarted->transactions.back().block.getValue().hash, Option<void *>()));
+    EXPECT_EQ(second->transactions.front().hash, hashOf(ALICE, 1, 0));
+}
@@ -0,0 +1,195 @@
+/*
+ *
+ * erase_operations_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../BaseFixture.h"
+
+#include <fmt/format.h>
+
+#include <database/BulkDatabaseHelper.hpp>
+#include <database/soci-option.h>
+#include <wallet/bitcoin/database/BitcoinLikeTransactionDatabaseHelper.h>
+#include <wallet/common/database/AccountDatabaseHelper.h>
+
+namespace {
+    const std::string XPUB = "xpub6EedcbfDs3pkzgqvoRxTW6P8NcCSaVbMQsb6xwCdEBzqZBronwY3Nte1Vjunza8f6eSMrYvbM5CMihGo6SbzpHxn4R5pvcr2ZbZ6wkDmgpy";
+    // Operations removed by a single statement of AccountDatabaseHelper::eraseOperations
+    const size_t UIDS_PER_STATEMENT = BulkDatabaseHelper::MAX_BOUND_PARAMETERS - 1;
+}
+
+class EraseOperationsTests : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        pool = newDefaultPool();
+        newBitcoinAccount(pool, "my_wallet", "bitcoin", DynamicObject::newInstance(), 0, XPUB);
+
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        sql << "SELECT uid, wallet_uid FROM accounts", soci::into(accountUid), soci::into(walletUid);
+        sql << "INSERT INTO blocks VALUES('block', 'block', 1, '2020-01-01T00:00:00Z', 'bitcoin')";
+    }
+
+    void TearDown() override {
+        pool.reset();
+        BaseFixture::TearDown();
+    }
+
+    int count(soci::session &sql, const std::string &table) {
+        int result = 0;
+        sql << "SELECT COUNT(*) FROM " + table, soci::into(result);
+        return result;
+    }
+
+    // A transaction with one input, one output and one operation of the account, confirmed or in mempool
+    std::string putTransaction(soci::session &sql, const std::string &name, bool confirmed) {
+        return putTransaction(sql, name, confirmed, accountUid);
+    }
+
+    std::string putTransaction(soci::session &sql, const std::string &name, bool confirmed,
+                               const std::string &operationAccountUid) {
+        auto transactionUid = "transaction-" + name;
+        auto inputUid = "input-" + name;
+        auto operationUid = "operation-" + name;
+        Option<std::string> blockUid;
+        if (confirmed) {
+            blockUid = std::string("block");
+        }
+        sql << "INSERT INTO bitcoin_transactions(transaction_uid, hash, version, block_uid, time, locktime) "
+               "VALUES(:uid, :hash, 1, :block_uid, '2020-01-01T00:00:00Z', 0)",
+                soci::use(transactionUid), soci::use(transactionUid), soci::use(blockUid);
+        sql << "INSERT INTO bitcoin_inputs(uid, previous_output_idx, previous_tx_hash, amount, address, sequence) "
+               "VALUES(:uid, 0, :hash, 1000, 'address', 0)", soci::use(inputUid), soci::use(transactionUid);
+        sql << "INSERT INTO bitcoin_transaction_inputs(transaction_uid, transaction_hash, input_uid, input_idx) "
+               "VALUES(:uid, :hash, :input_uid, 0)",
+                soci::use(transactionUid), soci::use(transactionUid), soci::use(inputUid);
+        sql << "INSERT INTO bitcoin_outputs(idx, transaction_uid, transaction_hash, amount, script, address, account_uid) "
+               "VALUES(0, :uid, :hash, 1000, '', 'address', :account_uid)",
+                soci::use(transactionUid), soci::use(transactionUid), soci::use(operationAccountUid);
+        sql << "INSERT INTO operations(uid, account_uid, wallet_uid, type, date, senders, recipients, amount, fees, block_uid, currency_name, trust) "
+               "VALUES(:uid, :account_uid, :wallet_uid, 'RECEIVE', '2020-01-01T00:00:00Z', '', '', '1000', '0', :block_uid, 'bitcoin', '')",
+                soci::use(operationUid), soci::use(operationAccountUid), soci::use(walletUid), soci::use(blockUid);
+        sql << "INSERT INTO bitcoin_operations(uid, transaction_uid, transaction_hash) VALUES(:uid, :transaction_uid, :hash)",
+                soci::use(operationUid), soci::use(transactionUid), soci::use(transactionUid);
+        return operationUid;
+    }
+
+    std::shared_ptr<WalletPool> pool;
+    std::string accountUid;
+    std::string walletUid;
+};
+
+TEST_F(EraseOperationsTests, EraseOperationsAcrossStatements) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    const int total = 2 * UIDS_PER_STATEMENT + 2;
+    std::vector<std::string> uids;
+    {
+        soci::transaction tr(sql);
+        for (int index = 0; index < total; index++) {
+            uids.push_back(putTransaction(sql, std::to_string(index), true));
+        }
+        tr.commit();
+    }
+    auto slice = [&] (size_t from, size_t to) {
+        return std::vector<std::string>(uids.begin() + from, uids.begin() + to);
+    };
+
+    // Uids of another account are left untouched
+    AccountDatabaseHelper::eraseOperations(sql, "another_account", uids);
+    EXPECT_EQ(count(sql, "operations"), total);
+
+    // Exactly one statement
+    AccountDatabaseHelper::eraseOperations(sql, accountUid, slice(0, UIDS_PER_STATEMENT));
+    EXPECT_EQ(count(sql, "operations"), total - UIDS_PER_STATEMENT);
+
+    // One uid over a statement
+    AccountDatabaseHelper::eraseOperations(sql, accountUid, slice(UIDS_PER_STATEMENT, 2 * UIDS_PER_STATEMENT + 1));
+    EXPECT_EQ(count(sql, "operations"), 1);
+    EXPECT_EQ(count(sql, "bitcoin_operations"), 1);
+
+    // Already erased uids are ignored, the last operation is removed by the third statement
+    AccountDatabaseHelper::eraseOperations(sql, accountUid, uids);
+    EXPECT_EQ(count(sql, "operations"), 0);
+    EXPECT_EQ(count(sql, "bitcoin_operations"), 0);
+
+    AccountDatabaseHelper::eraseOperations(sql, accountUid, {});
+    EXPECT_EQ(count(sql, "bitcoin_transactions"), total);
+}
+
+TEST_F(EraseOperationsTests, RemoveAllMempoolOperation) {
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    for (int index = 0; index < 3; index++) {
+        putTransaction(sql, fmt::format("confirmed-{}", index), true);
+    }
+    for (int index = 0; index < 2; index++) {
+        putTransaction(sql, fmt::format("mempool-{}", index), false);
+    }
+
+    BitcoinLikeTransactionDatabaseHelper::removeAllMempoolOperation(sql, accountUid);
+
+    EXPECT_EQ(count(sql, "operations"), 3);
+    EXPECT_EQ(count(sql, "bitcoin_operations"), 3);
+    EXPECT_EQ(count(sql, "bitcoin_transactions"), 3);
+    EXPECT_EQ(count(sql, "bitcoin_inputs"), 3);
+    EXPECT_EQ(count(sql, "bitcoin_transaction_inputs"), 3);
+    EXPECT_EQ(count(sql, "bitcoin_outputs"), 3);
+    EXPECT_EQ(count(sql, "blocks"), 1);
+    int mempool = 0;
+    sql << "SELECT COUNT(*) FROM operations WHERE block_uid IS NULL", soci::into(mempool);
+    EXPECT_EQ(mempool, 0);
+
+    // Nothing left to remove
+    BitcoinLikeTransactionDatabaseHelper::removeAllMempoolOperation(sql, accountUid);
+    EXPECT_EQ(count(sql, "operations"), 3);
+}
+
+TEST_F(EraseOperationsTests, RemoveAllMempoolOperationKeepsOtherAccounts) {
+    createAccount(pool, "my_wallet", 1);
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    std::string otherAccountUid;
+    sql << "SELECT uid FROM accounts WHERE idx = 1", soci::into(otherAccountUid);
+
+    putTransaction(sql, "mempool", false);
+    putTransaction(sql, "other-mempool", false, otherAccountUid);
+    // A mempool transaction of the other account whose operation is not written yet
+    sql << "INSERT INTO bitcoin_transactions(transaction_uid, hash, version, time, locktime) "
+           "VALUES('transaction-other-pending', 'transaction-other-pending', 1, '2020-01-01T00:00:00Z', 0)";
+
+    BitcoinLikeTransactionDatabaseHelper::removeAllMempoolOperation(sql, accountUid);
+
+    EXPECT_EQ(count(sql, "operations"), 1);
+    EXPECT_EQ(count(sql, "bitcoin_transactions"), 2);
+    EXPECT_EQ(count(sql, "bitcoin_inputs"), 1);
+    int remaining = 0;
+    sql << "SELECT COUNT(*) FROM operations WHERE account_uid = :uid", soci::use(otherAccountUid), soci::into(remaining);
+    EXPECT_EQ(remaining, 1);
+    sql << "SELECT COUNT(*) FROM bitcoin_transactions WHERE transaction_uid = 'transaction-other-pending'",
+            soci::into(remaining);
+    EXPECT_EQ(remaining, 1);
+}
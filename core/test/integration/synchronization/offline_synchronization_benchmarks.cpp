@@ -0,0 +1,515 @@
+/*
+ *
+ * offline_synchronization_benchmarks
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <UvThreadDispatcher.hpp>
+#include <gtest/gtest.h>
+#include "../BaseFixture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <api/Configuration.hpp>
+#include <api/PoolConfiguration.hpp>
+#include <database/BulkDatabaseHelper.hpp>
+#include <test/cosmos/Fixtures.hpp>
+#include <utils/hex.h>
+#include "ExplorerStorage.hpp"
+#include "FakeHttpClient.hpp"
+#include "GaiaExplorerStorage.hpp"
+#include "HttpClientOnFakeExplorer.hpp"
+#include "HttpClientOnFakeGaia.hpp"
+#include "SyntheticBitcoinChain.hpp"
+#include "SyntheticCosmosChain.hpp"
+#include "SyntheticEthereumChain.hpp"
+
+namespace {
+    // Account xpubs of distinct seeds, one per synchronized account
+    const std::vector<std::string> ACCOUNT_XPUBS = {
+        "xpub6D4waFVPfPCpRvPkQd9A6n65z3hTp6TvkjnBHG5j2MCKytMuadKgfTUHqwRH77GQqCKTTsUXSZzGYxMGpWpJBdYAYVH75x7yMnwJvra1BUJ",
+        "xpub6CThYZbX4PTeA7KRYZ8YXP3F6HwT2eVKPQap3Avieds3p1eos35UzSsJtTbJ3vQ8d3fjRwk4bCEz4m4H6mkFW49q29ZZ6gS8tvahs4WCZ9X",
+        "xpub6EedcbfDs3pkzgqvoRxTW6P8NcCSaVbMQsb6xwCdEBzqZBronwY3Nte1Vjunza8f6eSMrYvbM5CMihGo6SbzpHxn4R5pvcr2ZbZ6wkDmgpy"
+    };
+
+    // Compressed public keys of distinct Cosmos accounts, one per synchronized account
+    const std::vector<std::string> COSMOS_PUBLIC_KEYS = {
+        "03d672c1b90c84d9d97522e9a73252a432b77d90a78bf81cdbe35270d9d3dc1c34",
+        "03175B1A69FC4A7C4047A12BC2BD32F144F29CA6C1DE65A2486DEDE55EFA472E4B",
+        "038665FEF8CCDC37B367E90ECE899C8689FA4225FC38F2EE3F60A637F9DD96C47A"
+    };
+
+    // Account keys of distinct Ethereum addresses, one per synchronized account
+    std::vector<api::AccountCreationInfo> getEthereumAccountKeys() {
+        return {ETH_KEYS_INFO_LIVE, ETH_KEYS_INFO, ETH_KEYS_INFO_VAULT};
+    }
+
+    // Keys are provided for that many accounts of each coin
+    const uint32_t MAX_ACCOUNTS = 3;
+    const std::string WALLET_NAME = "7c0a5cd5-3a5b-4bd4-a7e1-b7b1d1c2a0f4";
+
+    enum class BenchmarkCoin {
+        BITCOIN,
+        ETHEREUM,
+        COSMOS
+    };
+
+    struct BenchmarkParameters {
+        BenchmarkCoin coin = BenchmarkCoin::BITCOIN;
+        uint32_t accounts;
+        // Owned addresses per Bitcoin account, receive and change addresses included. Ethereum and
+        // Cosmos accounts have a single address.
+        uint32_t addressesPerAccount;
+        test::SyntheticChainParameters chain;
+    };
+
+    // Synchronized accounts, their chains being published to the fake explorer
+    struct Scenario {
+        std::vector<std::shared_ptr<AbstractAccount>> accounts;
+        // Operations of each account once synchronized
+        std::vector<size_t> operations;
+        // Reorganizes the published chains and returns the number of replaced blocks, empty when
+        // the explorer can't serve a reorganization
+        std::function<uint32_t ()> reorganize;
+    };
+
+    // Times the transactions requests of the synchronizers. The pages of an address set are requested
+    // one after the other by a single synchronizer, and the sets of concurrently synchronized accounts
+    // never overlap, so the interval between two requests of the same set is the latency of a batch:
+    // parsing the page, writing it and asking for the next one. The last page of a set is not timed
+    // since its synchronizer goes on with another set. Gaia searches fetch their next pages
+    // concurrently, so only their first page is timed, keyed by the address filter.
+    class BatchTimer {
+    public:
+        void record(const std::shared_ptr<api::HttpRequest> &request) {
+            auto batch = getBatch(request->getUrl());
+            if (!batch.empty()) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _requests[batch].push_back(std::chrono::steady_clock::now());
+            }
+        }
+
+        void reset() {
+            std::lock_guard<std::mutex> lock(_lock);
+            _requests.clear();
+        }
+
+        size_t getRequestsCount() {
+            std::lock_guard<std::mutex> lock(_lock);
+            size_t count = 0;
+            for (const auto &requests : _requests) {
+                count += requests.second.size();
+            }
+            return count;
+        }
+
+        std::vector<double> getBatchLatencies() {
+            std::lock_guard<std::mutex> lock(_lock);
+            std::vector<double> latencies;
+            for (const auto &requests : _requests) {
+                for (size_t index = 1; index < requests.second.size(); index++) {
+                    auto latency = requests.second[index] - requests.second[index - 1];
+                    latencies.push_back(std::chrono::duration<double, std::milli>(latency).count());
+                }
+            }
+            std::sort(latencies.begin(), latencies.end());
+            return latencies;
+        }
+
+    private:
+        // The address set of a transactions request, or the address filter of the first page of a Gaia
+        // search, empty for the other requests
+        std::string getBatch(const std::string &url) const {
+            auto path = url.substr(0, url.find('?'));
+            auto begin = path.find(ADDRESSES_PATH);
+            if (begin != std::string::npos && path.find("/transactions", begin) != std::string::npos) {
+                begin += ADDRESSES_PATH.size();
+                return path.substr(begin, path.find('/', begin) - begin);
+            }
+            if (boost::algorithm::ends_with(path, GAIA_TRANSACTIONS_PATH) &&
+                test::FakeHttpClient::getQueryParameter(url, "page").getValueOr("") == "1") {
+                for (const auto &filter : GAIA_ADDRESS_FILTERS) {
+                    auto address = test::FakeHttpClient::getQueryParameter(url, filter);
+                    if (address.hasValue()) {
+                        return filter + "=" + address.getValue();
+                    }
+                }
+            }
+            return "";
+        }
+
+        const std::string ADDRESSES_PATH = "/addresses/";
+        const std::string GAIA_TRANSACTIONS_PATH = "/txs";
+        const std::vector<std::string> GAIA_ADDRESS_FILTERS = {"message.sender", "transfer.recipient"};
+        std::mutex _lock;
+        // Request times by comma separated address set or Gaia address filter
+        std::unordered_map<std::string, std::vector<std::chrono::steady_clock::time_point>> _requests;
+    };
+
+    double percentile(const std::vector<double> &sorted, double rank) {
+        if (sorted.empty()) {
+            return 0;
+        }
+        auto index = static_cast<size_t>(std::ceil(rank * sorted.size()));
+        return sorted[std::min(sorted.size() - 1, index > 0 ? index - 1 : 0)];
+    }
+
+    long getPeakResidentSetKiB() {
+#ifndef _WIN32
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+    #ifdef __APPLE__
+        return usage.ru_maxrss / 1024;
+    #else
+        return usage.ru_maxrss;
+    #endif
+#else
+        return 0;
+#endif
+    }
+}
+
+// Synchronization throughput on generated chains served by in-process fake explorers, without any
+// network access. Each scenario runs on SQLite, and on PostgreSQL as well when built with PG_SUPPORT.
+// Bitcoin and Ethereum chains are served through the Ledger API routes, Cosmos ones through the Gaia
+// routes; Gaia gives no way to detect a reorganization, so Cosmos scenarios don't reorganize.
+class OfflineSynchronizationBenchmarks : public BaseFixture {
+public:
+    void TearDown() override {
+        BaseFixture::TearDown();
+        explorer = nullptr;
+        gaia = nullptr;
+        http = nullptr;
+    }
+
+    // Serves the fake explorer of the coin and times the transactions requests
+    std::shared_ptr<test::FakeHttpClient> newHttpClient(BenchmarkCoin coin) {
+        auto client = std::make_shared<test::FakeHttpClient>();
+        if (coin == BenchmarkCoin::COSMOS) {
+            client->setFallback(std::make_shared<test::HttpClientOnFakeGaia>(gaia));
+        } else {
+            client->setFallback(std::make_shared<test::HttpClientOnFakeExplorer>(explorer));
+        }
+        client->setObserver([this] (const std::shared_ptr<api::HttpRequest> &request) {
+            timer.record(request);
+        });
+        return client;
+    }
+
+    std::shared_ptr<WalletPool> newBenchmarkPool(bool usePostgreSQL) {
+        auto configuration = api::DynamicObject::newInstance();
+        backend = std::static_pointer_cast<DatabaseBackend>(DatabaseBackend::getSqlite3Backend());
+#ifdef PG_SUPPORT
+        if (usePostgreSQL) {
+            configuration->putString(api::PoolConfiguration::DATABASE_NAME, "postgres://localhost:5432/test_db");
+            backend = std::static_pointer_cast<DatabaseBackend>(
+                    DatabaseBackend::getPostgreSQLBackend(api::ConfigurationDefaults::DEFAULT_PG_CONNECTION_POOL_SIZE));
+        }
+#endif
+        auto uvDispatcher = uv::createDispatcher();
+        printer = std::make_shared<CoutLogPrinter>(uvDispatcher->getMainExecutionContext());
+        return WalletPool::newInstance(
+                "offline_benchmark",
+                "",
+                http,
+                nullptr,
+                resolver,
+                printer,
+                uvDispatcher,
+                rng,
+                backend,
+                configuration,
+                nullptr,
+                nullptr
+        );
+    }
+
+    void synchronize(const std::vector<std::shared_ptr<AbstractAccount>> &accounts) {
+        std::vector<Future<Unit>> done;
+        for (const auto &account : accounts) {
+            Promise<Unit> promise;
+            done.push_back(promise.getFuture());
+            account->synchronize()->subscribe(dispatcher->getSerialExecutionContext("worker"),
+                    make_receiver([=] (const std::shared_ptr<api::Event> &event) mutable {
+                        if (event->getCode() == api::EventCode::SYNCHRONIZATION_STARTED) {
+                            return;
+                        }
+                        EXPECT_NE(event->getCode(), api::EventCode::SYNCHRONIZATION_FAILED);
+                        promise.success(unit);
+                    }));
+        }
+        for (auto &future : done) {
+            uv::wait(future);
+        }
+    }
+
+    void report(const std::string &name, const std::shared_ptr<WalletPool> &pool,
+                std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+        auto latencies = timer.getBatchLatencies();
+        std::chrono::duration<double> duration = end - start;
+
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        int operations = 0;
+        sql << "SELECT COUNT(*) FROM operations", soci::into(operations);
+        long long databaseSize = 0;
+        if (BulkDatabaseHelper::isPostgreSQL(sql)) {
+            sql << "SELECT pg_database_size(current_database())", soci::into(databaseSize);
+        } else {
+            long long pageCount = 0, pageSize = 0;
+            sql << "PRAGMA page_count", soci::into(pageCount);
+            sql << "PRAGMA page_size", soci::into(pageSize);
+            databaseSize = pageCount * pageSize;
+        }
+
+        std::cout << fmt::format("[{} on {}] {} operations in {:.3f} s ({:.0f} operations/s), {} batches, "
+                                 "{} timed (p50 {:.1f} ms, p99 {:.1f} ms), database {:.1f} MiB, peak RSS {:.1f} MiB",
+                                 name, sql.get_backend_name(), operations, duration.count(),
+                                 operations / duration.count(), timer.getRequestsCount(), latencies.size(),
+                                 percentile(latencies, 0.5), percentile(latencies, 0.99),
+                                 databaseSize / (1024.0 * 1024.0), getPeakResidentSetKiB() / 1024.0)
+                  << std::endl;
+    }
+
+    void expectOperations(const std::shared_ptr<WalletPool> &pool, const Scenario &scenario) {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        for (size_t index = 0; index < scenario.accounts.size(); index++) {
+            auto accountUid = scenario.accounts[index]->getAccountUid();
+            int operations = 0;
+            sql << "SELECT COUNT(*) FROM operations WHERE account_uid = :uid", soci::use(accountUid), soci::into(operations);
+            EXPECT_EQ(static_cast<size_t>(operations), scenario.operations[index]) << "account " << index;
+        }
+    }
+
+    test::SyntheticChainParameters getChainParameters(const BenchmarkParameters &parameters, uint32_t account) {
+        auto chainParameters = parameters.chain;
+        chainParameters.seed += account;
+        return chainParameters;
+    }
+
+    Scenario newBitcoinScenario(const std::shared_ptr<WalletPool> &pool, const BenchmarkParameters &parameters) {
+        auto wallet = wait(pool->createWallet(WALLET_NAME, "bitcoin", api::DynamicObject::newInstance()));
+        auto chains = std::make_shared<std::vector<test::SyntheticBitcoinChain>>();
+        Scenario scenario;
+        for (uint32_t index = 0; index < parameters.accounts; index++) {
+            api::ExtendedKeyAccountCreationInfo info(index, {"main"}, {fmt::format("44'/0'/{}'", index)}, {ACCOUNT_XPUBS[index]});
+            auto account = createBitcoinLikeAccount(wallet, index, info);
+            std::vector<std::string> addresses;
+            auto halfCount = std::max<uint32_t>(1, parameters.addressesPerAccount / 2);
+            for (const auto &address : account->getKeychain()->getAllObservableAddresses(0, halfCount - 1)) {
+                addresses.push_back(address->toString());
+            }
+            chains->emplace_back(getChainParameters(parameters, index), addresses);
+            chains->back().publish(*explorer);
+            scenario.accounts.push_back(account);
+            // Every generated transaction is one operation of its account
+            scenario.operations.push_back(chains->back().getTransactionsCount());
+        }
+        auto storage = explorer;
+        scenario.reorganize = [chains, storage] () {
+            uint32_t depth = 0;
+            for (auto &chain : *chains) {
+                depth = std::max(depth, chain.reorganize(*storage));
+            }
+            return depth;
+        };
+        return scenario;
+    }
+
+    Scenario newEthereumScenario(const std::shared_ptr<WalletPool> &pool, const BenchmarkParameters &parameters) {
+        auto configuration = api::DynamicObject::newInstance();
+        configuration->putString(api::Configuration::KEYCHAIN_DERIVATION_SCHEME, "44'/60'/0'/0/<account>'");
+        auto wallet = wait(pool->createWallet(WALLET_NAME, "ethereum", configuration));
+        auto keys = getEthereumAccountKeys();
+        auto chains = std::make_shared<std::vector<test::SyntheticEthereumChain>>();
+        Scenario scenario;
+        for (uint32_t index = 0; index < parameters.accounts; index++) {
+            auto info = keys[index];
+            info.index = index;
+            auto account = std::dynamic_pointer_cast<EthereumLikeAccount>(wait(wallet->newAccountWithInfo(info)));
+            chains->emplace_back(getChainParameters(parameters, index), account->getKeychain()->getAddress()->toString());
+            chains->back().publish(*explorer);
+            scenario.accounts.push_back(account);
+            // Every generated transaction is one operation of its account
+            scenario.operations.push_back(chains->back().getTransactionsCount());
+        }
+        auto storage = explorer;
+        scenario.reorganize = [chains, storage] () {
+            uint32_t depth = 0;
+            for (auto &chain : *chains) {
+                depth = std::max(depth, chain.reorganize(*storage));
+            }
+            return depth;
+        };
+        return scenario;
+    }
+
+    Scenario newCosmosScenario(const std::shared_ptr<WalletPool> &pool, const BenchmarkParameters &parameters) {
+        auto configuration = api::DynamicObject::newInstance();
+        configuration->putString(api::Configuration::KEYCHAIN_DERIVATION_SCHEME, "44'/<coin_type>'/<account>'/<node>/<address>");
+        auto wallet = wait(pool->createWallet(WALLET_NAME, "cosmos", configuration));
+        Scenario scenario;
+        for (uint32_t index = 0; index < parameters.accounts; index++) {
+            auto info = wait(wallet->getNextAccountCreationInfo());
+            auto publicKey = hex::toByteArray(COSMOS_PUBLIC_KEYS[index]);
+            info.publicKeys.push_back(publicKey);
+            auto account = ledger::testing::cosmos::createCosmosLikeAccount(wallet, info.index, info);
+            test::SyntheticCosmosChain chain(getChainParameters(parameters, index), account->getAddress(), publicKey);
+            chain.publish(*gaia);
+            scenario.accounts.push_back(account);
+            scenario.operations.push_back(chain.getOperationsCount());
+        }
+        return scenario;
+    }
+
+    Scenario newScenario(const std::shared_ptr<WalletPool> &pool, const BenchmarkParameters &parameters) {
+        switch (parameters.coin) {
+            case BenchmarkCoin::ETHEREUM:
+                return newEthereumScenario(pool, parameters);
+            case BenchmarkCoin::COSMOS:
+                return newCosmosScenario(pool, parameters);
+            default:
+                return newBitcoinScenario(pool, parameters);
+        }
+    }
+
+    void run(const std::string &name, const BenchmarkParameters &parameters, bool usePostgreSQL) {
+        ASSERT_LE(parameters.accounts, MAX_ACCOUNTS);
+        explorer = std::make_shared<test::ExplorerStorage>();
+        gaia = std::make_shared<test::GaiaExplorerStorage>();
+        http = newHttpClient(parameters.coin);
+        auto pool = newBenchmarkPool(usePostgreSQL);
+        auto scenario = newScenario(pool, parameters);
+
+        timer.reset();
+        auto start = std::chrono::steady_clock::now();
+        synchronize(scenario.accounts);
+        auto end = std::chrono::steady_clock::now();
+        expectOperations(pool, scenario);
+        report(name, pool, start, end);
+
+        if (parameters.chain.reorganizationRate > 0) {
+            ASSERT_TRUE(static_cast<bool>(scenario.reorganize)) << "the chains of " << name << " can't be reorganized";
+            auto depth = scenario.reorganize();
+            timer.reset();
+            start = std::chrono::steady_clock::now();
+            synchronize(scenario.accounts);
+            end = std::chrono::steady_clock::now();
+            expectOperations(pool, scenario);
+            report(fmt::format("{} after a {} blocks reorganization", name, depth), pool, start, end);
+        }
+
+        uv::wait(pool->freshResetAll());
+    }
+
+    void run(const std::string &name, const BenchmarkParameters &parameters) {
+        run(name, parameters, false);
+#ifdef PG_SUPPORT
+        run(name, parameters, true);
+#endif
+    }
+
+    std::shared_ptr<test::ExplorerStorage> explorer;
+    std::shared_ptr<test::GaiaExplorerStorage> gaia;
+    std::shared_ptr<test::FakeHttpClient> http;
+    BatchTimer timer;
+};
+
+TEST_F(OfflineSynchronizationBenchmarks, BitcoinSmall) {
+    BenchmarkParameters parameters;
+    parameters.accounts = 1;
+    parameters.addressesPerAccount = 40;
+    parameters.chain.transactionsCount = 1000;
+    run("bitcoin small", parameters);
+}
+
+TEST_F(OfflineSynchronizationBenchmarks, BitcoinManyInputsAndOutputs) {
+    BenchmarkParameters parameters;
+    parameters.accounts = 1;
+    parameters.addressesPerAccount = 40;
+    parameters.chain.transactionsCount = 1000;
+    parameters.chain.inputsPerTransaction = 10;
+    parameters.chain.outputsPerTransaction = 10;
+    run("bitcoin 10 inputs 10 outputs", parameters);
+}
+
+TEST_F(OfflineSynchronizationBenchmarks, BitcoinMediumWithReorganization) {
+    BenchmarkParameters parameters;
+    parameters.accounts = 3;
+    parameters.addressesPerAccount = 100;
+    parameters.chain.transactionsCount = 5000;
+    parameters.chain.transactionsPerBlock = 20;
+    parameters.chain.reorganizationRate = 0.02;
+    run("bitcoin medium", parameters);
+}
+
+TEST_F(OfflineSynchronizationBenchmarks, EthereumSmall) {
+    BenchmarkParameters parameters;
+    parameters.coin = BenchmarkCoin::ETHEREUM;
+    parameters.accounts = 1;
+    parameters.chain.transactionsCount = 1000;
+    run("ethereum small", parameters);
+}
+
+TEST_F(OfflineSynchronizationBenchmarks, EthereumMediumWithTokensAndReorganization) {
+    BenchmarkParameters parameters;
+    parameters.coin = BenchmarkCoin::ETHEREUM;
+    parameters.accounts = 3;
+    parameters.chain.transactionsCount = 5000;
+    parameters.chain.transactionsPerBlock = 20;
+    parameters.chain.tokenTransferRate = 0.2;
+    parameters.chain.reorganizationRate = 0.02;
+    run("ethereum medium", parameters);
+}
+
+TEST_F(OfflineSynchronizationBenchmarks, CosmosSmall) {
+    BenchmarkParameters parameters;
+    parameters.coin = BenchmarkCoin::COSMOS;
+    parameters.accounts = 1;
+    parameters.chain.transactionsCount = 1000;
+    run("cosmos small", parameters);
+}
+
+// Several search bulks per account, the synchronizer resuming from the last height of each
+TEST_F(OfflineSynchronizationBenchmarks, CosmosMedium) {
+    BenchmarkParameters parameters;
+    parameters.coin = BenchmarkCoin::COSMOS;
+    parameters.accounts = 3;
+    parameters.chain.transactionsCount = 5000;
+    parameters.chain.transactionsPerBlock = 20;
+    run("cosmos medium", parameters);
+}
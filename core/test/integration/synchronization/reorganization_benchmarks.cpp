@@ -0,0 +1,155 @@
+/*
+ *
+ * reorganization_benchmarks
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../BaseFixture.h"
+
+#include <chrono>
+#include <iostream>
+
+#include <fmt/format.h>
+
+#include <utils/DateUtils.hpp>
+#include <wallet/bitcoin/BitcoinLikeAccount.hpp>
+#include <wallet/common/database/AccountDatabaseHelper.h>
+
+namespace {
+    const std::string XPUB = "xpub6EedcbfDs3pkzgqvoRxTW6P8NcCSaVbMQsb6xwCdEBzqZBronwY3Nte1Vjunza8f6eSMrYvbM5CMihGo6SbzpHxn4R5pvcr2ZbZ6wkDmgpy";
+    const int BLOCKS_COUNT = 2000;
+    const int TRANSACTIONS_PER_BLOCK = 10;
+
+    // One block per second
+    std::chrono::system_clock::time_point blockDate(long long height) {
+        return DateUtils::fromJSON("2020-01-01T00:00:00Z") + std::chrono::seconds(height);
+    }
+}
+
+class ReorganizationBenchmarks : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        pool = newDefaultPool();
+        newBitcoinAccount(pool, "my_wallet", "bitcoin", DynamicObject::newInstance(), 0, XPUB);
+
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        sql << "SELECT uid, wallet_uid FROM accounts", soci::into(accountUid), soci::into(walletUid);
+
+        // Synthetic history: every block carries transactions with one input, one output and one operation
+        soci::transaction tr(sql);
+        for (long long height = 0; height < BLOCKS_COUNT; height++) {
+            auto blockUid = fmt::format("block-{}", height);
+            auto date = DateUtils::toJSON(blockDate(height));
+            sql << "INSERT INTO blocks VALUES(:uid, :hash, :height, :time, 'bitcoin')",
+                    soci::use(blockUid), soci::use(blockUid), soci::use(height), soci::use(date);
+            for (int index = 0; index < TRANSACTIONS_PER_BLOCK; index++) {
+                auto transactionUid = fmt::format("transaction-{}-{}", height, index);
+                auto inputUid = fmt::format("input-{}-{}", height, index);
+                auto operationUid = fmt::format("operation-{}-{}", height, index);
+                sql << "INSERT INTO bitcoin_transactions(transaction_uid, hash, version, block_uid, time, locktime) "
+                       "VALUES(:uid, :hash, 1, :block_uid, :time, 0)",
+                        soci::use(transactionUid), soci::use(transactionUid), soci::use(blockUid), soci::use(date);
+                sql << "INSERT INTO bitcoin_inputs(uid, previous_output_idx, previous_tx_hash, amount, address, sequence) "
+                       "VALUES(:uid, 0, :hash, 1000, 'address', 0)", soci::use(inputUid), soci::use(transactionUid);
+                sql << "INSERT INTO bitcoin_transaction_inputs(transaction_uid, transaction_hash, input_uid, input_idx) "
+                       "VALUES(:uid, :hash, :input_uid, 0)",
+                        soci::use(transactionUid), soci::use(transactionUid), soci::use(inputUid);
+                sql << "INSERT INTO bitcoin_outputs(idx, transaction_uid, transaction_hash, amount, script, address, account_uid, block_height) "
+                       "VALUES(0, :uid, :hash, 1000, '', 'address', :account_uid, :height)",
+                        soci::use(transactionUid), soci::use(transactionUid), soci::use(accountUid), soci::use(height);
+                sql << "INSERT INTO operations(uid, account_uid, wallet_uid, type, date, senders, recipients, amount, fees, block_uid, currency_name, trust) "
+                       "VALUES(:uid, :account_uid, :wallet_uid, 'RECEIVE', :date, '', '', '1000', '0', :block_uid, 'bitcoin', '')",
+                        soci::use(operationUid), soci::use(accountUid), soci::use(walletUid), soci::use(date), soci::use(blockUid);
+                sql << "INSERT INTO bitcoin_operations(uid, transaction_uid, transaction_hash) VALUES(:uid, :transaction_uid, :hash)",
+                        soci::use(operationUid), soci::use(transactionUid), soci::use(transactionUid);
+            }
+        }
+        tr.commit();
+    }
+
+    void TearDown() override {
+        pool.reset();
+        BaseFixture::TearDown();
+    }
+
+    int count(soci::session &sql, const std::string &table) {
+        int result = 0;
+        sql << "SELECT COUNT(*) FROM " + table, soci::into(result);
+        return result;
+    }
+
+    void reorganize(int depth) {
+        soci::session sql(pool->getDatabaseSessionPool()->getPool());
+        auto start = std::chrono::steady_clock::now();
+        {
+            soci::transaction tr(sql);
+            AccountDatabaseHelper::eraseBlocksFromHeight(sql, "bitcoin", BLOCKS_COUNT - depth);
+            tr.commit();
+        }
+        std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start;
+        std::cout << "Reorganization of depth " << depth << " over " << BLOCKS_COUNT * TRANSACTIONS_PER_BLOCK
+                  << " operations: " << diff.count() << " s" << std::endl;
+
+        auto remaining = (BLOCKS_COUNT - depth) * TRANSACTIONS_PER_BLOCK;
+        EXPECT_EQ(count(sql, "blocks"), BLOCKS_COUNT - depth);
+        EXPECT_EQ(count(sql, "operations"), remaining);
+        EXPECT_EQ(count(sql, "bitcoin_operations"), remaining);
+        EXPECT_EQ(count(sql, "bitcoin_transactions"), remaining);
+        EXPECT_EQ(count(sql, "bitcoin_inputs"), remaining);
+        EXPECT_EQ(count(sql, "bitcoin_transaction_inputs"), remaining);
+        EXPECT_EQ(count(sql, "bitcoin_outputs"), remaining);
+    }
+
+    std::shared_ptr<WalletPool> pool;
+    std::string accountUid;
+    std::string walletUid;
+};
+
+TEST_F(ReorganizationBenchmarks, DepthOne) {
+    reorganize(1);
+}
+
+TEST_F(ReorganizationBenchmarks, DepthSix) {
+    reorganize(6);
+}
+
+TEST_F(ReorganizationBenchmarks, DepthHundred) {
+    reorganize(100);
+}
+
+TEST_F(ReorganizationBenchmarks, EraseOperationsSinceDate) {
+    auto wallet = wait(pool->getWallet("my_wallet"));
+    auto account = std::dynamic_pointer_cast<BitcoinLikeAccount>(wait(wallet->getAccount(0)));
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(wait(account->eraseDataSince(blockDate(BLOCKS_COUNT - 100))), api::ErrorCode::FUTURE_WAS_SUCCESSFULL);
+    std::chrono::duration<double> diff = std::chrono::steady_clock::now() - start;
+    std::cout << "Erase of 100 blocks of operations by date: " << diff.count() << " s" << std::endl;
+    soci::session sql(pool->getDatabaseSessionPool()->getPool());
+    EXPECT_EQ(count(sql, "operations"), (BLOCKS_COUNT - 100) * TRANSACTIONS_PER_BLOCK);
+}
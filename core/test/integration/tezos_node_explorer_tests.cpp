@@ -0,0 +1,171 @@
+/*
+ *
+ * tezos_node_explorer_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "BaseFixture.h"
+#include <mutex>
+#include <set>
+#include <wallet/tezos/tezosNetworks.h>
+#include <wallet/tezos/explorers/NodeTezosLikeBlockchainExplorer.h>
+#include "FakeHttpClient.hpp"
+
+namespace {
+    const std::string ADDRESS = "tz1TRspM5SeZpaQUhzByXbEvqKF1vnCM2YTK";
+
+    // Operations of each type, by block height, and the size of the pages the fake node returns them in. The
+    // types are truncated at different blocks so that the merged pages stop before some of their operations.
+    struct TypeHistory {
+        std::vector<int> heights;
+        size_t pageSize;
+    };
+    const std::map<std::string, TypeHistory> HISTORIES {
+        {"Transaction", {{10, 20, 30, 40, 50, 60}, 2}},
+        {"Reveal", {{5}, 5}},
+        {"Origination", {{15, 25, 35, 45, 55, 65, 75}, 3}}
+    };
+
+    std::string hashOf(const std::string& type, int height) {
+        return fmt::format("{}-{}", type, height);
+    }
+
+    // Operations of type after the block of hash fromBlockHash ("block_<height>"), or from the first one
+    std::string pageJson(const std::string& type, const std::string& fromBlockHash) {
+        const auto& history = HISTORIES.at(type);
+        const auto from = fromBlockHash.empty() ? 0 : std::stoi(fromBlockHash.substr(fromBlockHash.find('_') + 1));
+        auto first = std::upper_bound(history.heights.begin(), history.heights.end(), from);
+        auto last = first + std::min<size_t>(history.pageSize, history.heights.end() - first);
+        std::string ops;
+        for (auto it = first; it != last; it++) {
+            ops += fmt::format(
+                R"({}{{"hash":"{}","block_hash":"block_{}","op_level":{},"type":"{}","time":"2020-01-01T00:00:00Z",)"
+                R"("sender":"{}","receiver":"{}","amount":"1","fee":"1"}})",
+                it == first ? "" : ",", hashOf(type, *it), *it, *it, type, ADDRESS, ADDRESS);
+        }
+        return fmt::format(R"({{"ops":[{}],"truncated":{}}})", ops, last != history.heights.end() ? "true" : "false");
+    }
+
+    std::set<std::string> historyOf() {
+        std::set<std::string> hashes;
+        for (const auto& history : HISTORIES) {
+            for (auto height : history.second.heights) {
+                hashes.insert(hashOf(history.first, height));
+            }
+        }
+        return hashes;
+    }
+
+    using Bulk = TezosLikeBlockchainExplorer::TransactionsBulk;
+}
+
+class TezosNodeExplorerTest : public BaseFixture {
+public:
+    void SetUp() override {
+        BaseFixture::SetUp();
+        node = std::make_shared<test::FakeHttpClient>();
+        node->route("/operations/", [this] (const std::shared_ptr<api::HttpRequest>& request) {
+            const auto type = test::FakeHttpClient::getQueryParameter(request->getUrl(), "type").getValue();
+            const auto fromBlockHash = test::FakeHttpClient::getQueryParameter(request->getUrl(), "block_hash").getValueOr("");
+            {
+                std::lock_guard<std::mutex> lock(requestsLock);
+                requests[type] += 1;
+            }
+            return Option<std::string>(pageJson(type, fromBlockHash));
+        });
+        auto context = dispatcher->getSerialExecutionContext("tezos-node-explorer");
+        explorer = std::make_shared<NodeTezosLikeBlockchainExplorer>(
+                context,
+                std::make_shared<HttpClient>("http://fake-node", node, context),
+                networks::getTezosLikeNetworkParameters("tezos"),
+                DynamicObject::newInstance());
+    }
+
+    // Pages through the whole history the way the synchronizer does, returning the hashes of every page
+    std::vector<std::string> pageThrough(const Option<void *>& session) {
+        std::vector<std::string> received;
+        Option<std::string> fromBlockHash;
+        std::shared_ptr<Bulk> bulk;
+        do {
+            bulk = wait(explorer->getTransactions({ADDRESS}, fromBlockHash, session));
+            for (const auto& tx : bulk->transactions) {
+                received.push_back(tx.hash);
+            }
+            auto lastBlock = bulk->resumeBlock.nonEmpty() ? bulk->resumeBlock : bulk->transactions.back().block;
+            fromBlockHash = lastBlock.getValue().hash;
+        } while (bulk->hasNext);
+        return received;
+    }
+
+    // Number of operations requests by type
+    std::map<std::string, int> requested() {
+        std::lock_guard<std::mutex> lock(requestsLock);
+        return requests;
+    }
+
+    std::shared_ptr<test::FakeHttpClient> node;
+    std::mutex requestsLock;
+    std::map<std::string, int> requests;
+    std::shared_ptr<NodeTezosLikeBlockchainExplorer> explorer;
+};
+
+TEST_F(TezosNodeExplorerTest, TypesResumeFromTheirOwnCursorWithinASession) {
+    auto session = wait(explorer->startSession());
+    auto received = pageThrough(session);
+    wait(explorer->killSession(session));
+
+    // Every operation is returned exactly once, and every page of a type is requested once
+    EXPECT_EQ(received.size(), historyOf().size());
+    EXPECT_EQ(std::set<std::string>(received.begin(), received.end()), historyOf());
+    EXPECT_EQ(requested(), (std::map<std::string, int> {{"Transaction", 3}, {"Reveal", 1}, {"Origination", 3}}));
+}
+
+TEST_F(TezosNodeExplorerTest, TypesResumeFromTheMergedBlockWithoutSession) {
+    auto received = pageThrough(Option<void *>());
+
+    // Operations past the merged block are asked again, none is missed
+    EXPECT_GT(received.size(), historyOf().size());
+    EXPECT_EQ(std::set<std::string>(received.begin(), received.end()), historyOf());
+}
+
+TEST_F(TezosNodeExplorerTest, AskingFromAnotherBlockStartsEveryTypeOver) {
+    auto session = wait(explorer->startSession());
+    auto first = wait(explorer->getTransactions({ADDRESS}, Option<std::string>(), session));
+    EXPECT_TRUE(first->hasNext);
+    EXPECT_EQ(first->resumeBlock.getValue().hash, "block_20");
+
+    auto restarted = wait(explorer->getTransactions({ADDRESS}, Option<std::string>("block_30"), session));
+    std::vector<std::string> hashes;
+    for (const auto& tx : restarted->transactions) {
+        hashes.push_back(tx.hash);
+    }
+    EXPECT_EQ(hashes, std::vector<std::string>({"Origination-35", "Transaction-40", "Origination-45",
+                                                "Transaction-50", "Origination-55"}));
+    wait(explorer->killSession(session));
+}
@@ -0,0 +1,69 @@
+/*
+ *
+ * raw_transaction_benchmarks
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <SyntheticBitcoinTransactions.hpp>
+#include <wallet/bitcoin/api_impl/BitcoinLikeRawTransactionView.h>
+#include <wallet/bitcoin/api_impl/BitcoinLikeTransactionApi.h>
+#include <wallet/currencies.hpp>
+
+using namespace ledger::core;
+using namespace ledger::core::test;
+
+// Compares the raw transaction view to the full parse on a large consolidation. Timings only, not
+// registered with ctest.
+TEST(RawTransactionBenchmarks, Consolidation) {
+    const size_t inputsCount = 2000;
+    const int rounds = 20;
+    auto rawTx = createConsolidation(inputsCount);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t parsedInputs = 0;
+    for (int i = 0; i < rounds; i++) {
+        BitcoinLikeRawTransactionView view(currencies::BITCOIN, rawTx, 0, true);
+        parsedInputs += view.getInputs().size();
+    }
+    auto viewDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        parsedInputs += BitcoinLikeTransactionApi::parseRawSignedTransaction(currencies::BITCOIN, rawTx, 0)->getInputs().size();
+    }
+    auto fullDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "Parsed a " << rawTx.size() << " bytes transaction with " << inputsCount << " inputs: view "
+              << viewDuration.count() / rounds << "us, full parse " << fullDuration.count() / rounds << "us" << std::endl;
+    EXPECT_EQ(parsedInputs, 2 * rounds * inputsCount);
+}
@@ -5,50 +5,73 @@
 #include <rapidjson/stream.h>
 #include <fmt/format.h>
 #include <wallet/bitcoin/explorers/api/TransactionParser.hpp>
+#include <wallet/ethereum/explorers/api/EthereumLikeTransactionParser.hpp>
 #include <utils/DateUtils.hpp>
 
 namespace ledger {
     namespace core {
         namespace test {
 
-            bool transactionContainAddresses(const BitcoinLikeBlockchainExplorerTransaction& tr, const std::unordered_set<std::string>& addresses) {
-                return
-                    (std::find_if(
-                        tr.inputs.begin(),
-                        tr.inputs.end(),
-                        [&](const auto& input) {return input.address.hasValue() && (addresses.find(input.address.getValue()) != addresses.end()); }) != tr.inputs.end())
-                    ||
-                    (std::find_if(
-                        tr.outputs.begin(),
-                        tr.outputs.end(),
-                        [&](const auto& output) {return output.address.hasValue() && (addresses.find(output.address.getValue()) != addresses.end()); }) != tr.outputs.end());
-            }
-
-            void ExplorerStorage::addTransaction(const std::string& jsonTransaction) {
+            template <typename Parser, typename Transaction>
+            Transaction parseTransaction(const std::string& jsonTransaction) {
                 std::string dummy;
-                BitcoinLikeBlockchainExplorerTransaction transaction;
-                TransactionParser parser(dummy);
+                Transaction transaction;
+                Parser parser(dummy);
                 parser.init(&transaction);
                 rapidjson::Reader reader;
                 rapidjson::StringStream ss(jsonTransaction.c_str());
                 if (reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(ss, parser).IsError())
                     throw std::runtime_error("Can't parse transaction");
-                if (transaction.block.isEmpty()) {
-                    _memPool.push_back(std::make_pair(transaction, jsonTransaction));
+                return transaction;
+            }
+
+            void ExplorerStorage::addTransaction(const std::string& jsonTransaction) {
+                auto transaction = parseTransaction<TransactionParser, BitcoinLikeBlockchainExplorerTransaction>(jsonTransaction);
+                Entry entry {transaction.hash, transaction.block, {}, jsonTransaction};
+                for (const auto& input : transaction.inputs) {
+                    if (input.address.hasValue())
+                        entry.addresses.insert(input.address.getValue());
+                }
+                for (const auto& output : transaction.outputs) {
+                    if (output.address.hasValue())
+                        entry.addresses.insert(output.address.getValue());
+                }
+                addEntry(std::move(entry));
+            }
+
+            void ExplorerStorage::addEthereumTransaction(const std::string& jsonTransaction) {
+                auto transaction = parseTransaction<EthereumLikeTransactionParser, EthereumLikeBlockchainExplorerTransaction>(jsonTransaction);
+                // The explorer also lists the transactions whose transfer events or internal
+                // transactions involve the addresses
+                Entry entry {transaction.hash, transaction.block, {transaction.sender, transaction.receiver}, jsonTransaction};
+                for (const auto& event : transaction.erc20Transactions) {
+                    entry.addresses.insert({event.from, event.to});
+                }
+                for (const auto& action : transaction.internalTransactions) {
+                    entry.addresses.insert({action.from, action.to});
+                }
+                addEntry(std::move(entry));
+            }
+
+            void ExplorerStorage::addEntry(Entry entry) {
+                if (entry.block.isEmpty()) {
+                    _memPool.push_back(std::move(entry));
                     return;
                 }
-                _transactions.push_back(std::make_pair(transaction, jsonTransaction));
-                std::sort(
+                // Keep transactions ordered by height, in insertion order within a block
+                auto position = std::upper_bound(
                     _transactions.begin(),
                     _transactions.end(),
-                    [](const auto& a, const auto& b) { return  a.first.block.getValue().height < b.first.block.getValue().height; });
+                    entry.block.getValue().height,
+                    [](uint64_t height, const Entry& x) { return height < x.block.getValue().height; });
+                _transactions.insert(position, std::move(entry));
             }
 
             void ExplorerStorage::removeTransaction(const std::string& hash) {
-                auto it = std::find_if(_transactions.begin(), _transactions.end(), [&](auto& x) {return x.first.hash == hash; });
+                auto it = std::find_if(_transactions.begin(), _transactions.end(), [&](auto& x) {return x.hash == hash; });
                 if (it != _transactions.end())
                     _transactions.erase(it);
-                it = std::find_if(_memPool.begin(), _memPool.end(), [&](auto& x) {return x.first.hash == hash; });
+                it = std::find_if(_memPool.begin(), _memPool.end(), [&](auto& x) {return x.hash == hash; });
                 if (it != _memPool.end())
                     _memPool.erase(it);
             }
@@ -56,35 +79,42 @@ namespace ledger {
             std::vector<std::string> ExplorerStorage::getTransactions(
                 const std::vector<std::string>& addresses,
                 const std::string& blockHash) {
-                std::unordered_set<std::string> addrs(addresses.begin(), addresses.end());
+                auto containAddresses = [&](const Entry& x) {
+                    return std::find_if(addresses.begin(), addresses.end(), [&](const std::string& address) {
+                        return x.addresses.find(address) != x.addresses.end();
+                    }) != addresses.end();
+                };
                 std::vector<std::string> result;
-                auto block = std::find_if(_transactions.begin(), _transactions.end(), [&](auto& x) {
-                    return x.first.block.getValue().hash == blockHash;
-                });
-                std::vector<std::pair<BitcoinLikeBlockchainExplorerTransaction, std::string>> confirmedTransactions;
-                if (blockHash != "")
-                    std::copy_if(_transactions.begin(), _transactions.end(), std::back_inserter(confirmedTransactions), [&](auto& x) {
-                        return x.first.block.getValue().height > block->first.block->height;
+                uint64_t fromHeight = 0;
+                if (blockHash != "") {
+                    auto block = std::find_if(_transactions.begin(), _transactions.end(), [&](auto& x) {
+                        return x.block.getValue().hash == blockHash;
                     });
-                else
-                   confirmedTransactions = _transactions;
-                for (auto& tx : confirmedTransactions) {
-                    if (transactionContainAddresses(tx.first, addrs))
-                        result.push_back(tx.second);
+                    fromHeight = block->block.getValue().height + 1;
+                }
+                for (auto& tx : _transactions) {
+                    if (tx.block.getValue().height >= fromHeight && containAddresses(tx))
+                        result.push_back(tx.json);
                 }
                 for (auto& tx : _memPool) {
-                    if (transactionContainAddresses(tx.first, addrs))
-                        result.push_back(tx.second);
+                    if (containAddresses(tx))
+                        result.push_back(tx.json);
                 }
                 return result;
             }
 
+            bool ExplorerStorage::hasBlock(const std::string& blockHash) const {
+                return std::find_if(_transactions.begin(), _transactions.end(), [&](auto& x) {
+                    return x.block.getValue().hash == blockHash;
+                }) != _transactions.end();
+            }
+
             std::string ExplorerStorage::getLastBlock() {
                 if (_transactions.empty())
                     return "{}";
                 rapidjson::StringBuffer s;
                 rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                auto lastBlock = _transactions.back().first.block.getValue();
+                auto lastBlock = _transactions.back().block.getValue();
                 writer.StartObject();
                 writer.Key("hash");
                 writer.String(lastBlock.hash.c_str());
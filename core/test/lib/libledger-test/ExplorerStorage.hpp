@@ -12,6 +12,9 @@ namespace ledger {
             public:
                 void addTransaction(const std::string& jsonTransaction);
 
+                // Ethereum transactions are served by the same Ledger API routes
+                void addEthereumTransaction(const std::string& jsonTransaction);
+
                 void removeTransaction(const std::string& hash);
 
                 std::vector<std::string> getTransactions(
@@ -19,9 +22,21 @@ namespace ledger {
                     const std::string& blockHash);
 
                 std::string getLastBlock();
+
+                bool hasBlock(const std::string& blockHash) const;
             private:
-                std::vector<std::pair<BitcoinLikeBlockchainExplorerTransaction, std::string>> _transactions;
-                std::vector<std::pair<BitcoinLikeBlockchainExplorerTransaction, std::string>> _memPool;
+                struct Entry {
+                    std::string hash;
+                    Option<Block> block;
+                    // Every address the transaction involves, as written by the explorer
+                    std::unordered_set<std::string> addresses;
+                    std::string json;
+                };
+
+                void addEntry(Entry entry);
+
+                std::vector<Entry> _transactions;
+                std::vector<Entry> _memPool;
             };
         }
     }
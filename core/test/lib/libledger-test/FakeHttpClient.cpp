@@ -1,23 +1,146 @@
-#include "FakeHttpClient.hpp"
-#include "api/HttpRequest.hpp"
-#include <memory>
-#include "api/Error.hpp"
-
-namespace ledger {
-    namespace core {
-        namespace test {
-            void FakeHttpClient::execute(const std::shared_ptr<api::HttpRequest>& request) {
-                auto it = _behavior.find(request->getUrl());
-                if (it != _behavior.end()) {
-                    request->complete(it->second, std::experimental::nullopt);
-                    return;
-                }
-                request->complete(std::shared_ptr<api::HttpUrlConnection>(), api::Error(api::ErrorCode::BLOCK_NOT_FOUND, "Block not found"));
-            }
-
-            void FakeHttpClient::setBehavior(const std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>>& behavior) {
-                _behavior = behavior;
-            }
-        }
-    }
-}
\ No newline at end of file
+#include "FakeHttpClient.hpp"
+#include "api/HttpRequest.hpp"
+#include <memory>
+#include <regex>
+#include "api/Error.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            void FakeHttpClient::execute(const std::shared_ptr<api::HttpRequest>& request) {
+                std::function<void (const std::shared_ptr<api::HttpRequest>&)> observer;
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    _urls.push_back(request->getUrl());
+                    observer = _observer;
+                }
+                if (observer) {
+                    observer(request);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    if (_held) {
+                        _pending.push_back(request);
+                        return;
+                    }
+                }
+                answer(request);
+            }
+
+            void FakeHttpClient::answer(const std::shared_ptr<api::HttpRequest>& request) {
+                auto url = request->getUrl();
+                Handler handler;
+                std::pair<std::function<void ()>, std::string> scripted;
+                bool isScripted = false;
+                std::shared_ptr<api::HttpClient> fallback;
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    auto it = _behavior.find(url);
+                    if (it != _behavior.end()) {
+                        auto connection = it->second;
+                        request->complete(connection, std::experimental::nullopt);
+                        return;
+                    }
+                    for (const auto& route : _routes) {
+                        if (url.find(route.first) != std::string::npos) {
+                            handler = route.second;
+                            break;
+                        }
+                    }
+                    if (!handler && !_scripted.empty()) {
+                        scripted = _scripted.front();
+                        _scripted.pop_front();
+                        isScripted = true;
+                    }
+                    fallback = _fallback;
+                }
+                if (handler) {
+                    auto body = handler(request);
+                    if (body.isEmpty()) {
+                        request->complete(std::shared_ptr<api::HttpUrlConnection>(), api::Error(api::ErrorCode::HTTP_ERROR, "Unexpected request " + url));
+                        return;
+                    }
+                    request->complete(FakeUrlConnection::fromString(body.getValue()), std::experimental::nullopt);
+                    return;
+                }
+                if (isScripted) {
+                    if (scripted.first) {
+                        scripted.first();
+                    }
+                    request->complete(FakeUrlConnection::fromString(scripted.second), std::experimental::nullopt);
+                    return;
+                }
+                if (fallback) {
+                    fallback->execute(request);
+                    return;
+                }
+                request->complete(std::shared_ptr<api::HttpUrlConnection>(), api::Error(api::ErrorCode::BLOCK_NOT_FOUND, "Block not found"));
+            }
+
+            void FakeHttpClient::setBehavior(const std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>>& behavior) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _behavior = behavior;
+            }
+
+            void FakeHttpClient::route(const std::string& pattern, const Handler& handler) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _routes.emplace_back(pattern, handler);
+            }
+
+            void FakeHttpClient::script(const std::string& body, const std::function<void ()>& beforeResponse) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _scripted.emplace_back(beforeResponse, body);
+            }
+
+            size_t FakeHttpClient::getScriptedResponsesCount() {
+                std::lock_guard<std::mutex> lock(_lock);
+                return _scripted.size();
+            }
+
+            void FakeHttpClient::setFallback(const std::shared_ptr<api::HttpClient>& fallback) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _fallback = fallback;
+            }
+
+            void FakeHttpClient::setObserver(const std::function<void (const std::shared_ptr<api::HttpRequest>&)>& observer) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _observer = observer;
+            }
+
+            void FakeHttpClient::hold() {
+                std::lock_guard<std::mutex> lock(_lock);
+                _held = true;
+            }
+
+            void FakeHttpClient::release() {
+                std::vector<std::shared_ptr<api::HttpRequest>> pending;
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    _held = false;
+                    std::swap(pending, _pending);
+                }
+                for (const auto& request : pending) {
+                    answer(request);
+                }
+            }
+
+            std::vector<std::string> FakeHttpClient::getUrls() {
+                std::lock_guard<std::mutex> lock(_lock);
+                return _urls;
+            }
+
+            Option<std::string> FakeHttpClient::getQueryParameter(const std::string& url, const std::string& name) {
+                std::smatch match;
+                if (std::regex_search(url, match, std::regex("[?&]" + name + "=([^&]*)"))) {
+                    return Option<std::string>(match[1].str());
+                }
+                return Option<std::string>();
+            }
+
+            std::string FakeHttpClient::getBody(const std::shared_ptr<api::HttpRequest>& request) {
+                auto body = request->getBody();
+                return std::string(body.begin(), body.end());
+            }
+        }
+    }
+}
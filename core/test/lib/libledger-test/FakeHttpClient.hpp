@@ -1,20 +1,60 @@
-#pragma once
-#include "api/HttpClient.hpp"
-#include <unordered_map>
-#include "FakeUrlConnection.hpp"
-
-namespace ledger {
-    namespace core {
-        namespace test {
-
-            class FakeHttpClient : public api::HttpClient {
-            public:
-                void execute(const std::shared_ptr<api::HttpRequest>& request) override;
-                void setBehavior(const std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>>& behavior);
-            private:
-                std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>> _behavior;
-            };
-
-        }
-    }
-}
\ No newline at end of file
+#pragma once
+#include "api/HttpClient.hpp"
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <utils/Option.hpp>
+#include "FakeUrlConnection.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+
+            /*
+             * Answers requests, in this order, from the exact URLs of setBehavior, from the first route
+             * whose pattern is part of the URL, from the scripted responses in their order, and from the
+             * fallback client. Other requests fail with BLOCK_NOT_FOUND. Every requested URL is recorded,
+             * and answers are queued while the client is held.
+             */
+            class FakeHttpClient : public api::HttpClient {
+            public:
+                // Body of the answer, or none to fail the request with an HTTP_ERROR
+                using Handler = std::function<Option<std::string> (const std::shared_ptr<api::HttpRequest>& request)>;
+
+                void execute(const std::shared_ptr<api::HttpRequest>& request) override;
+                void setBehavior(const std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>>& behavior);
+
+                void route(const std::string& pattern, const Handler& handler);
+                // Answer the next request no route matches with body, running beforeResponse first
+                void script(const std::string& body, const std::function<void ()>& beforeResponse = nullptr);
+                size_t getScriptedResponsesCount();
+                void setFallback(const std::shared_ptr<api::HttpClient>& fallback);
+                // Called with every request before it is answered
+                void setObserver(const std::function<void (const std::shared_ptr<api::HttpRequest>&)>& observer);
+
+                void hold();
+                void release();
+                std::vector<std::string> getUrls();
+
+                static Option<std::string> getQueryParameter(const std::string& url, const std::string& name);
+                static std::string getBody(const std::shared_ptr<api::HttpRequest>& request);
+
+            private:
+                void answer(const std::shared_ptr<api::HttpRequest>& request);
+
+                std::mutex _lock;
+                std::unordered_map<std::string, std::shared_ptr<FakeUrlConnection>> _behavior;
+                std::vector<std::pair<std::string, Handler>> _routes;
+                std::deque<std::pair<std::function<void ()>, std::string>> _scripted;
+                std::shared_ptr<api::HttpClient> _fallback;
+                std::function<void (const std::shared_ptr<api::HttpRequest>&)> _observer;
+                bool _held = false;
+                std::vector<std::shared_ptr<api::HttpRequest>> _pending;
+                std::vector<std::string> _urls;
+            };
+
+        }
+    }
+}
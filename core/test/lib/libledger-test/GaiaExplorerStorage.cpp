@@ -0,0 +1,111 @@
+/*
+ *
+ * GaiaExplorerStorage.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "GaiaExplorerStorage.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <utils/DateUtils.hpp>
+#include <wallet/cosmos/explorers/RpcsParsers.hpp>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            namespace {
+                bool containsAddress(const std::vector<std::string>& addresses, const std::string& address) {
+                    return std::find(addresses.begin(), addresses.end(), address) != addresses.end();
+                }
+            }
+
+            void GaiaExplorerStorage::addTransaction(const std::string& jsonTransaction) {
+                rapidjson::Document document;
+                document.Parse(jsonTransaction.c_str());
+                if (document.HasParseError() || !document.IsObject())
+                    throw std::runtime_error("Can't parse transaction");
+                cosmos::Transaction transaction;
+                rpcs_parsers::parseTransaction(document.GetObject(), transaction);
+                if (transaction.block.isEmpty())
+                    throw std::runtime_error("Gaia only searches confirmed transactions");
+
+                Entry entry {transaction.block.getValue().height, DateUtils::toJSON(transaction.timestamp), {}, {}, jsonTransaction};
+                for (const auto& message : transaction.messages) {
+                    if (auto send = boost::get<cosmos::MsgSend>(&message.content)) {
+                        entry.senders.push_back(send->fromAddress);
+                        entry.recipients.push_back(send->toAddress);
+                    }
+                }
+                // Keep transactions ordered by height, in insertion order within a block
+                auto position = std::upper_bound(
+                    _transactions.begin(),
+                    _transactions.end(),
+                    entry.height,
+                    [](uint64_t height, const Entry& x) { return height < x.height; });
+                _transactions.insert(position, std::move(entry));
+            }
+
+            std::vector<std::string> GaiaExplorerStorage::getTransactionsSentBy(const std::string& address, uint64_t minHeight) const {
+                std::vector<std::string> result;
+                for (const auto& tx : _transactions) {
+                    if (tx.height >= minHeight && containsAddress(tx.senders, address))
+                        result.push_back(tx.json);
+                }
+                return result;
+            }
+
+            std::vector<std::string> GaiaExplorerStorage::getTransactionsReceivedBy(const std::string& address, uint64_t minHeight) const {
+                std::vector<std::string> result;
+                for (const auto& tx : _transactions) {
+                    if (tx.height >= minHeight && containsAddress(tx.recipients, address))
+                        result.push_back(tx.json);
+                }
+                return result;
+            }
+
+            Option<std::string> GaiaExplorerStorage::getBlock(uint64_t height) const {
+                auto tx = std::find_if(_transactions.begin(), _transactions.end(), [&](const Entry& x) {
+                    return x.height == height;
+                });
+                if (tx == _transactions.end())
+                    return Option<std::string>();
+                // Gaia block hashes are upper cased
+                return Option<std::string>(fmt::format(
+                        R"({{"block_meta": {{"block_id": {{"hash": "{:064X}"}}, "header": {{"height": "{}", "time": "{}"}}}}}})",
+                        height, height, tx->time));
+            }
+
+            Option<std::string> GaiaExplorerStorage::getLastBlock() const {
+                if (_transactions.empty())
+                    return Option<std::string>();
+                return getBlock(_transactions.back().height);
+            }
+        }
+    }
+}
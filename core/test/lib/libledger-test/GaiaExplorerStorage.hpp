@@ -0,0 +1,68 @@
+/*
+ *
+ * GaiaExplorerStorage.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utils/Option.hpp>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            // Simulates the transactions search and the blocks of a Gaia node for the tests. Only
+            // MsgSend messages are indexed, blocks are made up from the heights of the transactions.
+            class GaiaExplorerStorage {
+            public:
+                void addTransaction(const std::string& jsonTransaction);
+
+                // Transactions from minHeight on with a message sent by (or paying) the address,
+                // ordered by height like the search of Gaia
+                std::vector<std::string> getTransactionsSentBy(const std::string& address, uint64_t minHeight) const;
+                std::vector<std::string> getTransactionsReceivedBy(const std::string& address, uint64_t minHeight) const;
+
+                Option<std::string> getBlock(uint64_t height) const;
+                Option<std::string> getLastBlock() const;
+
+            private:
+                struct Entry {
+                    uint64_t height;
+                    std::string time;
+                    std::vector<std::string> senders;
+                    std::vector<std::string> recipients;
+                    std::string json;
+                };
+
+                std::vector<Entry> _transactions;
+            };
+        }
+    }
+}
@@ -56,9 +56,17 @@ namespace ledger {
                     boost::split(addresses, *addressesIt, [](char c) {return c == ','; });
                     std::string blockHash = "";
                     auto blockHashIt = parameters.find("blockHash");
+                    if (blockHashIt == parameters.end()) {
+                        blockHashIt = parameters.find("block_hash");
+                    }
                     if (blockHashIt != parameters.end()) {
                         blockHash = blockHashIt->second;
                     }
+                    // The block was reorganized away
+                    if (!blockHash.empty() && !_explorer->hasBlock(blockHash)) {
+                        request->complete(std::shared_ptr<api::HttpUrlConnection>(), api::Error(api::ErrorCode::BLOCK_NOT_FOUND, "Block not found"));
+                        return;
+                    }
                     auto transactions = _explorer->getTransactions(addresses, blockHash);
                     request->complete(FakeUrlConnection::fromString(createTrunsactionBulkJson(transactions)), std::experimental::optional<api::Error>());
                     return;
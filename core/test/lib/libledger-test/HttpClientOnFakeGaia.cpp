@@ -0,0 +1,103 @@
+/*
+ *
+ * HttpClientOnFakeGaia.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "HttpClientOnFakeGaia.hpp"
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include <fmt/format.h>
+#include "api/HttpRequest.hpp"
+#include "api/Error.hpp"
+#include "utils/optional.hpp"
+#include "FakeHttpClient.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            namespace {
+                const std::string TRANSACTIONS_PATH = "/txs";
+                const std::string BLOCKS_PATH = "/blocks/";
+
+                uint64_t getNumber(const std::string& url, const std::string& name, uint64_t defaultValue) {
+                    auto value = FakeHttpClient::getQueryParameter(url, name);
+                    return value.hasValue() ? std::stoull(value.getValue()) : defaultValue;
+                }
+
+                // One page of a search, with the counts the explorer relies on to fetch the next ones
+                std::string createTransactionsPageJson(const std::vector<std::string>& transactions, uint64_t page, uint64_t limit) {
+                    auto begin = std::min<uint64_t>(transactions.size(), (page - 1) * limit);
+                    auto end = std::min<uint64_t>(transactions.size(), begin + limit);
+                    std::vector<std::string> txs(transactions.begin() + begin, transactions.begin() + end);
+                    return fmt::format(R"({{"total_count": "{}", "count": "{}", "page_number": "{}", "page_total": "{}", "limit": "{}", "txs": [{}]}})",
+                                       transactions.size(), txs.size(), page, (transactions.size() + limit - 1) / limit, limit,
+                                       boost::algorithm::join(txs, ","));
+                }
+            }
+
+            HttpClientOnFakeGaia::HttpClientOnFakeGaia(std::shared_ptr<GaiaExplorerStorage> explorer) : _explorer(explorer) {
+            }
+
+            void HttpClientOnFakeGaia::execute(const std::shared_ptr<api::HttpRequest>& request) {
+                auto url = request->getUrl();
+                auto path = url.substr(0, url.find('?'));
+                if (boost::algorithm::ends_with(path, TRANSACTIONS_PATH)) {
+                    auto minHeight = getNumber(url, "tx.minheight", 0);
+                    auto page = std::max<uint64_t>(1, getNumber(url, "page", 1));
+                    auto limit = std::max<uint64_t>(1, getNumber(url, "limit", 100));
+                    auto sender = FakeHttpClient::getQueryParameter(url, "message.sender");
+                    auto recipient = FakeHttpClient::getQueryParameter(url, "transfer.recipient");
+                    std::vector<std::string> transactions;
+                    if (sender.hasValue()) {
+                        transactions = _explorer->getTransactionsSentBy(sender.getValue(), minHeight);
+                    } else if (recipient.hasValue()) {
+                        transactions = _explorer->getTransactionsReceivedBy(recipient.getValue(), minHeight);
+                    }
+                    request->complete(FakeUrlConnection::fromString(createTransactionsPageJson(transactions, page, limit)),
+                                      std::experimental::optional<api::Error>());
+                    return;
+                }
+                auto blocks = path.find(BLOCKS_PATH);
+                if (blocks != std::string::npos) {
+                    auto height = path.substr(blocks + BLOCKS_PATH.size());
+                    auto block = height == "latest" ? _explorer->getLastBlock() : _explorer->getBlock(std::stoull(height));
+                    if (block.isEmpty()) {
+                        request->complete(std::shared_ptr<api::HttpUrlConnection>(), api::Error(api::ErrorCode::BLOCK_NOT_FOUND, "Block not found"));
+                        return;
+                    }
+                    request->complete(FakeUrlConnection::fromString(block.getValue()), std::experimental::optional<api::Error>());
+                    return;
+                }
+                request->complete(std::shared_ptr<api::HttpUrlConnection>(),
+                                  api::Error(api::ErrorCode::API_ERROR, fmt::format("{} is not served by the fake Gaia explorer", path)));
+            }
+
+        }
+    }
+}
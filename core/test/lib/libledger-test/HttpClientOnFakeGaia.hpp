@@ -0,0 +1,54 @@
+/*
+ *
+ * HttpClientOnFakeGaia.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+#include <memory>
+#include "api/HttpClient.hpp"
+#include "FakeUrlConnection.hpp"
+#include "GaiaExplorerStorage.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+
+            // Serves the transactions search and the blocks of a GaiaExplorerStorage. Other requests,
+            // like the account details fetched along a synchronization, fail with an API_ERROR.
+            class HttpClientOnFakeGaia : public api::HttpClient {
+            public:
+                HttpClientOnFakeGaia(std::shared_ptr<GaiaExplorerStorage> explorer);
+                void execute(const std::shared_ptr<api::HttpRequest>& request) override;
+            private:
+                std::shared_ptr<GaiaExplorerStorage> _explorer;
+            };
+
+        }
+    }
+}
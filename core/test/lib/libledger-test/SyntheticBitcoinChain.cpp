@@ -0,0 +1,170 @@
+/*
+ *
+ * SyntheticBitcoinChain.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SyntheticBitcoinChain.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <fmt/format.h>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            namespace {
+                // Valid mainnet addresses that belong to nobody in the tests
+                const std::vector<std::string> FOREIGN_ADDRESSES = {
+                    "1Bmpme646SNGa1jjjYAfuijdyBNJXLGEh",
+                    "1DDBzjLyAmDr4qLRC2T2WJ831cxBM5v7G7",
+                    "1KMbwcH1sGpHetLwwQVNMt4cEZB5u8Uk4b",
+                    "15zxN5EuryNJRpgo6rBRvgiYiDYix6EiHK"
+                };
+            }
+
+            SyntheticBitcoinChain::SyntheticBitcoinChain(const SyntheticChainParameters& parameters,
+                                                         const std::vector<std::string>& ownedAddresses)
+                : _parameters(parameters), _ownedAddresses(ownedAddresses), _random(parameters.seed), _generation(0) {
+                if (_ownedAddresses.empty()) {
+                    throw std::invalid_argument("A synthetic chain needs at least one owned address");
+                }
+                auto perBlock = std::max<uint32_t>(1, _parameters.transactionsPerBlock);
+                _transactions.reserve(_parameters.transactionsCount);
+                for (uint32_t index = 0; index < _parameters.transactionsCount; index++) {
+                    Transaction transaction;
+                    // Prefixed by the seed so that the chains of several accounts never share a hash
+                    transaction.hash = fmt::format("{:08x}{:056x}", _parameters.seed, index + 1);
+                    transaction.height = index / perBlock + 1;
+                    // Even transactions pay an owned address from outside, odd ones spend an owned output
+                    auto receiving = (index % 2) == 0;
+                    for (uint32_t input = 0; input < std::max<uint32_t>(1, _parameters.inputsPerTransaction); input++) {
+                        if (receiving) {
+                            transaction.inputs.emplace_back(fmt::format("{:064x}", 0xFFFFFFFFULL + _random()), input);
+                        } else if (input == 0) {
+                            // The first output of a receiving transaction is always owned
+                            auto& previous = _transactions[2 * (_random() % ((index + 1) / 2))];
+                            transaction.inputs.emplace_back(previous.hash, 0);
+                        } else {
+                            auto& previous = _transactions[_random() % _transactions.size()];
+                            std::pair<std::string, uint32_t> outpoint(previous.hash, _random() % previous.outputs.size());
+                            if (std::find(transaction.inputs.begin(), transaction.inputs.end(), outpoint) != transaction.inputs.end()) {
+                                // Never spend the same output twice in a transaction
+                                outpoint = std::make_pair(fmt::format("{:064x}", 0xFFFFFFFFULL + _random()), input);
+                            }
+                            transaction.inputs.push_back(outpoint);
+                        }
+                    }
+                    for (uint32_t output = 0; output < std::max<uint32_t>(1, _parameters.outputsPerTransaction); output++) {
+                        transaction.outputs.push_back(Output {pickAddress(receiving && output == 0), 1000 + _random() % 100000000});
+                    }
+                    _transactions.push_back(std::move(transaction));
+                }
+            }
+
+            const std::string& SyntheticBitcoinChain::pickAddress(bool owned) {
+                if (owned) {
+                    return _ownedAddresses[_random() % _ownedAddresses.size()];
+                }
+                return FOREIGN_ADDRESSES[_random() % FOREIGN_ADDRESSES.size()];
+            }
+
+            std::string SyntheticBitcoinChain::getBlockHash(uint32_t height) const {
+                return fmt::format("{:08x}{:056x}", _generation, height);
+            }
+
+            std::string SyntheticBitcoinChain::toJson(const Transaction& transaction) const {
+                std::ostringstream ss;
+                ss << fmt::format(R"({{"hash": "{}", "received_at": "2015-06-22T15:58:30Z", "lock_time": 0, )", transaction.hash);
+                ss << fmt::format(R"("block": {{"hash": "{}", "height": {}, "time": "2015-06-22T15:58:30Z"}}, )",
+                                  getBlockHash(transaction.height), transaction.height);
+                ss << R"("inputs": [)";
+                for (size_t index = 0; index < transaction.inputs.size(); index++) {
+                    const auto& input = transaction.inputs[index];
+                    // Inputs spend owned outputs when they refer to a generated transaction
+                    std::string address = FOREIGN_ADDRESSES[index % FOREIGN_ADDRESSES.size()];
+                    uint64_t value = 100000;
+                    auto previous = std::lower_bound(_transactions.begin(), _transactions.end(), input.first,
+                                                     [] (const Transaction& t, const std::string& hash) { return t.hash < hash; });
+                    if (previous != _transactions.end() && previous->hash == input.first) {
+                        address = previous->outputs[input.second].address;
+                        value = previous->outputs[input.second].value;
+                    }
+                    ss << (index > 0 ? ", " : "")
+                       << fmt::format(R"({{"input_index": {}, "output_hash": "{}", "output_index": {}, "value": {}, "address": "{}", "sequence": 4294967295, "script_signature": "0000"}})",
+                                      index, input.first, input.second, value, address);
+                }
+                ss << R"(], "outputs": [)";
+                for (size_t index = 0; index < transaction.outputs.size(); index++) {
+                    const auto& output = transaction.outputs[index];
+                    ss << (index > 0 ? ", " : "")
+                       << fmt::format(R"({{"output_index": {}, "address": "{}", "value": {}, "script_hex": "0000"}})",
+                                      index, output.address, output.value);
+                }
+                ss << R"(], "fees": 100})";
+                return ss.str();
+            }
+
+            void SyntheticBitcoinChain::publish(ExplorerStorage& explorer) const {
+                for (const auto& transaction : _transactions) {
+                    explorer.addTransaction(toJson(transaction));
+                }
+            }
+
+            uint32_t SyntheticBitcoinChain::reorganize(ExplorerStorage& explorer) {
+                auto height = getHeight();
+                auto depth = static_cast<uint32_t>(std::ceil(height * _parameters.reorganizationRate));
+                depth = std::min(depth, height);
+                if (depth == 0) {
+                    return 0;
+                }
+                auto fromHeight = height - depth + 1;
+                for (const auto& transaction : _transactions) {
+                    if (transaction.height >= fromHeight) {
+                        explorer.removeTransaction(transaction.hash);
+                    }
+                }
+                _generation++;
+                for (const auto& transaction : _transactions) {
+                    if (transaction.height >= fromHeight) {
+                        explorer.addTransaction(toJson(transaction));
+                    }
+                }
+                return depth;
+            }
+
+            size_t SyntheticBitcoinChain::getTransactionsCount() const {
+                return _transactions.size();
+            }
+
+            uint32_t SyntheticBitcoinChain::getHeight() const {
+                return _transactions.empty() ? 0 : _transactions.back().height;
+            }
+        }
+    }
+}
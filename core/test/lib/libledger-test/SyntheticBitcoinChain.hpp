@@ -0,0 +1,101 @@
+/*
+ *
+ * SyntheticBitcoinChain.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "ExplorerStorage.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            struct SyntheticChainParameters {
+                uint32_t transactionsCount = 1000;
+                uint32_t transactionsPerBlock = 10;
+                uint32_t inputsPerTransaction = 2;
+                uint32_t outputsPerTransaction = 2;
+                // Share of the blocks replaced at the tip by reorganize(), between 0 and 1
+                double reorganizationRate = 0.0;
+                // Share of the Ethereum transactions that only move tokens to an owned address
+                double tokenTransferRate = 0.0;
+                uint32_t seed = 42;
+            };
+
+            // Deterministic Bitcoin history spending from and to a set of owned addresses, served
+            // through an ExplorerStorage. Every transaction involves at least one owned address. Chains
+            // of different seeds can be published to the same explorer.
+            class SyntheticBitcoinChain {
+            public:
+                SyntheticBitcoinChain(const SyntheticChainParameters& parameters,
+                                      const std::vector<std::string>& ownedAddresses);
+
+                // Add every generated transaction to the explorer
+                void publish(ExplorerStorage& explorer) const;
+
+                // Replace the last blocks with blocks of the same heights and new hashes. Returns the
+                // number of reorganized blocks.
+                uint32_t reorganize(ExplorerStorage& explorer);
+
+                // Receiving transactions pay one owned output and spending ones only pay foreign
+                // addresses, so every transaction is exactly one operation of the owning account.
+                size_t getTransactionsCount() const;
+                uint32_t getHeight() const;
+
+            private:
+                struct Output {
+                    std::string address;
+                    uint64_t value;
+                };
+
+                struct Transaction {
+                    std::string hash;
+                    uint32_t height;
+                    std::vector<std::pair<std::string, uint32_t>> inputs;
+                    std::vector<Output> outputs;
+                };
+
+                std::string toJson(const Transaction& transaction) const;
+                std::string getBlockHash(uint32_t height) const;
+                const std::string& pickAddress(bool owned);
+
+                SyntheticChainParameters _parameters;
+                std::vector<std::string> _ownedAddresses;
+                std::vector<Transaction> _transactions;
+                std::mt19937 _random;
+                // Bumped by each reorganization so that replaced blocks get new hashes
+                uint32_t _generation;
+            };
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ *
+ * SyntheticBitcoinTransactions.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SyntheticBitcoinTransactions.hpp"
+#include <bytes/BytesWriter.h>
+#include <utils/hex.h>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            std::vector<uint8_t> createConsolidation(size_t inputsCount) {
+                BytesWriter writer;
+                writer.writeLeValue<uint32_t>(1);
+                writer.writeVarInt(inputsCount);
+                for (size_t i = 0; i < inputsCount; i++) {
+                    std::vector<uint8_t> previousTxHash(32, static_cast<uint8_t>(i));
+                    writer.writeByteArray(previousTxHash);
+                    writer.writeLeValue<uint32_t>(static_cast<uint32_t>(i % 4));
+                    std::vector<uint8_t> signature(71, 0x30);
+                    std::vector<uint8_t> pubKey(33, 0x02);
+                    writer.writeVarInt(1 + signature.size() + 1 + pubKey.size());
+                    writer.writeVarInt(signature.size());
+                    writer.writeByteArray(signature);
+                    writer.writeVarInt(pubKey.size());
+                    writer.writeByteArray(pubKey);
+                    writer.writeLeValue<uint32_t>(0xFFFFFFFF);
+                }
+                writer.writeVarInt(1);
+                writer.writeLeValue<uint64_t>(100000000);
+                writer.writeByteArray(hex::toByteArray("1976a9144c9c3dfac4207d5d8cb89df5722cb3d712385e3f88ac"));
+                writer.writeLeValue<uint32_t>(0);
+                return writer.toByteArray();
+            }
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ *
+ * SyntheticCosmosChain.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SyntheticCosmosChain.hpp"
+#include <algorithm>
+#include <sstream>
+#include <cereal/external/base64.hpp>
+#include <fmt/format.h>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            namespace {
+                // Addresses that belong to nobody in the offline tests
+                const std::vector<std::string> FOREIGN_ADDRESSES = {
+                    "cosmos102hty0jv2s29lyc4u0tv97z9v298e24t3vwtpl",
+                    "cosmos1g84934jpu3v5de5yqukkkhxmcvsw3u2ajxvpdl",
+                    "cosmos16xkkyj97z7r83sx45xwk9uwq0mj0zszlf6c6mq",
+                    "cosmos155svs6sgxe55rnvs6ghprtqu0mh69kehrn0dqr"
+                };
+                // Signs the receptions, its address is none of the owned ones
+                const std::string FOREIGN_SIGNER = "Anm+Zn753LusVaBilc6HCwcCm/zbLc4o2VnygVsW+BeY";
+            }
+
+            SyntheticCosmosChain::SyntheticCosmosChain(const SyntheticChainParameters& parameters,
+                                                       const std::string& ownedAddress,
+                                                       const std::vector<uint8_t>& ownedPublicKey)
+                : _parameters(parameters), _ownedAddress(ownedAddress), _random(parameters.seed), _sendsCount(0) {
+                auto perBlock = std::max<uint32_t>(1, _parameters.transactionsPerBlock);
+                auto ownedSigner = cereal::base64::encode(ownedPublicKey.data(), static_cast<unsigned int>(ownedPublicKey.size()));
+                _transactions.reserve(_parameters.transactionsCount);
+                for (uint32_t index = 0; index < _parameters.transactionsCount; index++) {
+                    Transaction transaction;
+                    // Prefixed by the seed so that the chains of several accounts never share a hash
+                    transaction.hash = fmt::format("{:08X}{:056X}", _parameters.seed, index + 1);
+                    transaction.height = index / perBlock + 1;
+                    transaction.amount = 1000 + _random() % 100000000;
+                    auto foreignAddress = FOREIGN_ADDRESSES[_random() % FOREIGN_ADDRESSES.size()];
+                    // Even transactions pay the owned address, odd ones are sent from it
+                    if ((index % 2) == 0) {
+                        transaction.sender = foreignAddress;
+                        transaction.receiver = _ownedAddress;
+                        transaction.signer = FOREIGN_SIGNER;
+                    } else {
+                        transaction.sender = _ownedAddress;
+                        transaction.receiver = foreignAddress;
+                        transaction.signer = ownedSigner;
+                        _sendsCount++;
+                    }
+                    _transactions.push_back(std::move(transaction));
+                }
+            }
+
+            std::string SyntheticCosmosChain::toJson(const Transaction& transaction) const {
+                std::ostringstream ss;
+                ss << fmt::format(R"({{"height": "{}", "txhash": "{}", "gas_wanted": "200000", "gas_used": "41000", )",
+                                  transaction.height, transaction.hash);
+                ss << R"("logs": [{"msg_index": "0", "success": true, "log": ""}], "timestamp": "2020-06-04T09:12:15Z", )";
+                ss << R"("tx": {"type": "cosmos-sdk/StdTx", "value": {"msg": [{"type": "cosmos-sdk/MsgSend", "value": )";
+                ss << fmt::format(R"({{"from_address": "{}", "to_address": "{}", "amount": [{{"denom": "uatom", "amount": "{}"}}]}}}}], )",
+                                  transaction.sender, transaction.receiver, transaction.amount);
+                ss << R"("fee": {"amount": [{"denom": "uatom", "amount": "5000"}], "gas": "200000"}, )";
+                ss << fmt::format(R"("signatures": [{{"pub_key": {{"type": "tendermint/PubKeySecp256k1", "value": "{}"}}, "signature": ""}}], )",
+                                  transaction.signer);
+                ss << R"("memo": ""}}})";
+                return ss.str();
+            }
+
+            void SyntheticCosmosChain::publish(GaiaExplorerStorage& explorer) const {
+                for (const auto& transaction : _transactions) {
+                    explorer.addTransaction(toJson(transaction));
+                }
+            }
+
+            size_t SyntheticCosmosChain::getTransactionsCount() const {
+                return _transactions.size();
+            }
+
+            size_t SyntheticCosmosChain::getOperationsCount() const {
+                return _transactions.size() + _sendsCount;
+            }
+
+            uint32_t SyntheticCosmosChain::getHeight() const {
+                return _transactions.empty() ? 0 : _transactions.back().height;
+            }
+        }
+    }
+}
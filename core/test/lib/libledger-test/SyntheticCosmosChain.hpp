@@ -0,0 +1,85 @@
+/*
+ *
+ * SyntheticCosmosChain.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "GaiaExplorerStorage.hpp"
+#include "SyntheticBitcoinChain.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            // Deterministic Cosmos history of MsgSend transactions to and from an owned address, served
+            // through a GaiaExplorerStorage. Inputs, outputs and token parameters are ignored. Gaia
+            // gives no way to detect a reorganization, so the chain can't be reorganized. Chains of
+            // different seeds can be published to the same explorer.
+            class SyntheticCosmosChain {
+            public:
+                // Sends are signed with the compressed owned public key, so that the account pays their fees
+                SyntheticCosmosChain(const SyntheticChainParameters& parameters,
+                                     const std::string& ownedAddress,
+                                     const std::vector<uint8_t>& ownedPublicKey);
+
+                // Add every generated transaction to the explorer
+                void publish(GaiaExplorerStorage& explorer) const;
+
+                size_t getTransactionsCount() const;
+                // A send is two operations of the owning account, the transfer and its fees, a
+                // reception is one since the fees are paid by the sender
+                size_t getOperationsCount() const;
+                uint32_t getHeight() const;
+
+            private:
+                struct Transaction {
+                    std::string hash;
+                    uint32_t height;
+                    std::string sender;
+                    std::string receiver;
+                    uint64_t amount;
+                    // Base64 public key of the signer, which pays the fees
+                    std::string signer;
+                };
+
+                std::string toJson(const Transaction& transaction) const;
+
+                SyntheticChainParameters _parameters;
+                std::string _ownedAddress;
+                std::vector<Transaction> _transactions;
+                std::mt19937 _random;
+                size_t _sendsCount;
+            };
+        }
+    }
+}
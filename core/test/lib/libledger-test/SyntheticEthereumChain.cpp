@@ -0,0 +1,143 @@
+/*
+ *
+ * SyntheticEthereumChain.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SyntheticEthereumChain.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <fmt/format.h>
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            namespace {
+                // Lower cased like the explorer writes them, they belong to nobody in the tests
+                const std::vector<std::string> FOREIGN_ADDRESSES = {
+                    "0x5e4e65926ba27467555eb562121fac00d24e9dd2",
+                    "0x1f9840a85d5af5bf1d1762f925bdaddc4201f984",
+                    "0x7a250d5630b4cf539739df2c5dacb4c659f2488d",
+                    "0x3f5ce5fbfe3e9af3971dd833d26ba9b5c936f0be"
+                };
+                const std::string TOKEN_CONTRACT = "0xdac17f958d2ee523a2206206994597c13d831ec7";
+            }
+
+            SyntheticEthereumChain::SyntheticEthereumChain(const SyntheticChainParameters& parameters,
+                                                           const std::string& ownedAddress)
+                : _parameters(parameters), _ownedAddress(ownedAddress), _random(parameters.seed), _generation(0) {
+                auto perBlock = std::max<uint32_t>(1, _parameters.transactionsPerBlock);
+                std::uniform_real_distribution<double> share(0.0, 1.0);
+                _transactions.reserve(_parameters.transactionsCount);
+                for (uint32_t index = 0; index < _parameters.transactionsCount; index++) {
+                    Transaction transaction;
+                    // Prefixed by the seed so that the chains of several accounts never share a hash
+                    transaction.hash = fmt::format("0x{:08x}{:056x}", _parameters.seed, index + 1);
+                    transaction.height = index / perBlock + 1;
+                    transaction.value = 1000 + _random() % 100000000;
+                    if (share(_random) < _parameters.tokenTransferRate) {
+                        // A foreign call of the token contract whose transfer event pays the owned address
+                        transaction.sender = pickForeignAddress();
+                        transaction.receiver = TOKEN_CONTRACT;
+                        transaction.tokenReceiver = _ownedAddress;
+                    } else if ((index % 2) == 0) {
+                        transaction.sender = pickForeignAddress();
+                        transaction.receiver = _ownedAddress;
+                    } else {
+                        transaction.sender = _ownedAddress;
+                        transaction.receiver = pickForeignAddress();
+                    }
+                    _transactions.push_back(std::move(transaction));
+                }
+            }
+
+            const std::string& SyntheticEthereumChain::pickForeignAddress() {
+                return FOREIGN_ADDRESSES[_random() % FOREIGN_ADDRESSES.size()];
+            }
+
+            std::string SyntheticEthereumChain::getBlockHash(uint32_t height) const {
+                return fmt::format("0x{:08x}{:056x}", _generation, height);
+            }
+
+            std::string SyntheticEthereumChain::toJson(const Transaction& transaction) const {
+                std::ostringstream ss;
+                ss << fmt::format(R"({{"hash": "{}", "status": 1, "received_at": "2019-12-05T13:25:07Z", "nonce": "0x00", )",
+                                  transaction.hash);
+                ss << fmt::format(R"("value": {}, "gas": 21000, "gas_price": 1000000000, "from": "{}", "to": "{}", "input": "0x", )",
+                                  transaction.tokenReceiver.empty() ? transaction.value : 0,
+                                  transaction.sender, transaction.receiver);
+                ss << R"("cumulative_gas_used": 21000, "gas_used": 21000, "transfer_events": {"list": [)";
+                if (!transaction.tokenReceiver.empty()) {
+                    ss << fmt::format(R"({{"contract": "{}", "from": "{}", "to": "{}", "count": {}}})",
+                                      TOKEN_CONTRACT, transaction.sender, transaction.tokenReceiver, transaction.value);
+                }
+                ss << R"(], "truncated": false}, "actions": [], )";
+                ss << fmt::format(R"("block": {{"hash": "{}", "height": {}, "time": "2019-12-05T13:25:07Z"}}}})",
+                                  getBlockHash(transaction.height), transaction.height);
+                return ss.str();
+            }
+
+            void SyntheticEthereumChain::publish(ExplorerStorage& explorer) const {
+                for (const auto& transaction : _transactions) {
+                    explorer.addEthereumTransaction(toJson(transaction));
+                }
+            }
+
+            uint32_t SyntheticEthereumChain::reorganize(ExplorerStorage& explorer) {
+                auto height = getHeight();
+                auto depth = static_cast<uint32_t>(std::ceil(height * _parameters.reorganizationRate));
+                depth = std::min(depth, height);
+                if (depth == 0) {
+                    return 0;
+                }
+                auto fromHeight = height - depth + 1;
+                for (const auto& transaction : _transactions) {
+                    if (transaction.height >= fromHeight) {
+                        explorer.removeTransaction(transaction.hash);
+                    }
+                }
+                _generation++;
+                for (const auto& transaction : _transactions) {
+                    if (transaction.height >= fromHeight) {
+                        explorer.addEthereumTransaction(toJson(transaction));
+                    }
+                }
+                return depth;
+            }
+
+            size_t SyntheticEthereumChain::getTransactionsCount() const {
+                return _transactions.size();
+            }
+
+            uint32_t SyntheticEthereumChain::getHeight() const {
+                return _transactions.empty() ? 0 : _transactions.back().height;
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ *
+ * SyntheticEthereumChain.hpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "ExplorerStorage.hpp"
+#include "SyntheticBitcoinChain.hpp"
+
+namespace ledger {
+    namespace core {
+        namespace test {
+            // Deterministic Ethereum history of an owned address, served through an ExplorerStorage.
+            // Inputs and outputs parameters are ignored, tokenTransferRate sets the share of token
+            // transfers. Chains of different seeds can be published to the same explorer.
+            class SyntheticEthereumChain {
+            public:
+                SyntheticEthereumChain(const SyntheticChainParameters& parameters,
+                                       const std::string& ownedAddress);
+
+                // Add every generated transaction to the explorer
+                void publish(ExplorerStorage& explorer) const;
+
+                // Replace the last blocks with blocks of the same heights and new hashes. Returns the
+                // number of reorganized blocks.
+                uint32_t reorganize(ExplorerStorage& explorer);
+
+                // Transactions either send from or pay the owned address, or only carry a transfer
+                // event to it, so every transaction is exactly one operation of the owning account.
+                size_t getTransactionsCount() const;
+                uint32_t getHeight() const;
+
+            private:
+                struct Transaction {
+                    std::string hash;
+                    uint32_t height;
+                    std::string sender;
+                    std::string receiver;
+                    uint64_t value;
+                    // Receiver of the token transfer event, empty for plain transfers
+                    std::string tokenReceiver;
+                };
+
+                std::string toJson(const Transaction& transaction) const;
+                std::string getBlockHash(uint32_t height) const;
+                const std::string& pickForeignAddress();
+
+                SyntheticChainParameters _parameters;
+                std::string _ownedAddress;
+                std::vector<Transaction> _transactions;
+                std::mt19937 _random;
+                // Bumped by each reorganization so that replaced blocks get new hashes
+                uint32_t _generation;
+            };
+        }
+    }
+}
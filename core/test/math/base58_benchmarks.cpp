@@ -0,0 +1,116 @@
+/*
+ *
+ * base58_benchmarks.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <ledger/core/math/Base58Codec.hpp>
+#include <ledger/core/math/BigInt.h>
+#include <ledger/core/utils/hex.h>
+
+using namespace ledger::core;
+
+namespace {
+    const std::string DIGITS = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    const int ITERATIONS = 2000;
+
+    // Former BigInt based implementation, kept as a reference point
+    void legacyEncode(const BigInt& v, std::stringstream& ss) {
+        static const BigInt V_58(58);
+        if (v == BigInt::ZERO) {
+            return;
+        }
+        auto r = (v % V_58).toUnsignedInt();
+        legacyEncode(v / V_58, ss);
+        ss << DIGITS[r];
+    }
+
+    std::string legacyEncode(const std::vector<uint8_t>& bytes) {
+        BigInt intData(bytes.data(), bytes.size(), false);
+        std::stringstream ss;
+        for (auto i = 0; i < bytes.size() && bytes[i] == 0; i++) {
+            ss << DIGITS[0];
+        }
+        legacyEncode(intData, ss);
+        return ss.str();
+    }
+
+    std::vector<uint8_t> legacyDecode(const std::string& str) {
+        static const BigInt V_58(58);
+        BigInt intData(0);
+        std::vector<uint8_t> result;
+        for (auto& c : str) {
+            if (c == DIGITS[0] && intData == BigInt::ZERO) {
+                result.push_back(0);
+            } else {
+                intData = (intData * V_58) + BigInt((unsigned int)DIGITS.find(c));
+            }
+        }
+        auto bytes = intData.toByteArray();
+        result.insert(result.end(), bytes.begin(), bytes.end());
+        return result;
+    }
+
+    template <typename Function>
+    long long measure(Function f) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < ITERATIONS; i++) {
+            f();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void benchmark(const std::string& name, const std::vector<uint8_t>& payload) {
+        const auto& codec = Base58Codec::bitcoin();
+        auto encoded = codec.encode(payload);
+        ASSERT_EQ(encoded, legacyEncode(payload));
+        ASSERT_EQ(codec.decode(encoded), legacyDecode(encoded));
+
+        auto legacyEncoding = measure([&] () { legacyEncode(payload); });
+        auto codecEncoding = measure([&] () { codec.encode(payload); });
+        auto legacyDecoding = measure([&] () { legacyDecode(encoded); });
+        auto codecDecoding = measure([&] () { codec.decode(encoded); });
+
+        std::cout << name << " (" << payload.size() << " bytes, " << ITERATIONS << " iterations)" << std::endl
+                  << "  encode: legacy " << legacyEncoding << "us, codec " << codecEncoding << "us" << std::endl
+                  << "  decode: legacy " << legacyDecoding << "us, codec " << codecDecoding << "us" << std::endl;
+    }
+}
+
+TEST(Base58Benchmarks, Address) {
+    benchmark("P2PKH address", hex::toByteArray("00010966776006953D5567439E5E39F86A0D273BEEd61967f6"));
+}
+
+TEST(Base58Benchmarks, ExtendedPublicKey) {
+    benchmark("xpub", hex::toByteArray("0488B21E000000000000000000873dff81c02f525623fd1fe5167eac3a55a049de3d314bb42ee227ffed37d5080339a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c2e8ff49c8"));
+}
@@ -31,6 +31,7 @@
 
 #include <gtest/gtest.h>
 #include <ledger/core/math/Base58.hpp>
+#include <ledger/core/math/Base58Codec.hpp>
 #include <ledger/core/utils/hex.h>
 #include <ledger/core/collections/DynamicObject.hpp>
 using namespace ledger::core;
@@ -68,4 +69,38 @@ TEST(Base58, Decode) {
         EXPECT_TRUE(result.isSuccess());
         EXPECT_EQ(result.getValue(), data);
     }
-}
\ No newline at end of file
+}
+TEST(Base58, CodecMatchesFixtures) {
+    const auto& codec = Base58Codec::bitcoin();
+    auto config = std::make_shared<DynamicObject>();
+    for (auto& item : fixtures) {
+        auto data = hex::toByteArray(item[0] + item[1]);
+        auto payload = codec.decode(item[2]);
+        EXPECT_EQ(std::vector<uint8_t>(payload.begin(), payload.end() - 4), data);
+        EXPECT_EQ(codec.encode(payload), item[2]);
+        EXPECT_EQ(Base58::encode(payload, config), item[2]);
+    }
+}
+
+TEST(Base58, CodecEdgeCases) {
+    const auto& codec = Base58Codec::bitcoin();
+    EXPECT_EQ(codec.encode(std::vector<uint8_t>()), "");
+    EXPECT_EQ(codec.encode(std::vector<uint8_t>({0, 0})), "11");
+    EXPECT_EQ(codec.encode(std::vector<uint8_t>({0, 0, 57})), "11z");
+    EXPECT_EQ(codec.decode("11z"), std::vector<uint8_t>({0, 0, 57}));
+    EXPECT_THROW(codec.decode("1O0"), Exception);
+
+    // Payloads larger than the stack buffer go through the heap
+    std::vector<uint8_t> large(300, 0xAB);
+    EXPECT_EQ(codec.decode(codec.encode(large)), large);
+}
+
+TEST(Base58, CodecWithCustomDictionary) {
+    auto config = std::make_shared<DynamicObject>();
+    config->putString("base58Dictionary", "rpshnaf39wBUDNEGHJKLM4PQRST7VWXYZ2bcdeCg65jkm8oFqi1tuvAxyz");
+    config->putBoolean("useNetworkDictionary", true);
+    auto bytes = hex::toByteArray("00010966776006953D5567439E5E39F86A0D273BEE");
+    auto encoded = Base58::encodeWithChecksum(bytes, config);
+    EXPECT_EQ(encoded[0], 'r');
+    EXPECT_EQ(Base58::checkAndDecode(encoded, config).getValue(), bytes);
+}
@@ -0,0 +1,128 @@
+/*
+ *
+ * bech32_benchmarks
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <ledger/core/math/bech32/Bech32Factory.h>
+#include <ledger/core/utils/hex.h>
+#include <ledger/core/api/CosmosBech32Type.hpp>
+
+using namespace ledger::core;
+
+namespace {
+    const int ITERATIONS = 100000;
+
+    // Checksum computed as before, by polymod over the freshly expanded HRP concatenated with the values
+    bool legacyVerifyChecksum(const Bech32& bech32, const std::vector<uint8_t>& values) {
+        auto enc = bech32.expandHrp(bech32.getBech32Params().hrp);
+        enc.insert(enc.end(), values.begin(), values.end());
+        return bech32.polymod(enc) == 1;
+    }
+
+    std::vector<uint8_t> legacyCreateChecksum(const Bech32& bech32, const std::vector<uint8_t>& values) {
+        auto enc = bech32.expandHrp(bech32.getBech32Params().hrp);
+        enc.insert(enc.end(), values.begin(), values.end());
+        enc.resize(enc.size() + bech32.getBech32Params().checksumSize);
+        auto mod = bech32.polymod(enc) ^ 1;
+        std::vector<uint8_t> ret(bech32.getBech32Params().checksumSize);
+        for (int i = ret.size() - 1; i >= 0; --i) {
+            ret[i] = mod & 31;
+            mod >>= 5;
+        }
+        return ret;
+    }
+
+    template <typename Function>
+    long long measure(Function f) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < ITERATIONS; i++) {
+            f();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start).count();
+    }
+}
+
+TEST(Bech32, InstancesAreShared) {
+    auto first = Bech32Factory::getBech32Instance("btc");
+    auto second = Bech32Factory::getBech32Instance("btc");
+    ASSERT_TRUE(first.hasValue());
+    EXPECT_EQ(first.getValue().get(), second.getValue().get());
+    EXPECT_NE(Bech32Factory::getBech32Instance("ltc").getValue().get(), first.getValue().get());
+    EXPECT_TRUE(Bech32Factory::getBech32Instance(api::to_string(api::CosmosBech32Type::ADDRESS)).hasValue());
+    EXPECT_TRUE(Bech32Factory::getBech32Instance("eth").isEmpty());
+}
+
+TEST(Bech32, ChecksumsMatchLegacyComputation) {
+    std::vector<std::pair<std::string, std::string>> addresses = {
+            {"btc_testnet", "tb1qunawpra24prfc46klknlhl0ydy32feajmwpg84"},
+            {"btc", "bc1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3qccfmv3"},
+            {"abc", "bitcoincash:qpm2qsznhks23z7629mms6s4cwef74vcwvy22gdx6a"},
+            {"dgb", "dgb1qgdg3hdysnpmaxpdpqqzhey2f5888av488hq0z6"},
+            {"ltc", "ltc1q7qnj9xm8wp8ucmg64lk0h03as8k6ql6rk4wvsd"}
+    };
+    for (auto& address : addresses) {
+        auto bech32 = Bech32Factory::getBech32Instance(address.first).getValue();
+        auto decoded = bech32->decode(address.second);
+        EXPECT_EQ(bech32->encode(decoded.second, decoded.first), address.second);
+
+        auto values = bech32->decodeBech32(address.second).second;
+        ASSERT_FALSE(values.empty());
+        EXPECT_EQ(bech32->createChecksum(values), legacyCreateChecksum(*bech32, values));
+        auto withChecksum = values;
+        auto checksum = bech32->createChecksum(values);
+        withChecksum.insert(withChecksum.end(), checksum.begin(), checksum.end());
+        EXPECT_TRUE(bech32->verifyChecksum(withChecksum));
+        EXPECT_TRUE(legacyVerifyChecksum(*bech32, withChecksum));
+        withChecksum.back() ^= 1;
+        EXPECT_FALSE(bech32->verifyChecksum(withChecksum));
+    }
+}
+
+TEST(Bech32Benchmarks, Address) {
+    auto bech32 = Bech32Factory::getBech32Instance("btc").getValue();
+    auto hash = hex::toByteArray("751e76e8199196d454941c45d1b3a323f1433bd6");
+    const auto& version = bech32->getBech32Params().P2WPKHVersion;
+    auto address = bech32->encode(hash, version);
+    ASSERT_EQ(bech32->decode(address).second, hash);
+
+    auto legacyFactory = measure([&] () { Bech32Factory::newBech32Instance("btc"); });
+    auto sharedFactory = measure([&] () { Bech32Factory::getBech32Instance("btc"); });
+    auto encoding = measure([&] () { bech32->encode(hash, version); });
+    auto decoding = measure([&] () { bech32->decode(address); });
+
+    auto perSecond = [] (long long us) { return us == 0 ? 0 : ITERATIONS * 1000000LL / us; };
+    std::cout << "P2WPKH address (" << ITERATIONS << " iterations)" << std::endl
+              << "  instance: new " << legacyFactory << "us, shared " << sharedFactory << "us" << std::endl
+              << "  encode: " << encoding << "us (" << perSecond(encoding) << " addresses/s)" << std::endl
+              << "  decode: " << decoding << "us (" << perSecond(decoding) << " addresses/s)" << std::endl;
+}
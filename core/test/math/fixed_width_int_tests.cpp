@@ -0,0 +1,86 @@
+/*
+ *
+ * fixed_width_int_tests.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <math/FixedWidthInt.hpp>
+#include <limits>
+
+using namespace ledger::core;
+
+TEST(FixedWidthInt, DecimalRoundTrip) {
+    auto max = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+    EXPECT_EQ(UInt256::fromDecimal(max).toString(), max);
+    EXPECT_EQ(UInt256::fromDecimal("0").toString(), "0");
+    EXPECT_EQ(UInt256::fromDecimal("1000000000").toString(), "1000000000");
+    EXPECT_EQ(UInt256::fromDecimal("18446744073709551616").toString(), "18446744073709551616");
+    EXPECT_EQ(Int256::fromDecimal("-42").toString(), "-42");
+}
+
+TEST(FixedWidthInt, HexConversions) {
+    auto value = UInt256::fromHex("0x0102030405060708090a0b0c0d0f11223344556677889900aabbccddeeff");
+    EXPECT_EQ(value.toHexString(), "102030405060708090a0b0c0d0f11223344556677889900aabbccddeeff");
+    EXPECT_EQ(value.toBigInt().toHexString(), BigInt::fromHex("0102030405060708090a0b0c0d0f11223344556677889900aabbccddeeff").toHexString());
+}
+
+TEST(FixedWidthInt, ArithmeticMatchesBigInt) {
+    auto a = BigInt::fromString("98765432109876543210987654321");
+    auto b = BigInt::fromString("1234567890123456789");
+    auto fa = UInt256::fromBigInt(a);
+    auto fb = UInt256::fromBigInt(b);
+    EXPECT_EQ((fa + fb).toString(), (a + b).toString());
+    EXPECT_EQ((fa - fb).toString(), (a - b).toString());
+    EXPECT_EQ((fa * fb).toString(), (a * b).toString());
+    EXPECT_TRUE(fb < fa);
+    EXPECT_EQ((Int256::fromBigInt(b) - Int256::fromBigInt(a)).toBigInt(), b - a);
+}
+
+TEST(FixedWidthInt, OverflowsAreChecked) {
+    auto max = UInt128::fromHex("ffffffffffffffffffffffffffffffff");
+    EXPECT_THROW(max + UInt128(1), Exception);
+    EXPECT_THROW(UInt128(1) - UInt128(2), Exception);
+    EXPECT_THROW(max * UInt128(2), Exception);
+    EXPECT_THROW(UInt128::fromDecimal("340282366920938463463374607431768211456"), Exception);
+    EXPECT_THROW(UInt128::fromDecimal("12a"), Exception);
+    EXPECT_THROW(UInt256::fromBigInt(BigInt(-1)), Exception);
+    EXPECT_EQ((max - UInt128(1) + UInt128(1)), max);
+}
+
+TEST(FixedWidthInt, SignedSums) {
+    Int256 sum;
+    sum += Int256(100);
+    sum -= Int256(250);
+    EXPECT_TRUE(sum.isNegative());
+    EXPECT_EQ(sum.toString(), "-150");
+    sum += Int256(150);
+    EXPECT_TRUE(sum.isZero());
+    EXPECT_FALSE(sum.isNegative());
+    EXPECT_EQ(Int256(std::numeric_limits<int64_t>::min()).toString(), "-9223372036854775808");
+}
@@ -343,3 +343,48 @@ TEST(HttpClient, GETWithSaxError) {
         WAIT_AND_TIMEOUT(dispatcher, 10000);
     }
 }
+
+TEST(HttpClient, GETCoalescingAndCache) {
+    auto dispatcher = std::make_shared<NativeThreadDispatcher>();
+    auto client = std::make_shared<MongooseHttpClient>(dispatcher->getSerialExecutionContext("client"));
+    auto worker = dispatcher->getSerialExecutionContext("worker");
+    ledger::core::HttpClient http("http://127.0.0.1:8000", client, worker);
+    auto cache = std::make_shared<HttpResponseCache>(std::chrono::seconds(60));
+    http.setResponseCache(cache);
+    {
+        auto server = std::make_shared<MongooseSimpleRestServer>(dispatcher->getSerialExecutionContext("server"));
+        auto calls = std::make_shared<std::atomic<int>>(0);
+
+        server->GET("/blocks/current", [calls](const RestRequest &request) -> RestResponse {
+            (*calls)++;
+            return {200, "OK", "{\"height\": 42}"};
+        });
+
+        server->start(8000);
+
+        worker->execute(::make_runnable([&http, dispatcher, &server, cache, calls] () {
+            auto first = http.GET("/blocks/current").cacheable().json();
+            auto second = http.GET("/blocks/current").cacheable().json();
+            first.flatMap<HttpRequest::JsonResult>(dispatcher->getMainExecutionContext(), [second] (const HttpRequest::JsonResult& result) mutable {
+                EXPECT_EQ(42, (*std::get<1>(result))["height"].GetInt());
+                return second;
+            }).flatMap<HttpRequest::JsonResult>(dispatcher->getMainExecutionContext(), [&http] (const HttpRequest::JsonResult& result) {
+                EXPECT_EQ(42, (*std::get<1>(result))["height"].GetInt());
+                return http.GET("/blocks/current").cacheable().json();
+            }).onComplete(dispatcher->getMainExecutionContext(), [&server, dispatcher, cache, calls] (const Try<HttpRequest::JsonResult>& result) {
+                EXPECT_TRUE(result.isSuccess());
+                EXPECT_EQ(42, (*std::get<1>(result.getValue()))["height"].GetInt());
+                auto statistics = cache->getStatistics();
+                EXPECT_EQ(1, calls->load());
+                EXPECT_EQ(1, statistics.misses);
+                EXPECT_EQ(1, statistics.coalesced);
+                EXPECT_EQ(1, statistics.hits);
+                server->stop();
+                dispatcher->getMainExecutionContext()->delay(::make_runnable([dispatcher]() {
+                    dispatcher->stop();
+                }), 0);
+            });
+        }));
+        WAIT_AND_TIMEOUT(dispatcher, 10000);
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ *
+ * parser_benchmarks.cpp
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include <utils/JSONUtils.h>
+#include <wallet/bitcoin/explorers/api/TransactionParser.hpp>
+#include <wallet/bitcoin/explorers/api/TransactionsBulkParser.hpp>
+#include "../fixtures/medium_xpub_fixtures.h"
+
+using namespace ledger::core;
+using namespace ledger::testing;
+
+namespace {
+    const int ITERATIONS = 200;
+
+    std::vector<std::string> payloads() {
+        return {
+            medium_xpub::TX_1, medium_xpub::TX_2, medium_xpub::TX_3, medium_xpub::TX_4, medium_xpub::TX_5,
+            medium_xpub::TX_6, medium_xpub::TX_7, medium_xpub::TX_8, medium_xpub::TX_9, medium_xpub::TX_10
+        };
+    }
+
+    std::string bulkPayload() {
+        std::stringstream ss;
+        ss << "{\"truncated\": false, \"txs\": [";
+        auto txs = payloads();
+        for (auto i = 0; i < txs.size(); i++) {
+            ss << (i == 0 ? "" : ",") << txs[i];
+        }
+        ss << "]}";
+        return ss.str();
+    }
+}
+
+TEST(ParserBenchmarks, SingleTransactions) {
+    auto txs = payloads();
+    size_t bytes = 0, inputs = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto i = 0; i < ITERATIONS; i++) {
+        for (auto& json : txs) {
+            auto tx = JSONUtils::parse<TransactionParser>(json);
+            inputs += tx->inputs.size();
+            bytes += json.size();
+        }
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+
+    EXPECT_GT(inputs, 0);
+    std::cout << "Parsed " << ITERATIONS * txs.size() << " transactions (" << bytes / 1024 << " KiB) in "
+              << duration.count() << "ms" << std::endl;
+}
+
+TEST(ParserBenchmarks, TransactionsBulk) {
+    auto json = bulkPayload();
+    size_t transactions = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto i = 0; i < ITERATIONS; i++) {
+        LedgerApiParser<BitcoinLikeBlockchainExplorer::TransactionsBulk, TransactionsBulkParser> parser;
+        parser.attach("", 200);
+        rapidjson::Reader reader;
+        rapidjson::StringStream is(json.data());
+        reader.Parse<rapidjson::ParseFlag::kParseNumbersAsStringsFlag>(is, parser);
+        auto result = parser.build();
+        ASSERT_TRUE(result.isRight());
+        transactions += result.getRight()->transactions.size();
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+
+    EXPECT_EQ(transactions, ITERATIONS * payloads().size());
+    std::cout << "Parsed " << ITERATIONS << " bulks of " << payloads().size() << " transactions ("
+              << json.size() * ITERATIONS / 1024 << " KiB) in " << duration.count() << "ms" << std::endl;
+}
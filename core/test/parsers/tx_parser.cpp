@@ -35,3 +35,15 @@ TEST(TXParser, NumbersAsStrings) {
     auto parsed = JSONUtils::parse<TestParser>(json);
     EXPECT_EQ(parsed->height, 12);
 }
+
+TEST(TXParser, ParseUint64) {
+    std::string max = "18446744073709551615";
+    EXPECT_EQ(JSONUtils::parseUint64(max.data(), max.size()), std::numeric_limits<uint64_t>::max());
+    std::string height = "630000";
+    EXPECT_EQ(JSONUtils::parseUint64(height.data(), height.size()), 630000);
+    uint64_t value = 0;
+    std::string overflow = "18446744073709551616";
+    EXPECT_FALSE(JSONUtils::parseUint64(overflow.data(), overflow.size(), value));
+    std::string negative = "-1";
+    EXPECT_FALSE(JSONUtils::parseUint64(negative.data(), negative.size(), value));
+}
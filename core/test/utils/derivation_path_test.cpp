@@ -50,4 +50,27 @@ TEST(DerivationPath, ParseInvalidDerivationPath) {
 
 TEST(DerivationPath, ParseRoot) {
     EXPECT_TRUE(DerivationPath("m").isRoot());
-}
\ No newline at end of file
+}
+TEST(DerivationPath, ToStringWithHardenedLevels) {
+    EXPECT_EQ(DerivationPath("m/44'/2147483647'/0/1000000").toString(true), "m/44'/2147483647'/0/1000000");
+    EXPECT_EQ(DerivationPath("m").toString(true), "m/");
+}
+
+TEST(DerivationPath, GetChild) {
+    DerivationPath node("44'/0'/0'/1");
+    auto address = node.getChild(7);
+    EXPECT_EQ(address, DerivationPath("44'/0'/0'/1/7"));
+    EXPECT_EQ(address.getParent(), node);
+    EXPECT_EQ(node.getChild(0x80000000 | 3).toString(), "44'/0'/0'/1/3'");
+    EXPECT_EQ(node.toString(), "44'/0'/0'/1");
+}
+
+TEST(DerivationPath, HashAndOrder) {
+    std::hash<DerivationPath> hash;
+    EXPECT_EQ(hash(DerivationPath("44'/0'/0'/0/1")), hash(DerivationPath("m/44'/0'/0'/0/1")));
+    EXPECT_NE(hash(DerivationPath("44'/0'/0'/0/1")), hash(DerivationPath("44'/0'/0'/1/0")));
+    EXPECT_NE(hash(DerivationPath("0")), hash(DerivationPath("0/0")));
+    EXPECT_TRUE(DerivationPath("44'/0'/0'/0/1") < DerivationPath("44'/0'/0'/0/2"));
+    EXPECT_TRUE(DerivationPath("44'/0'/0'/0") < DerivationPath("44'/0'/0'/0/0"));
+    EXPECT_FALSE(DerivationPath("44'/0'/0'/1") < DerivationPath("44'/0'/0'/0/0"));
+}
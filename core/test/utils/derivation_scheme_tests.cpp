@@ -55,4 +55,17 @@ TEST(DerivationScheme, PartialScheme) {
     auto accountScheme = scheme.getSchemeFrom(DerivationSchemeLevel::NODE);
     EXPECT_EQ(xpubScheme.toString(), "44'/<coin_type>'/<account>'");
     EXPECT_EQ(accountScheme.toString(), "<node>/<address>");
-}
\ No newline at end of file
+}
+TEST(DerivationScheme, Intern) {
+    const auto& scheme = DerivationScheme::intern("44'/<coin_type>'/<account>'/<node>/<address>");
+    EXPECT_EQ(&scheme, &DerivationScheme::intern("44'/<coin_type>'/<account>'/<node>/<address>"));
+    EXPECT_EQ(scheme.toString(), "44'/<coin_type>'/<account>'/<node>/<address>");
+    EXPECT_NE(&scheme, &DerivationScheme::intern("49'/<coin_type>'/<account>'/<node>/<address>"));
+
+    auto copy = scheme;
+    copy.setCoinType(0).setAccountIndex(1);
+    EXPECT_EQ(copy.getSchemeTo(DerivationSchemeLevel::ACCOUNT_INDEX).getPath().toString(), "44'/0'/1'");
+    EXPECT_EQ(scheme.getCoinType(), 0);
+    EXPECT_EQ(scheme.getAccountIndex(), 0);
+    EXPECT_EQ(scheme.getDepth(), 5);
+}
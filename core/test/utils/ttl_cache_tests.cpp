@@ -0,0 +1,103 @@
+/*
+ *
+ * ttl_cache_tests
+ * ledger-core
+ *
+ * Created by Ledger on 19/10/2026.
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Ledger
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <utils/TTLCache.h>
+#include <string>
+#include <thread>
+
+using namespace ledger::core;
+
+TEST(TTLCache, GetReturnsWhatWasPut) {
+    TTLCache<std::string, int> cache(std::chrono::seconds(60));
+    EXPECT_TRUE(cache.get("a").isEmpty());
+    cache.put("a", 1);
+    EXPECT_EQ(cache.get("a").getValue(), 1);
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+}
+
+TEST(TTLCache, PutRefreshesExistingKey) {
+    TTLCache<std::string, int> cache(std::chrono::seconds(60));
+    cache.put("a", 1);
+    cache.put("a", 2);
+    EXPECT_EQ(cache.get("a").getValue(), 2);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(TTLCache, EvictsLeastRecentlyUsed) {
+    TTLCache<int, int> cache(std::chrono::seconds(60), 2, 1);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.get(1);
+    cache.put(3, 3);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.get(2).isEmpty());
+    EXPECT_EQ(cache.get(1).getValue(), 1);
+    EXPECT_EQ(cache.get(3).getValue(), 3);
+    EXPECT_EQ(cache.getStats().evictions, 1);
+}
+
+TEST(TTLCache, ExpiresEntriesNotAccessed) {
+    TTLCache<int, int, std::chrono::milliseconds> cache(std::chrono::milliseconds(20), 16, 1);
+    for (auto i = 0; i < 10; i++) {
+        cache.put(i, i);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // Touching the shard with another key drops every expired entry
+    cache.put(100, 100);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.getStats().expirations, 10);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    cache.purgeExpired();
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(TTLCache, ConcurrentAccessStaysBounded) {
+    TTLCache<int, int> cache(std::chrono::seconds(60), 64);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; t++) {
+        threads.emplace_back([&cache, t] () {
+            for (auto i = 0; i < 1000; i++) {
+                cache.put(t * 1000 + i, i);
+                cache.get(t * 1000 + i / 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(cache.size(), 64);
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits + stats.misses, 4000);
+}